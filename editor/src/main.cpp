@@ -17,18 +17,165 @@
  * @since  14/03/2024
  */
 
+#include <chrono>
 #include <cxxopts.hpp>
+#include <erebos/memory/tracking.hpp>
+#include <erebos/metrics.hpp>
+#include <erebos/plugin/plugin_module.hpp>
+#include <erebos/profiler.hpp>
+#include <erebos/render/capture.hpp>
+#include <erebos/render/vulkan/capture_replayer.hpp>
 #include <erebos/render/vulkan/context.hpp>
 #include <erebos/render/vulkan/device.hpp>
 #include <erebos/render/vulkan/frame.hpp>
+#include <erebos/render/vulkan/memory_budget.hpp>
+#include <erebos/render/vulkan/swapchain.hpp>
 #include <erebos/result.hpp>
 #include <erebos/window.hpp>
 #include <spdlog/spdlog.h>
+#include <thread>
+
+namespace {
+    constexpr std::array<float, 4> CLEAR_COLOR {0.08f, 0.08f, 0.1f, 1.0f};
+
+    [[nodiscard]] auto parse_present_mode(const std::string& name) noexcept -> erebos::render::vulkan::PresentMode {
+        using erebos::render::vulkan::PresentMode;
+        if(name == "immediate") {
+            return PresentMode::IMMEDIATE;
+        }
+        if(name == "fifo") {
+            return PresentMode::FIFO;
+        }
+        if(name == "fifo-relaxed") {
+            return PresentMode::FIFO_RELAXED;
+        }
+        return PresentMode::MAILBOX;
+    }
+
+    auto record_clear(const erebos::render::vulkan::CommandBuffer& command_buffer, VkImage image) noexcept -> void {
+        VkImageMemoryBarrier image_barrier {};
+        image_barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        image_barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        image_barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        image_barrier.image = image;
+        image_barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+        image_barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        image_barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        image_barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        ::vkCmdPipelineBarrier(*command_buffer,
+                               VK_PIPELINE_STAGE_TRANSFER_BIT,
+                               VK_PIPELINE_STAGE_TRANSFER_BIT,
+                               0,
+                               0,
+                               nullptr,
+                               0,
+                               nullptr,
+                               1,
+                               &image_barrier);
+
+        constexpr VkClearColorValue clear_color {{CLEAR_COLOR[0], CLEAR_COLOR[1], CLEAR_COLOR[2], CLEAR_COLOR[3]}};
+        ::vkCmdClearColorImage(*command_buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &clear_color, 1, &image_barrier.subresourceRange);
+
+        image_barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        image_barrier.newLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+        image_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        image_barrier.dstAccessMask = 0;
+        ::vkCmdPipelineBarrier(*command_buffer,
+                               VK_PIPELINE_STAGE_TRANSFER_BIT,
+                               VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                               0,
+                               0,
+                               nullptr,
+                               0,
+                               nullptr,
+                               1,
+                               &image_barrier);
+    }
+
+    // Replay the capture headless, so no window or surface is needed and the replay also runs on software rasterizers
+    [[nodiscard]] auto replay_capture(const std::string& path) noexcept -> int {
+        const auto reader = erebos::try_construct<erebos::render::CaptureReader>(path);
+        if(!reader) {
+            SPDLOG_ERROR("{}", reader.get_error());
+            return -1;
+        }
+
+        const auto vulkan_context = erebos::try_construct<erebos::render::vulkan::VulkanContext>();
+        if(!vulkan_context) {
+            SPDLOG_ERROR("{}", vulkan_context.get_error());
+            return -1;
+        }
+
+        const auto device = erebos::render::vulkan::find_preferred_device(*vulkan_context);
+        if(!device) {
+            SPDLOG_ERROR("No device found");
+            return -1;
+        }
+
+        auto replayer = erebos::try_construct<erebos::render::vulkan::CaptureReplayer>(*device, *reader);
+        if(!replayer) {
+            SPDLOG_ERROR("{}", replayer.get_error());
+            return -1;
+        }
+
+        const auto statistics = replayer->replay(*reader);
+        if(!statistics) {
+            SPDLOG_ERROR("{}", statistics.get_error());
+            return -1;
+        }
+
+        const auto to_milliseconds = [](const std::chrono::nanoseconds duration) noexcept -> double {
+            return std::chrono::duration<double, std::milli> {duration}.count();
+        };
+        SPDLOG_INFO("Replayed {} frames ({} commands) in {:.2f} ms -> {} submits, {} command buffers",
+                    statistics->frame_count,
+                    statistics->command_count,
+                    to_milliseconds(statistics->total_time),
+                    statistics->submit_count,
+                    statistics->command_buffer_count);
+        SPDLOG_INFO("CPU recording time -> total {:.2f} ms, average {:.3f} ms, max {:.3f} ms",
+                    to_milliseconds(statistics->recording_time),
+                    statistics->frame_count > 0 ? to_milliseconds(statistics->recording_time) / statistics->frame_count : 0.0,
+                    to_milliseconds(statistics->max_frame_recording_time));
+        return 0;
+    }
+}// namespace
 
 auto main(int argc, char* argv[]) -> int {
     cxxopts::Options options {"aetherium-editor"};
     options.add_option("general", cxxopts::Option {"h,help", "Get help", cxxopts::value<bool>()});
     options.add_option("general", cxxopts::Option {"v,verbose", "Enable verbose logging", cxxopts::value<bool>()});
+    options.add_option("render", cxxopts::Option {"present-mode", "Preferred present mode (mailbox, immediate, fifo, fifo-relaxed)",
+                                                  cxxopts::value<std::string>()->default_value("mailbox")});
+    options.add_option("render", cxxopts::Option {"image-count", "Count of swapchain images",
+                                                  cxxopts::value<erebos::u32>()->default_value("3")});
+    options.add_option("render", cxxopts::Option {"threaded", "Render on a dedicated thread, decoupled from the event pumping",
+                                                  cxxopts::value<bool>()});
+    options.add_option("render", cxxopts::Option {"target-fps", "Frame rate cap of the focused window, 0 for uncapped",
+                                                  cxxopts::value<erebos::u32>()->default_value("144")});
+    options.add_option("render", cxxopts::Option {"unfocused-fps", "Frame rate cap of the unfocused window",
+                                                  cxxopts::value<erebos::u32>()->default_value("15")});
+    options.add_option("general", cxxopts::Option {"plugin", "Load the plugin library and reload it after it was rebuilt",
+                                                   cxxopts::value<std::vector<std::string>>()});
+    options.add_option("debug", cxxopts::Option {"allocation-sample-rate", "Capture the call stack of every n-th allocation",
+                                                 cxxopts::value<erebos::usize>()->default_value("0")});
+    options.add_option("debug", cxxopts::Option {"allocation-dump-interval", "Dump the allocation statistics every n seconds",
+                                                 cxxopts::value<erebos::usize>()->default_value("0")});
+    options.add_option("debug", cxxopts::Option {"simulated-memory-budget", "Limit the budget of all heaps to n MiB",
+                                                 cxxopts::value<erebos::usize>()->default_value("0")});
+    options.add_option("debug", cxxopts::Option {"simulated-frame-load", "Stall every frame for n milliseconds before the submit",
+                                                 cxxopts::value<erebos::usize>()->default_value("0")});
+    options.add_option("debug", cxxopts::Option {"trace-out", "Capture the profile zones into a Chrome trace file",
+                                                 cxxopts::value<std::string>()});
+    options.add_option("debug", cxxopts::Option {"metrics-out", "Write the metrics of every frame into a CSV or JSON (.json) file",
+                                                 cxxopts::value<std::string>()});
+    options.add_option("debug", cxxopts::Option {"hud", "Show the frame statistics in the window title", cxxopts::value<bool>()});
+    options.add_option("debug", cxxopts::Option {"capture-out", "Capture the recording of the first frames into a capture file",
+                                                 cxxopts::value<std::string>()});
+    options.add_option("debug", cxxopts::Option {"capture-frames", "Count of frames captured into the capture file",
+                                                 cxxopts::value<erebos::u32>()->default_value("300")});
+    options.add_option("debug", cxxopts::Option {"replay", "Replay a capture file headless and report the recording statistics",
+                                                 cxxopts::value<std::string>()});
 
     const auto parse_result = options.parse(argc, argv);
     spdlog::set_level(parse_result.count("verbose") ? spdlog::level::trace : spdlog::level::info);
@@ -41,6 +188,10 @@ auto main(int argc, char* argv[]) -> int {
         return 0;
     }
 
+    if(parse_result.count("replay")) {
+        return replay_capture(parse_result["replay"].as<std::string>());
+    }
+
     // Create window, vulkan context and device
     auto window = erebos::try_construct<erebos::Window>("Aetherium Editor");
     if(!window) {
@@ -67,10 +218,318 @@ auto main(int argc, char* argv[]) -> int {
     }
     SPDLOG_INFO("Format: {}/{}", static_cast<uint32_t>((*format)->format), static_cast<uint32_t>((*format)->colorSpace));
 
-    SPDLOG_INFO("Entering window event loop");
-    if(const auto result = window->run_loop(); !result) {
+    // Track the memory budget of the device, optionally with a simulated budget for low-memory devices
+    erebos::render::vulkan::MemoryBudgetManager budget_manager {device->get_allocator()};
+    if(const auto simulated_budget = parse_result["simulated-memory-budget"].as<erebos::usize>(); simulated_budget > 0) {
+        for(erebos::u32 i = 0; i < budget_manager.get_heap_budgets().size(); i++) {
+            budget_manager.set_budget_override(i, simulated_budget * 1024 * 1024);
+        }
+    }
+
+    auto last_pressure = erebos::render::vulkan::MemoryPressure::LOW;
+    window->add_render_callback(
+            [&](void*) -> erebos::Result<void> {
+                budget_manager.update();
+                auto pressure = erebos::render::vulkan::MemoryPressure::LOW;
+                for(const auto& heap_budget : budget_manager.get_heap_budgets()) {
+                    pressure = std::max(pressure, heap_budget.pressure);
+                }
+
+                if(pressure != last_pressure) {
+                    SPDLOG_WARN("Memory pressure changed to level {}", static_cast<erebos::u32>(pressure));
+                    last_pressure = pressure;
+                }
+                return {};
+            },
+            nullptr);
+
+    // Create swapchain and frames in flight
+    erebos::render::vulkan::SwapchainConfig swapchain_config {};
+    swapchain_config.preferred_present_modes = {parse_present_mode(parse_result["present-mode"].as<std::string>()),
+                                                erebos::render::vulkan::PresentMode::FIFO};
+    swapchain_config.image_count = parse_result["image-count"].as<erebos::u32>();
+    auto swapchain = erebos::try_construct<erebos::render::vulkan::Swapchain>(*device, **format, swapchain_config);
+    if(!swapchain) {
+        SPDLOG_ERROR("{}", swapchain.get_error());
+        return -1;
+    }
+
+    // Collect the metrics of every frame for the overlay and write them into the metrics file, if requested
+    erebos::metrics::FrameMetrics frame_metrics {};
+    std::optional<erebos::metrics::MetricsWriter> metrics_writer {};
+    if(parse_result.count("metrics-out")) {
+        auto writer = erebos::try_construct<erebos::metrics::MetricsWriter>(parse_result["metrics-out"].as<std::string>());
+        if(!writer) {
+            SPDLOG_ERROR("{}", writer.get_error());
+            return -1;
+        }
+        metrics_writer.emplace(std::move(*writer));
+    }
+
+    erebos::u64 submitted_frame_count = 0;
+    auto last_sample_time = std::chrono::steady_clock::now();
+    const auto record_frame_metrics = [&](erebos::render::vulkan::Frame& frame, const std::chrono::nanoseconds cpu_time) {
+        const auto now = std::chrono::steady_clock::now();
+        erebos::metrics::FrameSample sample {};
+        sample.frame_index = submitted_frame_count++;
+        sample.frame_time = now - last_sample_time;
+        sample.cpu_time = cpu_time;
+        sample.submit_count = 1;
+        sample.frame_arena_bytes = frame.get_allocation_statistics().allocated_bytes;
+        sample.live_heap_bytes = erebos::memory::get_global_allocation_counters().live_bytes;
+        last_sample_time = now;
+
+        // The GPU time belongs to the last submission of this frame, the profiler reads it back in begin_frame
+        for(auto& queue_frame : frame.get_queue_frames()) {
+            sample.command_buffer_count += static_cast<erebos::u32>(queue_frame.get_recording_command_buffers().size());
+            sample.gpu_time += std::chrono::nanoseconds {queue_frame.get_profiler().get_frame_duration()};
+        }
+        for(const auto& heap_budget : budget_manager.get_heap_budgets()) {
+            sample.device_memory_usage += heap_budget.usage;
+            sample.device_memory_budget += heap_budget.budget;
+        }
+
+        // The editor doesn't upload resources yet, so the uploaded bytes stay zero
+        frame_metrics.add_sample(sample);
+        if(metrics_writer.has_value()) {
+            metrics_writer->write_sample(sample);
+        }
+    };
+
+    // Capture the recording of the first frames, if requested. The capture can be replayed with --replay.
+    std::optional<erebos::render::CaptureWriter> capture_writer {};
+    const auto capture_frame_count = parse_result["capture-frames"].as<erebos::u32>();
+    if(parse_result.count("capture-out")) {
+        const auto [width, height] = window->get_drawable_size();
+        auto writer = erebos::try_construct<erebos::render::CaptureWriter>(parse_result["capture-out"].as<std::string>(), width, height);
+        if(!writer) {
+            SPDLOG_ERROR("{}", writer.get_error());
+            return -1;
+        }
+        capture_writer.emplace(std::move(*writer));
+    }
+
+    const std::chrono::milliseconds simulated_frame_load {parse_result["simulated-frame-load"].as<erebos::usize>()};
+    std::vector<erebos::render::vulkan::Frame> frames {};
+    frames.reserve(2);
+    frames.emplace_back(*device);
+    frames.emplace_back(*device);
+    erebos::usize frame_index = 0;
+
+    // Remember the oldest unhandled input for the input-to-photon latency and recreate the swapchain on resize. The
+    // input time is taken from the event's timestamp, so the time spent in the event queue is part of the latency.
+    std::optional<std::chrono::steady_clock::time_point> input_time {};
+    const auto record_input_time = [&](SDL_Event& event, void*) -> erebos::Result<void> {
+        if(!input_time.has_value()) {
+            const std::chrono::milliseconds event_age {::SDL_GetTicks() - event.common.timestamp};
+            input_time = std::chrono::steady_clock::now() - event_age;
+        }
+        return {};
+    };
+    window->add_event_callback(record_input_time, nullptr, 0, SDL_KEYDOWN);
+    window->add_event_callback(record_input_time, nullptr, 0, SDL_MOUSEBUTTONDOWN);
+    window->add_event_callback(record_input_time, nullptr, 0, SDL_MOUSEMOTION);
+
+    window->add_event_callback(
+            [&](SDL_Event& event, void*) -> erebos::Result<void> {
+                if(event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED) {
+                    const auto [width, height] = window->get_drawable_size();
+                    return swapchain->recreate({width, height});
+                }
+                return {};
+            },
+            nullptr,
+            0,
+            SDL_WINDOWEVENT);
+
+    window->add_render_callback(
+            [&](void*) -> erebos::Result<void> {
+                if(swapchain->is_outdated()) {
+                    const auto [width, height] = window->get_drawable_size();
+                    EREBOS_TRY(swapchain->recreate({width, height}));
+                    if(swapchain->is_outdated()) {
+                        return {};
+                    }
+                }
+
+                EREBOS_TRY(swapchain->wait_for_frame_latency());
+                auto& frame = frames[frame_index];
+                frame_index = (frame_index + 1) % frames.size();
+                EREBOS_TRY(frame.begin_frame());
+
+                EREBOS_TRY_ASSIGN(const auto image_index, swapchain->acquire_next_image(frame.get_image_acquired_semaphore()));
+                if(!image_index.has_value()) {
+                    return {};
+                }
+
+                // The CPU time starts after the waits for the frame latency, the fence and the image
+                const auto cpu_begin = std::chrono::steady_clock::now();
+                auto* capture = capture_writer.has_value() ? &*capture_writer : nullptr;
+                if(capture != nullptr) {
+                    capture->begin_frame();
+                    capture->acquire_command_buffer(0);
+                    capture->begin_command_buffer(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
+                }
+
+                EREBOS_TRY_ASSIGN(auto* command_buffer, frame.get_queue_frames()[0].acquire_command_buffer());
+                EREBOS_TRY(command_buffer->begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT));
+                {
+                    const erebos::render::vulkan::GpuScope clear_scope {frame.get_queue_frames()[0].get_profiler(), *command_buffer, "Clear"};
+                    record_clear(*command_buffer, swapchain->get_images()[*image_index]);
+                    if(capture != nullptr) {
+                        capture->begin_label("Clear");
+                        capture->clear_image(CLEAR_COLOR);
+                        capture->end_label();
+                    }
+                }
+                EREBOS_TRY(command_buffer->end());
+
+                if(simulated_frame_load.count() > 0) {
+                    std::this_thread::sleep_for(simulated_frame_load);
+                }
+                EREBOS_TRY(frame.submit());
+                record_frame_metrics(frame, std::chrono::steady_clock::now() - cpu_begin);
+
+                // Close the capture after the last captured frame, so the capture is complete while the editor runs
+                if(capture != nullptr) {
+                    capture->end_command_buffer();
+                    capture->submit();
+                    capture->end_frame();
+                    if(capture->get_frame_count() >= capture_frame_count) {
+                        SPDLOG_INFO("Captured {} frames into capture file", capture->get_frame_count());
+                        capture_writer.reset();
+                    }
+                }
+
+                const auto frame_input_time = input_time;
+                input_time.reset();
+                return swapchain->present(device->get_queues()[0], *image_index, frame.get_rendering_done_semaphore(), frame_input_time);
+            },
+            nullptr);
+
+    // Show the frame statistics in the window title as overlay. The render callback formats the title and the window
+    // sets it on the thread which pumps the events, because SDL doesn't allow to set the title on the render thread.
+    auto last_hud_update = std::chrono::steady_clock::now();
+    if(parse_result.count("hud")) {
+        window->add_render_callback(
+                [&](void*) -> erebos::Result<void> {
+                    const auto now = std::chrono::steady_clock::now();
+                    if(now - last_hud_update < std::chrono::milliseconds {500} || frame_metrics.get_sample_count() == 0) {
+                        return {};
+                    }
+
+                    const auto summary = frame_metrics.get_summary();
+                    const auto& last_sample = frame_metrics.get_last_sample();
+                    window->set_title(fmt::format("Aetherium Editor | {:.1f} FPS | p50 {:.2f} ms, p95 {:.2f} ms, p99 {:.2f} ms | CPU {:.2f} ms, "
+                                                  "GPU {:.2f} ms | {} CB, {} submits | Arena {} KiB, VRAM {}/{} MiB",
+                                                  summary.frame_time_p50 > 0.0 ? 1000.0 / summary.frame_time_p50 : 0.0,
+                                                  summary.frame_time_p50,
+                                                  summary.frame_time_p95,
+                                                  summary.frame_time_p99,
+                                                  summary.average_cpu_time,
+                                                  summary.average_gpu_time,
+                                                  last_sample.command_buffer_count,
+                                                  last_sample.submit_count,
+                                                  last_sample.frame_arena_bytes / 1024,
+                                                  last_sample.device_memory_usage / (1024 * 1024),
+                                                  last_sample.device_memory_budget / (1024 * 1024)));
+                    last_hud_update = now;
+                    return {};
+                },
+                nullptr);
+    }
+
+    // Load the plugins and update them every frame. The plugins are reloaded before the update, if they were rebuilt.
+    std::vector<erebos::plugin::PluginModule> plugins {};
+    if(parse_result.count("plugin")) {
+        for(const auto& plugin_path : parse_result["plugin"].as<std::vector<std::string>>()) {
+            auto plugin = erebos::try_construct<erebos::plugin::PluginModule>(plugin_path);
+            if(!plugin) {
+                SPDLOG_ERROR("{}", plugin.get_error());
+                return -1;
+            }
+            plugins.push_back(std::move(*plugin));
+        }
+    }
+
+    auto last_plugin_update = std::chrono::steady_clock::now();
+    if(!plugins.empty()) {
+        window->add_render_callback(
+                [&](void*) -> erebos::Result<void> {
+                    const auto now = std::chrono::steady_clock::now();
+                    const auto delta_time = std::chrono::duration<double> {now - last_plugin_update}.count();
+                    last_plugin_update = now;
+                    for(auto& plugin : plugins) {
+                        EREBOS_TRY(plugin.handle_file_events());
+                        plugin.update(delta_time);
+                    }
+                    return {};
+                },
+                nullptr);
+    }
+
+    // Dump allocation statistics periodically, if requested
+    erebos::memory::set_allocation_sample_rate(parse_result["allocation-sample-rate"].as<erebos::usize>());
+    const std::chrono::seconds dump_interval {parse_result["allocation-dump-interval"].as<erebos::usize>()};
+    auto last_dump = std::chrono::steady_clock::now();
+    if(dump_interval.count() > 0) {
+        window->add_render_callback(
+                [&](void*) -> erebos::Result<void> {
+                    if(const auto now = std::chrono::steady_clock::now(); now - last_dump >= dump_interval) {
+                        erebos::memory::dump_allocation_statistics();
+                        last_dump = now;
+                    }
+                    return {};
+                },
+                nullptr);
+    }
+
+    erebos::FrameSchedulerConfig frame_scheduler_config {};
+    frame_scheduler_config.target_frame_rate = parse_result["target-fps"].as<erebos::u32>();
+    frame_scheduler_config.unfocused_frame_rate = parse_result["unfocused-fps"].as<erebos::u32>();
+    window->set_frame_scheduler_config(frame_scheduler_config);
+
+    // Capture the profile zones into a trace file, if requested
+    if(parse_result.count("trace-out")) {
+        if(!erebos::profiler::is_profiling_enabled()) {
+            SPDLOG_WARN("Profiling is not compiled in, the trace contains no zones (Enable EREBOS_ENABLE_PROFILING)");
+        }
+
+        if(const auto capture_result = erebos::profiler::start_capture(parse_result["trace-out"].as<std::string>()); !capture_result) {
+            SPDLOG_ERROR("{}", capture_result.get_error());
+            return -1;
+        }
+    }
+
+    const auto loop_mode = parse_result.count("threaded") ? erebos::LoopMode::THREADED : erebos::LoopMode::SINGLE_THREADED;
+    SPDLOG_INFO("Entering {} window event loop", loop_mode == erebos::LoopMode::THREADED ? "threaded" : "single-threaded");
+    const auto result = window->run_loop(loop_mode);
+    ::vkDeviceWaitIdle(**device);
+    if(const auto dropped_zone_count = erebos::profiler::stop_capture(); dropped_zone_count > 0) {
+        SPDLOG_WARN("Dropped {} profile zones, because the ring buffers were full", dropped_zone_count);
+    }
+    if(!result) {
         SPDLOG_ERROR("{}", result.get_error());
         return -1;
     }
+
+    if(metrics_writer.has_value()) {
+        const auto summary = metrics_writer->get_summary();
+        SPDLOG_INFO("Frame time of {} frames -> p50 {:.2f} ms, p95 {:.2f} ms, p99 {:.2f} ms (CPU {:.2f} ms, GPU {:.2f} ms)",
+                    summary.sample_count,
+                    summary.frame_time_p50,
+                    summary.frame_time_p95,
+                    summary.frame_time_p99,
+                    summary.average_cpu_time,
+                    summary.average_gpu_time);
+    }
+
+    const auto& latency_statistics = swapchain->get_latency_statistics();
+    SPDLOG_INFO("Input-to-{} latency -> last {} us, average {} us, max {} us ({} samples)",
+                latency_statistics.is_photon_latency ? "photon" : "present",
+                latency_statistics.last.count(),
+                latency_statistics.average.count(),
+                latency_statistics.max.count(),
+                latency_statistics.sample_count);
     return 0;
 }
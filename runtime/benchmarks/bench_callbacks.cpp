@@ -0,0 +1,94 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <erebos/callback_registry.hpp>
+#include <functional>
+#include <vector>
+
+namespace {
+    constexpr erebos::usize EVENT_COUNT = 1'000'000;
+    constexpr erebos::u32 EVENT_TYPE_COUNT = 8;
+
+    struct SyntheticEvent final {
+        erebos::u32 type;
+        erebos::u32 payload;
+    };
+
+    auto ignore_error(const std::string&) noexcept -> void {
+    }
+
+    // Every event type has one subscriber, like the input and window handlers of the editor
+    auto make_handler(erebos::u64& checksum, const erebos::u32 type) {
+        return [&checksum, type](SyntheticEvent& event, void*) -> erebos::Result<void> {
+            if(event.type == type) {
+                checksum += event.payload;
+            }
+            return {};
+        };
+    }
+
+    [[nodiscard]] auto make_events() -> std::vector<SyntheticEvent> {
+        std::vector<SyntheticEvent> events(EVENT_COUNT);
+        for(erebos::u32 i = 0; i < EVENT_COUNT; i++) {
+            events[i] = {(i * 7) % EVENT_TYPE_COUNT, i};
+        }
+        return events;
+    }
+}// namespace
+
+static void bench_dispatch_std_function(benchmark::State& state) {
+    auto events = make_events();
+    erebos::u64 checksum = 0;
+    std::vector<std::pair<std::function<erebos::Result<void>(SyntheticEvent&, void*)>, void*>> callbacks {};
+    for(erebos::u32 type = 0; type < EVENT_TYPE_COUNT; type++) {
+        callbacks.emplace_back(make_handler(checksum, type), nullptr);
+    }
+
+    for([[maybe_unused]] auto _ : state) {
+        for(auto& event : events) {
+            for(const auto& callback : callbacks) {
+                if(auto result = callback.first(event, callback.second); !result) {
+                    ignore_error(result.get_error());
+                }
+            }
+        }
+        benchmark::DoNotOptimize(checksum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * EVENT_COUNT));
+}
+BENCHMARK(bench_dispatch_std_function)->Unit(benchmark::kMillisecond);
+
+static void bench_dispatch_callback_registry(benchmark::State& state) {
+    auto events = make_events();
+    erebos::u64 checksum = 0;
+    erebos::CallbackRegistry<SyntheticEvent&> registry {};
+    for(erebos::u32 type = 0; type < EVENT_TYPE_COUNT; type++) {
+        registry.add(make_handler(checksum, type), nullptr, 0, type);
+    }
+
+    for([[maybe_unused]] auto _ : state) {
+        for(auto& event : events) {
+            registry.dispatch(event.type, ignore_error, event);
+        }
+        benchmark::DoNotOptimize(checksum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * EVENT_COUNT));
+}
+BENCHMARK(bench_dispatch_callback_registry)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,93 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <erebos/platform/symbol_table.hpp>
+
+namespace {
+#if defined(PLATFORM_WINDOWS)
+    constexpr const char* MATH_LIBRARY = "ucrtbase.dll";
+#elif defined(PLATFORM_MACOS)
+    constexpr const char* MATH_LIBRARY = "libm.dylib";
+#else
+    constexpr const char* MATH_LIBRARY = "libm.so.6";
+#endif
+
+    template<erebos::platform::FixedString NAME>
+    using MathSymbol = erebos::platform::Symbol<NAME, double(double)>;
+
+    // The math library is available everywhere and exports enough functions to simulate the entry points of a layer
+    using MathSymbols = erebos::platform::SymbolTable<MathSymbol<"sin">, MathSymbol<"cos">, MathSymbol<"tan">, MathSymbol<"asin">,
+                                                      MathSymbol<"acos">, MathSymbol<"atan">, MathSymbol<"sinh">, MathSymbol<"cosh">,
+                                                      MathSymbol<"tanh">, MathSymbol<"exp">, MathSymbol<"log">, MathSymbol<"log10">,
+                                                      MathSymbol<"sqrt">, MathSymbol<"cbrt">, MathSymbol<"floor">, MathSymbol<"ceil">,
+                                                      MathSymbol<"round">, MathSymbol<"trunc">, MathSymbol<"fabs">, MathSymbol<"erf">,
+                                                      MathSymbol<"erfc">, MathSymbol<"tgamma">, MathSymbol<"lgamma">, MathSymbol<"expm1">>;
+
+    constexpr std::array<const char*, MathSymbols::get_size()> MATH_SYMBOL_NAMES {
+            "sin",  "cos",  "tan",  "asin", "acos",  "atan", "sinh",  "cosh", "tanh", "exp", "log",    "log10",
+            "sqrt", "cbrt", "floor", "ceil", "round", "trunc", "fabs", "erf",  "erfc", "tgamma", "lgamma", "expm1"};
+}// namespace
+
+// Resolves every symbol on its own through get_function, like the loaders did before the symbol tables
+static void bench_dynlib_get_function(benchmark::State& state) {
+    const erebos::platform::LibraryLoader library {MATH_LIBRARY};
+    for([[maybe_unused]] auto _ : state) {
+        for(const auto* name : MATH_SYMBOL_NAMES) {
+            auto function = library.get_function<double, double>(name);
+            benchmark::DoNotOptimize(function);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * MATH_SYMBOL_NAMES.size()));
+}
+BENCHMARK(bench_dynlib_get_function);
+
+// Resolves all symbols in bulk into a symbol table
+static void bench_dynlib_symbol_table(benchmark::State& state) {
+    const erebos::platform::LibraryLoader library {MATH_LIBRARY};
+    for([[maybe_unused]] auto _ : state) {
+        const MathSymbols symbols {library};
+        benchmark::DoNotOptimize(symbols);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * MathSymbols::get_size()));
+}
+BENCHMARK(bench_dynlib_symbol_table);
+
+// Measures the startup cost of a library, the library is already loaded by the process, so this doesn't measure the
+// file I/O of the dynamic linker
+static void bench_dynlib_load_and_resolve(benchmark::State& state) {
+    for([[maybe_unused]] auto _ : state) {
+        const erebos::platform::LibraryLoader library {MATH_LIBRARY};
+        const MathSymbols symbols {library};
+        benchmark::DoNotOptimize(symbols);
+    }
+}
+BENCHMARK(bench_dynlib_load_and_resolve);
+
+// Calls a function through the symbol table, the lookup of the symbol happens at compile time
+static void bench_dynlib_symbol_table_call(benchmark::State& state) {
+    const erebos::platform::LibraryLoader library {MATH_LIBRARY};
+    const MathSymbols symbols {library};
+    double value = 0.5;
+    for([[maybe_unused]] auto _ : state) {
+        value = symbols.get<"fabs">()(value);
+        benchmark::DoNotOptimize(value);
+    }
+}
+BENCHMARK(bench_dynlib_symbol_table_call);
@@ -0,0 +1,209 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <erebos/platform/file.hpp>
+#include <erebos/platform/stream_reader.hpp>
+#include <fstream>
+#include <vector>
+
+namespace {
+    constexpr erebos::usize PAGE_SIZE = 4096;
+    constexpr erebos::usize WRITE_BLOCK_SIZE = 1 << 20;
+
+    // Creates a file with the size of the benchmark argument in the temporary directory, the file is reused by all
+    // iterations, so the loads measure the page cache and not the disk
+    [[nodiscard]] auto create_benchmark_file(const erebos::usize size) -> std::filesystem::path {
+        const auto path = std::filesystem::temp_directory_path() / fmt::format("erebos-bench-file-{}.bin", size);
+        std::ofstream stream {path, std::ios::binary | std::ios::trunc};
+        std::vector<char> content(std::min(size, WRITE_BLOCK_SIZE));
+        for(erebos::usize offset = 0; offset < size; offset += content.size()) {
+            const auto block_size = std::min(content.size(), size - offset);
+            for(erebos::usize i = 0; i < block_size; i++) {
+                content[i] = static_cast<char>((offset + i) * 31);
+            }
+            stream.write(content.data(), static_cast<std::streamsize>(block_size));
+        }
+        return path;
+    }
+
+    // Touches one byte per page, so the loads include the page faults of the mapping
+    [[nodiscard]] auto touch_pages(const erebos::u8* data, const erebos::usize size) noexcept -> erebos::u64 {
+        erebos::u64 checksum = 0;
+        for(erebos::usize offset = 0; offset < size; offset += PAGE_SIZE) {
+            checksum += data[offset];
+        }
+        return checksum;
+    }
+}// namespace
+
+static void bench_file_map_into_memory(benchmark::State& state) {
+    const auto size = static_cast<erebos::usize>(state.range(0));
+    const auto path = create_benchmark_file(size);
+    for([[maybe_unused]] auto _ : state) {
+        const auto file = erebos::platform::File {path, erebos::platform::AccessMode::READ};
+        auto mapping = file.map_into_memory();
+        if(mapping.is_error()) {
+            state.SkipWithError(mapping.get_error().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(touch_pages(**mapping, mapping->get_size()));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size));
+    std::filesystem::remove(path);
+}
+BENCHMARK(bench_file_map_into_memory)->RangeMultiplier(16)->Range(4 << 10, 64 << 20)->Unit(benchmark::kMicrosecond);
+
+static void bench_file_read_stream(benchmark::State& state) {
+    const auto size = static_cast<erebos::usize>(state.range(0));
+    const auto path = create_benchmark_file(size);
+    std::vector<char> buffer(size);
+    for([[maybe_unused]] auto _ : state) {
+        std::ifstream stream {path, std::ios::binary};
+        stream.read(buffer.data(), static_cast<std::streamsize>(size));
+        benchmark::DoNotOptimize(touch_pages(reinterpret_cast<const erebos::u8*>(buffer.data()), size));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size));
+    std::filesystem::remove(path);
+}
+BENCHMARK(bench_file_read_stream)->RangeMultiplier(16)->Range(4 << 10, 64 << 20)->Unit(benchmark::kMicrosecond);
+
+static void bench_file_get_metadata_cached(benchmark::State& state) {
+    const auto path = create_benchmark_file(PAGE_SIZE);
+    const auto file = erebos::platform::File {path, erebos::platform::AccessMode::READ};
+    for([[maybe_unused]] auto _ : state) {
+        auto metadata = file.get_metadata();
+        benchmark::DoNotOptimize(metadata);
+    }
+    std::filesystem::remove(path);
+}
+BENCHMARK(bench_file_get_metadata_cached);
+
+// Reads the metadata with a system call in every iteration, like the first call of get_metadata
+static void bench_file_get_metadata_uncached(benchmark::State& state) {
+    const auto path = create_benchmark_file(PAGE_SIZE);
+    auto file = erebos::platform::File {path, erebos::platform::AccessMode::READ};
+    for([[maybe_unused]] auto _ : state) {
+        file.invalidate_metadata();
+        auto metadata = file.get_metadata();
+        benchmark::DoNotOptimize(metadata);
+    }
+    std::filesystem::remove(path);
+}
+BENCHMARK(bench_file_get_metadata_uncached);
+
+// Scans the metadata of many files like an asset database, once in bulk and once with the standard library, which
+// needs a system call per queried property
+static void bench_file_read_metadata_bulk(benchmark::State& state) {
+    const auto file_count = static_cast<erebos::usize>(state.range(0));
+    const auto directory = std::filesystem::temp_directory_path() / "erebos-bench-file-metadata";
+    std::filesystem::create_directories(directory);
+    std::vector<std::filesystem::path> paths {};
+    for(erebos::usize i = 0; i < file_count; i++) {
+        paths.push_back(directory / fmt::format("file-{}.bin", i));
+        std::ofstream {paths.back()} << i;
+    }
+
+    for([[maybe_unused]] auto _ : state) {
+        auto metadata = erebos::platform::read_metadata(paths);
+        benchmark::DoNotOptimize(metadata);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * file_count));
+    std::filesystem::remove_all(directory);
+}
+BENCHMARK(bench_file_read_metadata_bulk)->Arg(256)->Arg(4096)->Unit(benchmark::kMicrosecond);
+
+static void bench_file_read_metadata_std(benchmark::State& state) {
+    const auto file_count = static_cast<erebos::usize>(state.range(0));
+    const auto directory = std::filesystem::temp_directory_path() / "erebos-bench-file-metadata-std";
+    std::filesystem::create_directories(directory);
+    std::vector<std::filesystem::path> paths {};
+    for(erebos::usize i = 0; i < file_count; i++) {
+        paths.push_back(directory / fmt::format("file-{}.bin", i));
+        std::ofstream {paths.back()} << i;
+    }
+
+    for([[maybe_unused]] auto _ : state) {
+        for(const auto& path : paths) {
+            benchmark::DoNotOptimize(std::filesystem::file_size(path));
+            benchmark::DoNotOptimize(std::filesystem::last_write_time(path));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * file_count));
+    std::filesystem::remove_all(directory);
+}
+BENCHMARK(bench_file_read_metadata_std)->Arg(256)->Arg(4096)->Unit(benchmark::kMicrosecond);
+
+// Copies a large file chunk by chunk into a staging buffer like an asset upload. The stream reader reads from the
+// device with direct I/O while the mapping reads from the page cache filled by the creation of the file, so the
+// mapping is the upper bound for a file which was read before
+static void bench_file_stream_reader(benchmark::State& state) {
+    const auto size = static_cast<erebos::usize>(state.range(0));
+    const auto readahead_depth = static_cast<erebos::usize>(state.range(1));
+    const auto path = create_benchmark_file(size);
+    std::vector<erebos::u8> staging_buffer(erebos::platform::DEFAULT_STREAM_BUFFER_SIZE);
+    for([[maybe_unused]] auto _ : state) {
+        auto reader = erebos::platform::StreamReader {path, staging_buffer.size(), readahead_depth};
+        state.SetLabel(reader.is_direct() ? "direct" : "cached");
+        while(true) {
+            auto chunk = reader.next();
+            if(chunk.is_error()) {
+                state.SkipWithError(chunk.get_error().c_str());
+                break;
+            }
+
+            if(!chunk->has_value()) {
+                break;
+            }
+            std::memcpy(staging_buffer.data(), (*chunk)->data(), (*chunk)->size());
+            benchmark::ClobberMemory();
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size));
+    std::filesystem::remove(path);
+}
+BENCHMARK(bench_file_stream_reader)
+        ->Args({64 << 20, 2})
+        ->Args({64 << 20, 3})
+        ->Args({2048ll << 20, 3})
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+
+static void bench_file_map_into_memory_staging(benchmark::State& state) {
+    const auto size = static_cast<erebos::usize>(state.range(0));
+    const auto path = create_benchmark_file(size);
+    std::vector<erebos::u8> staging_buffer(erebos::platform::DEFAULT_STREAM_BUFFER_SIZE);
+    for([[maybe_unused]] auto _ : state) {
+        const auto file = erebos::platform::File {path, erebos::platform::AccessMode::READ};
+        auto mapping = file.map_into_memory();
+        if(mapping.is_error()) {
+            state.SkipWithError(mapping.get_error().c_str());
+            break;
+        }
+
+        for(erebos::usize offset = 0; offset < size; offset += staging_buffer.size()) {
+            std::memcpy(staging_buffer.data(), **mapping + offset, std::min(staging_buffer.size(), size - offset));
+            benchmark::ClobberMemory();
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size));
+    std::filesystem::remove(path);
+}
+BENCHMARK(bench_file_map_into_memory_staging)->Arg(64 << 20)->Arg(2048ll << 20)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,86 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <erebos/platform/file_watcher.hpp>
+#include <fstream>
+
+namespace {
+    constexpr auto EVENT_TIMEOUT = std::chrono::seconds {5};
+
+    // Polls the event queue like the editor's main loop until the expected count of events was handled or the timeout
+    // exceeded
+    [[nodiscard]] auto wait_for_events(erebos::platform::FileWatcher& watcher, const erebos::usize count) noexcept -> bool {
+        erebos::usize handled_events = 0;
+        const auto deadline = std::chrono::steady_clock::now() + EVENT_TIMEOUT;
+        while(handled_events < count) {
+            if(std::chrono::steady_clock::now() > deadline) {
+                return false;
+            }
+
+            const auto result = watcher.handle_event_queue([&](const erebos::platform::FileEvent&) -> erebos::Result<void> {
+                handled_events++;
+                return {};
+            });
+            if(result.is_error()) {
+                return false;
+            }
+        }
+        return true;
+    }
+}// namespace
+
+// Measures the latency from writing the files to handling all of their events in the main thread, every file emits
+// a create and a write event
+static void bench_file_watcher_event_throughput(benchmark::State& state) {
+    const auto file_count = static_cast<erebos::usize>(state.range(0));
+    const auto base_path = std::filesystem::temp_directory_path() / "erebos-bench-file-watcher";
+    std::filesystem::remove_all(base_path);
+
+    const auto directory_path = base_path / "assets";
+    std::filesystem::create_directories(directory_path);
+
+    auto watcher = erebos::platform::FileWatcher {base_path};
+    for([[maybe_unused]] auto _ : state) {
+        for(erebos::usize i = 0; i < file_count; i++) {
+            std::ofstream {directory_path / fmt::format("file-{}.txt", i)} << i;
+        }
+
+        if(!wait_for_events(watcher, file_count * 2)) {
+            state.SkipWithError("Timeout while waiting for file events");
+            break;
+        }
+
+        // Remove the files outside of the measurement and drain their delete events
+        state.PauseTiming();
+        for(erebos::usize i = 0; i < file_count; i++) {
+            std::filesystem::remove(directory_path / fmt::format("file-{}.txt", i));
+        }
+        const auto is_drained = wait_for_events(watcher, file_count);
+        state.ResumeTiming();
+        if(!is_drained) {
+            state.SkipWithError("Timeout while waiting for delete events");
+            break;
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * file_count * 2));
+    std::filesystem::remove_all(base_path);
+}
+BENCHMARK(bench_file_watcher_event_throughput)->Arg(16)->Arg(256)->Unit(benchmark::kMillisecond)->UseRealTime();
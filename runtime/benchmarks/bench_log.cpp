@@ -0,0 +1,83 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <erebos/log.hpp>
+#include <spdlog/sinks/null_sink.h>
+#include <string>
+
+namespace {
+    // The null sink still takes its mutex, so the synchronous logger pays the formatting and the lock on every call
+    [[nodiscard]] auto make_null_logger() -> std::shared_ptr<spdlog::logger> {
+        auto logger = std::make_shared<spdlog::logger>("null", std::make_shared<spdlog::sinks::null_sink_mt>());
+        logger->set_level(spdlog::level::trace);
+        return logger;
+    }
+}// namespace
+
+static void bench_log_spdlog(benchmark::State& state) {
+    const auto previous_logger = spdlog::default_logger();
+    if(state.thread_index() == 0) {
+        spdlog::set_default_logger(make_null_logger());
+    }
+    const std::string path {"assets/shaders/fullscreen.hlsl"};
+    for([[maybe_unused]] auto _ : state) {
+        SPDLOG_LOGGER_CALL(spdlog::default_logger_raw(), spdlog::level::info, "Received {} file event about '{}' ({})", "modify", path, 42);
+    }
+    if(state.thread_index() == 0) {
+        spdlog::set_default_logger(previous_logger);
+    }
+}
+BENCHMARK(bench_log_spdlog)->Threads(1)->Threads(4);
+
+static void bench_log_async(benchmark::State& state) {
+    const auto previous_logger = spdlog::default_logger();
+    if(state.thread_index() == 0) {
+        spdlog::set_default_logger(make_null_logger());
+    }
+    const std::string path {"assets/shaders/fullscreen.hlsl"};
+    erebos::usize record_count = 0;
+    for([[maybe_unused]] auto _ : state) {
+        EREBOS_LOG_CALL(spdlog::level::info, "Received {} file event about '{}' ({})", "modify", path, 42);
+
+        // The backend can't keep up with a tight loop, so the queue is drained outside of the measured time
+        if((++record_count & 255U) == 0) {
+            state.PauseTiming();
+            erebos::log::flush();
+            state.ResumeTiming();
+        }
+    }
+    erebos::log::flush();
+    if(state.thread_index() == 0) {
+        spdlog::set_default_logger(previous_logger);
+    }
+}
+BENCHMARK(bench_log_async)->Threads(1)->Threads(4);
+
+static void bench_log_filtered(benchmark::State& state) {
+    const auto previous_logger = spdlog::default_logger();
+    spdlog::set_default_logger(make_null_logger());
+    spdlog::default_logger_raw()->set_level(spdlog::level::info);
+    const std::string path {"assets/shaders/fullscreen.hlsl"};
+    for([[maybe_unused]] auto _ : state) {
+        EREBOS_LOG_CALL(spdlog::level::trace, "Received {} file event about '{}' ({})", "modify", path, 42);
+    }
+    spdlog::set_default_logger(previous_logger);
+}
+BENCHMARK(bench_log_filtered);
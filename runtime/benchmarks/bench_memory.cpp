@@ -0,0 +1,111 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <erebos/memory/linear_arena.hpp>
+#include <erebos/memory/pool_allocator.hpp>
+#include <string>
+#include <vector>
+
+namespace {
+    struct Barrier final {
+        erebos::u32 source_stage;
+        erebos::u32 destination_stage;
+        erebos::u64 resource;
+    };
+
+    // Simulates the temporaries of a typical frame: a few command lists, barrier arrays and formatted strings
+    template<template<typename> typename TVector, typename TString, typename... TArgs>
+    auto run_frame_workload(TArgs&&... args) -> erebos::usize {
+        erebos::usize checksum = 0;
+        for(auto pass = 0; pass < 32; pass++) {
+            TVector<Barrier> barriers {args...};
+            for(erebos::u32 i = 0; i < 24; i++) {
+                barriers.push_back({i, i + 1, static_cast<erebos::u64>(pass)});
+            }
+
+            TVector<erebos::u64> command_list {args...};
+            for(erebos::u32 i = 0; i < 128; i++) {
+                command_list.push_back(i * pass);
+            }
+
+            TString name {args...};
+            name.append("render pass #");
+            name.append(std::to_string(pass));
+            name.append(" (color + depth attachments, dynamic rendering)");
+            checksum += barriers.size() + command_list.size() + name.size();
+        }
+        return checksum;
+    }
+
+    template<typename T>
+    using StdVector = std::vector<T>;
+
+    template<typename T>
+    using PmrVector = std::pmr::vector<T>;
+}// namespace
+
+static void bench_frame_workload_global_allocator(benchmark::State& state) {
+    for([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(run_frame_workload<StdVector, std::string>());
+    }
+}
+BENCHMARK(bench_frame_workload_global_allocator);
+
+static void bench_frame_workload_frame_arena(benchmark::State& state) {
+    auto& arena = erebos::memory::get_frame_arena();
+    erebos::usize bytes_per_frame = 0;
+    for([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(run_frame_workload<PmrVector, std::pmr::string>(&arena));
+        bytes_per_frame = std::max(bytes_per_frame, arena.get_statistics().peak_bytes);
+        arena.reset();
+    }
+    state.counters["bytes_per_frame"] = static_cast<double>(bytes_per_frame);
+}
+BENCHMARK(bench_frame_workload_frame_arena);
+
+static void bench_small_allocations_global_allocator(benchmark::State& state) {
+    std::vector<void*> pointers(256);
+    for([[maybe_unused]] auto _ : state) {
+        for(auto& pointer : pointers) {
+            pointer = ::operator new(64);
+        }
+        for(auto* pointer : pointers) {
+            ::operator delete(pointer);
+        }
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(bench_small_allocations_global_allocator);
+
+static void bench_small_allocations_pool_allocator(benchmark::State& state) {
+    erebos::memory::PoolAllocator pool {64};
+    std::vector<void*> pointers(256);
+    for([[maybe_unused]] auto _ : state) {
+        for(auto& pointer : pointers) {
+            pointer = pool.allocate(64);
+        }
+        for(auto* pointer : pointers) {
+            pool.deallocate(pointer, 64);
+        }
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(bench_small_allocations_pool_allocator);
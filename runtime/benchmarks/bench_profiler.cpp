@@ -0,0 +1,70 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <erebos/profiler.hpp>
+
+static void bench_profile_scope_idle(benchmark::State& state) {
+    for([[maybe_unused]] auto _ : state) {
+        const erebos::profiler::ProfileScope scope {"idle_zone"};
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(bench_profile_scope_idle);
+
+namespace {
+    constexpr erebos::usize ZONE_COUNT = 4096;
+}// namespace
+
+// Every iteration records less zones than the ring buffer holds and the capture is restarted outside of the measurement,
+// so no zone is dropped and the time per zone includes the full push into the ring buffer
+static void bench_profile_scope_capturing(benchmark::State& state) {
+    const auto path = std::filesystem::temp_directory_path() / "erebos-bench-profiler.json";
+    for([[maybe_unused]] auto _ : state) {
+        state.PauseTiming();
+        if(const auto result = erebos::profiler::start_capture(path); result.is_error()) {
+            state.SkipWithError(result.get_error().c_str());
+            break;
+        }
+        state.ResumeTiming();
+
+        for(erebos::usize i = 0; i < ZONE_COUNT; i++) {
+            const erebos::profiler::ProfileScope scope {"capturing_zone"};
+            benchmark::ClobberMemory();
+        }
+
+        state.PauseTiming();
+        if(erebos::profiler::stop_capture() != 0) {
+            state.SkipWithError("Zones were dropped");
+            break;
+        }
+        state.ResumeTiming();
+    }
+    state.counters["time_per_zone"] = benchmark::Counter(ZONE_COUNT,
+                                                         benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+    std::filesystem::remove(path);
+}
+BENCHMARK(bench_profile_scope_capturing);
+
+static void bench_get_ticks(benchmark::State& state) {
+    for([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(erebos::profiler::get_ticks());
+    }
+}
+BENCHMARK(bench_get_ticks);
@@ -0,0 +1,142 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <erebos/result.hpp>
+
+namespace {
+    constexpr erebos::usize CALL_COUNT = 1024;
+
+    // The functions are not inlined, so the result is returned through the calling convention like in the hot paths
+    [[gnu::noinline]] auto check_string_error(const VkResult vk_result) noexcept -> erebos::Result<void> {
+        if(vk_result != VK_SUCCESS) {
+            return erebos::Error(fmt::format("Unable to begin command buffer: {}", erebos::vk_strerror(vk_result)));
+        }
+        return {};
+    }
+
+    [[gnu::noinline]] auto check_error_code(const VkResult vk_result) noexcept -> erebos::Result<void, erebos::ErrorCode> {
+        if(vk_result != VK_SUCCESS) {
+            return erebos::Error(erebos::ErrorCode {erebos::ErrorKind::BEGIN_COMMAND_BUFFER, vk_result});
+        }
+        return {};
+    }
+
+    [[gnu::noinline]] auto get_string_error(const erebos::u32 value) noexcept -> erebos::Result<erebos::u32> {
+        if(value == 0) {
+            return erebos::Error(std::string {"Value is zero"});
+        }
+        return value;
+    }
+
+    [[gnu::noinline]] auto get_error_code(const erebos::u32 value) noexcept -> erebos::Result<erebos::u32, erebos::ErrorCode> {
+        if(value == 0) {
+            return erebos::Error(erebos::ErrorCode {erebos::ErrorKind::UNKNOWN});
+        }
+        return value;
+    }
+
+    // Forwards the error of the innermost call through three layers, like begin_frame forwarding a fence error into the
+    // render callback of the window
+    [[gnu::noinline]] auto forward_copy_layer(const erebos::u32 depth, const VkResult vk_result) noexcept -> erebos::Result<void> {
+        if(depth == 0) {
+            return check_string_error(vk_result);
+        }
+
+        if(auto result = forward_copy_layer(depth - 1, vk_result); result.is_error()) {
+            return erebos::Error(result.get_error());
+        }
+        return {};
+    }
+
+    [[gnu::noinline]] auto forward_try_layer(const erebos::u32 depth, const VkResult vk_result) noexcept -> erebos::Result<void> {
+        if(depth == 0) {
+            return check_string_error(vk_result);
+        }
+
+        EREBOS_TRY(forward_try_layer(depth - 1, vk_result));
+        return {};
+    }
+
+    template<typename F>
+    auto run_void_calls(benchmark::State& state, F&& function, const erebos::usize result_size) -> void {
+        auto vk_result = VK_SUCCESS;
+        for([[maybe_unused]] auto _ : state) {
+            erebos::usize error_count = 0;
+            for(erebos::usize i = 0; i < CALL_COUNT; i++) {
+                benchmark::DoNotOptimize(vk_result);
+                error_count += function(vk_result).is_error() ? 1 : 0;
+            }
+            benchmark::DoNotOptimize(error_count);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * CALL_COUNT));
+        state.counters["result_size"] = static_cast<double>(result_size);
+    }
+
+    template<typename F>
+    auto run_value_calls(benchmark::State& state, F&& function, const erebos::usize result_size) -> void {
+        for([[maybe_unused]] auto _ : state) {
+            erebos::u64 checksum = 0;
+            for(erebos::u32 i = 1; i <= CALL_COUNT; i++) {
+                if(auto result = function(i); result.is_ok()) {
+                    checksum += *result;
+                }
+            }
+            benchmark::DoNotOptimize(checksum);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * CALL_COUNT));
+        state.counters["result_size"] = static_cast<double>(result_size);
+    }
+}// namespace
+
+static void bench_result_void_string_error(benchmark::State& state) {
+    run_void_calls(state, check_string_error, sizeof(erebos::Result<void>));
+}
+BENCHMARK(bench_result_void_string_error);
+
+static void bench_result_void_error_code(benchmark::State& state) {
+    run_void_calls(state, check_error_code, sizeof(erebos::Result<void, erebos::ErrorCode>));
+}
+BENCHMARK(bench_result_void_error_code);
+
+static void bench_result_value_string_error(benchmark::State& state) {
+    run_value_calls(state, get_string_error, sizeof(erebos::Result<erebos::u32>));
+}
+BENCHMARK(bench_result_value_string_error);
+
+static void bench_result_value_error_code(benchmark::State& state) {
+    run_value_calls(state, get_error_code, sizeof(erebos::Result<erebos::u32, erebos::ErrorCode>));
+}
+BENCHMARK(bench_result_value_error_code);
+
+static void bench_result_forward_error_copy(benchmark::State& state) {
+    for([[maybe_unused]] auto _ : state) {
+        auto result = forward_copy_layer(3, VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(bench_result_forward_error_copy);
+
+static void bench_result_forward_error_try(benchmark::State& state) {
+    for([[maybe_unused]] auto _ : state) {
+        auto result = forward_try_layer(3, VK_ERROR_OUT_OF_DEVICE_MEMORY);
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(bench_result_forward_error_try);
@@ -0,0 +1,179 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <erebos/unicode.hpp>
+#include <string_view>
+
+namespace {
+    using namespace erebos::unicode::detail;
+
+    constexpr erebos::usize CORPUS_REPEAT_COUNT = 256;
+    constexpr erebos::usize MIXED_CORPUS_SIZE = 1024 * 1024;
+
+    // The conversion before the single-pass SIMD conversion: the output length is counted in a first pass and the
+    // input length is taken from the NUL terminator
+    template<typename CHAR_OUT, typename CHAR_IN>
+    auto convert_two_pass(const std::basic_string<CHAR_IN>& value) -> std::basic_string<CHAR_OUT> {
+        const auto* begin = value.c_str();
+        const auto* end = begin + std::char_traits<CHAR_IN>::length(begin);
+        erebos::usize count = 0;
+        for(const auto* current = begin; current != end;) {
+            auto code_point = UTFTraits<CHAR_IN>::decode(current, end);
+            if(code_point == illegal || code_point == incomplete) {
+                code_point = replacement;
+            }
+            count += UTFTraits<CHAR_OUT>::width(code_point);
+        }
+
+        std::basic_string<CHAR_OUT> result(count, ' ');
+        auto* out = result.data();
+        for(const auto* current = begin; current != end;) {
+            convert_code_point(current, end, out);
+        }
+        return result;
+    }
+
+    template<typename CHAR_OUT, typename CHAR_IN>
+    auto convert_single_pass_scalar(const std::basic_string<CHAR_IN>& value) -> std::basic_string<CHAR_OUT> {
+        std::basic_string<CHAR_OUT> result(get_max_converted_length<CHAR_OUT, CHAR_IN>(value.size()), CHAR_OUT {});
+        result.resize(convert_buffer_scalar(value.data(), value.size(), result.data()));
+        return result;
+    }
+
+    // Paths and identifiers are mostly ASCII, the mixed corpus has a non-ASCII character every few words
+    auto get_corpus(const bool is_mixed) -> std::string {
+        std::string corpus {};
+        for(erebos::usize i = 0; i < CORPUS_REPEAT_COUNT; ++i) {
+            corpus += is_mixed ? "assets/textures/größe_テクスチャ_🐺.png " : "assets/textures/terrain_albedo_01.png ";
+        }
+        return corpus;
+    }
+
+    auto to_wcs_two_pass(const std::string& value) -> std::wstring {
+        return convert_two_pass<wchar_t>(value);
+    }
+
+    auto to_wcs_scalar(const std::string& value) -> std::wstring {
+        return convert_single_pass_scalar<wchar_t>(value);
+    }
+
+    auto to_wcs_simd(const std::string& value) -> std::wstring {
+        return erebos::unicode::to_wcs(value);
+    }
+
+    auto to_mbs_two_pass(const std::wstring& value) -> std::string {
+        return convert_two_pass<char>(value);
+    }
+
+    auto to_mbs_scalar(const std::wstring& value) -> std::string {
+        return convert_single_pass_scalar<char>(value);
+    }
+
+    auto to_mbs_simd(const std::wstring& value) -> std::string {
+        return erebos::unicode::to_mbs(value);
+    }
+    // Text assets mix scripts, every script has a different ratio of one- to four-byte sequences
+    auto get_mixed_script_corpus() -> std::string {
+        constexpr std::string_view sentences[] = {
+            "The quick brown fox jumps over the lazy dog. ",
+            "Falsches Üben von Xylophonmusik quält jeden größeren Zwerg. ",
+            "Съешь же ещё этих мягких французских булок, да выпей чаю. ",
+            "Ξεσκεπάζω την ψυχοφθόρα βδελυγμία. ",
+            "いろはにほへと ちりぬるを わかよたれそ つねならむ ",
+            "我能吞下玻璃而不伤身体。",
+            "نص حكيم له سر قاطع وذو شأن عظيم مكتوب على ثوب أخضر ",
+            "🐺🦊🐻 ",
+        };
+
+        std::string corpus {};
+        while(corpus.size() < MIXED_CORPUS_SIZE) {
+            for(const auto sentence : sentences) {
+                corpus += sentence;
+            }
+        }
+        return corpus;
+    }
+
+    auto validate_utf8_scalar(const std::string& value) -> bool {
+        const auto* current = reinterpret_cast<const erebos::u8*>(value.data());
+        const auto* end = current + value.size();
+        while(current != end) {
+            const auto code_point = UTFTraits<erebos::u8>::decode(current, end);
+            if(code_point == illegal || code_point == incomplete) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    auto count_code_points_scalar(const std::string& value) -> erebos::usize {
+        erebos::usize count = 0;
+        for(const auto unit : value) {
+            count += static_cast<erebos::usize>(!UTFTraits<char>::is_trail(unit));
+        }
+        return count;
+    }
+
+    auto validate_utf8_simd(const std::string& value) -> bool {
+        return erebos::unicode::validate_utf8(value);
+    }
+
+    auto count_code_points_simd(const std::string& value) -> erebos::usize {
+        return erebos::unicode::count_code_points(value);
+    }
+}// namespace
+
+template<auto FUNCTION>
+static void bench_to_wcs(benchmark::State& state) {
+    const auto corpus = get_corpus(state.range(0) != 0);
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(FUNCTION(corpus));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * corpus.size()));
+}
+
+template<auto FUNCTION>
+static void bench_to_mbs(benchmark::State& state) {
+    const auto corpus = erebos::unicode::to_wcs(get_corpus(state.range(0) != 0));
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(FUNCTION(corpus));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * corpus.size() * sizeof(wchar_t)));
+}
+
+// The argument selects the ASCII (0) or mixed (1) corpus
+BENCHMARK(bench_to_wcs<to_wcs_two_pass>)->Arg(0)->Arg(1);
+BENCHMARK(bench_to_wcs<to_wcs_scalar>)->Arg(0)->Arg(1);
+BENCHMARK(bench_to_wcs<to_wcs_simd>)->Arg(0)->Arg(1);
+BENCHMARK(bench_to_mbs<to_mbs_two_pass>)->Arg(0)->Arg(1);
+BENCHMARK(bench_to_mbs<to_mbs_scalar>)->Arg(0)->Arg(1);
+BENCHMARK(bench_to_mbs<to_mbs_simd>)->Arg(0)->Arg(1);
+
+template<auto FUNCTION>
+static void bench_utf8_mixed_script(benchmark::State& state) {
+    const auto corpus = get_mixed_script_corpus();
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(FUNCTION(corpus));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * corpus.size()));
+}
+BENCHMARK(bench_utf8_mixed_script<validate_utf8_scalar>);
+BENCHMARK(bench_utf8_mixed_script<validate_utf8_simd>);
+BENCHMARK(bench_utf8_mixed_script<count_code_points_scalar>);
+BENCHMARK(bench_utf8_mixed_script<count_code_points_simd>);
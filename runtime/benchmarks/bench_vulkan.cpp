@@ -0,0 +1,100 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include <benchmark/benchmark.h>
+#include <erebos/render/vulkan/command.hpp>
+#include <erebos/render/vulkan/frame.hpp>
+#include <memory>
+
+namespace {
+    using namespace erebos::render::vulkan;
+
+    // The context and device are created once for all benchmarks, a headless context is used so the benchmarks run on
+    // drivers without presentation support like lavapipe in the CI
+    struct VulkanEnvironment final {
+        std::unique_ptr<VulkanContext> context;
+        std::optional<Device> device;
+        std::string error;
+    };
+
+    [[nodiscard]] auto get_environment() noexcept -> VulkanEnvironment& {
+        static auto environment = []() noexcept -> VulkanEnvironment {
+            VulkanEnvironment environment {};
+            try {
+                environment.context = std::make_unique<VulkanContext>();
+                environment.device = find_preferred_device(*environment.context);
+                if(!environment.device.has_value()) {
+                    environment.error = "No Vulkan device available";
+                }
+            }
+            catch(const std::exception& exception) {
+                environment.error = exception.what();
+            }
+            return environment;
+        }();
+        return environment;
+    }
+}// namespace
+
+static void bench_command_pool_allocate(benchmark::State& state) {
+    auto& environment = get_environment();
+    if(!environment.device.has_value()) {
+        state.SkipWithError(environment.error.c_str());
+        return;
+    }
+
+    const auto& device = *environment.device;
+    const auto count = static_cast<uint32_t>(state.range(0));
+    const auto command_pool = CommandPool {device, device.get_queues()[0].get_family_index()};
+    for([[maybe_unused]] auto _ : state) {
+        auto command_buffers = command_pool.allocate(count);
+        if(command_buffers.is_error()) {
+            state.SkipWithError(fmt::format("{}", command_buffers.get_error()).c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(command_buffers);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(bench_command_pool_allocate)->Arg(1)->Arg(16)->Arg(64);
+
+static void bench_frame_begin_frame(benchmark::State& state) {
+    auto& environment = get_environment();
+    if(!environment.device.has_value()) {
+        state.SkipWithError(environment.error.c_str());
+        return;
+    }
+
+    // The fence of the frame is created signaled and never reset without submission, so every begin doesn't block
+    auto frame = Frame {*environment.device};
+    for([[maybe_unused]] auto _ : state) {
+        for(auto& queue_frame : frame.get_queue_frames()) {
+            if(const auto result = queue_frame.acquire_command_buffer(); result.is_error()) {
+                state.SkipWithError(fmt::format("{}", result.get_error()).c_str());
+                return;
+            }
+        }
+
+        if(const auto result = frame.begin_frame(); result.is_error()) {
+            state.SkipWithError(fmt::format("{}", result.get_error()).c_str());
+            return;
+        }
+    }
+}
+BENCHMARK(bench_frame_begin_frame);
@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+#   Copyright 2024 Cach30verfl0w
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+
+"""
+Compares two JSON outputs of erebos-benchmarks and exits with a non-zero exit code if a benchmark of the current run is
+slower than the baseline by more than the threshold. If the benchmarks were run with repetitions, the medians are
+compared instead of the single iterations.
+
+@author Cedric Hammes
+@since  18/10/2026
+"""
+
+import argparse
+import json
+import sys
+
+TIME_UNIT_TO_NANOSECONDS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load_results(path: str) -> dict[str, float]:
+    with open(path, encoding="utf-8") as file:
+        benchmarks = json.load(file)["benchmarks"]
+
+    # Use the medians of the repetitions if available, they are more stable than the single runs
+    has_medians = any(benchmark.get("aggregate_name") == "median" for benchmark in benchmarks)
+    results = {}
+    for benchmark in benchmarks:
+        if benchmark.get("error_occurred", False):
+            continue
+        if has_medians and benchmark.get("aggregate_name") != "median":
+            continue
+        if not has_medians and benchmark.get("run_type", "iteration") != "iteration":
+            continue
+
+        name = benchmark.get("run_name", benchmark["name"])
+        unit = TIME_UNIT_TO_NANOSECONDS[benchmark.get("time_unit", "ns")]
+        results[name] = benchmark["real_time"] * unit
+    return results
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="Compare the results of two erebos-benchmarks runs")
+    parser.add_argument("baseline", help="The JSON output of the baseline run")
+    parser.add_argument("current", help="The JSON output of the current run")
+    parser.add_argument("--threshold", type=float, default=10.0, help="The allowed slowdown in percent (default: 10)")
+    arguments = parser.parse_args()
+
+    baseline = load_results(arguments.baseline)
+    current = load_results(arguments.current)
+    regressions = []
+    print(f"{'Benchmark':<64} {'Baseline':>14} {'Current':>14} {'Change':>9}")
+    for name, current_time in current.items():
+        baseline_time = baseline.get(name)
+        if baseline_time is None or baseline_time == 0.0:
+            print(f"{name:<64} {'-':>14} {current_time:>12.1f}ns {'new':>9}")
+            continue
+
+        change = (current_time - baseline_time) / baseline_time * 100.0
+        is_regression = change > arguments.threshold
+        marker = " <- regression" if is_regression else ""
+        print(f"{name:<64} {baseline_time:>12.1f}ns {current_time:>12.1f}ns {change:>+8.1f}%{marker}")
+        if is_regression:
+            regressions.append(name)
+
+    for name in baseline.keys() - current.keys():
+        print(f"{name:<64} missing in current run")
+
+    if regressions:
+        print(f"{len(regressions)} benchmark(s) regressed by more than {arguments.threshold}%", file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
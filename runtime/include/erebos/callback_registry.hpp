@@ -0,0 +1,156 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#pragma once
+#include "erebos/delegate.hpp"
+#include "erebos/result.hpp"
+#include <algorithm>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace erebos {
+    /**
+     * This class stores callbacks with a priority and an optional key (e.g. the SDL event type), which filters the
+     * dispatches the callback is called for. Callbacks without a key are called for every dispatch. The callbacks for
+     * a key are sorted by priority once and cached, so a dispatch only iterates over the callbacks which subscribed to
+     * the key. Callbacks with a higher priority are called first, callbacks with the same priority are called in the
+     * order they were added.
+     *
+     * @tparam TArgs The arguments passed to the callbacks, the user data pointer is passed as last argument
+     * @author       Cedric Hammes
+     * @since        18/10/2026
+     */
+    template<typename... TArgs>
+    class CallbackRegistry final {
+    public:
+        using CallbackFunction = Delegate<Result<void>(TArgs..., void*)>;
+        using ErrorHandlerFunction = void (*)(const std::string& error);
+
+    private:
+        struct Entry final {
+            CallbackFunction function;
+            void* data;
+            i32 priority;
+            std::optional<u32> key;
+        };
+
+        std::vector<Entry> _entries;
+        mutable std::vector<const Entry*> _unkeyed_dispatch_list;
+        mutable std::unordered_map<u32, std::vector<const Entry*>> _dispatch_lists;
+        mutable bool _is_unkeyed_dispatch_list_valid;
+
+    public:
+        CallbackRegistry() noexcept
+            : _entries {}
+            , _unkeyed_dispatch_list {}
+            , _dispatch_lists {}
+            , _is_unkeyed_dispatch_list_valid {false} {
+        }
+
+        ~CallbackRegistry() noexcept = default;
+        EREBOS_DELETE_COPY(CallbackRegistry);
+        EREBOS_DEFAULT_MOVE(CallbackRegistry);
+
+        /**
+         * This function adds the callback to the registry and invalidates the cached dispatch lists.
+         *
+         * @param function The callback to add
+         * @param data     The data passed to the callback
+         * @param priority The priority of the callback, higher priorities are called first
+         * @param key      The only key the callback is called for or nothing to call it for every key
+         * @author         Cedric Hammes
+         * @since          18/10/2026
+         */
+        auto add(CallbackFunction function, void* data, const i32 priority = 0, const std::optional<u32> key = {}) noexcept -> void {
+            _entries.push_back({std::move(function), data, priority, key});
+            _unkeyed_dispatch_list.clear();
+            _dispatch_lists.clear();
+            _is_unkeyed_dispatch_list_valid = false;
+        }
+
+        /**
+         * This function calls all callbacks, which subscribed to the specified key or to all keys. Errors of the
+         * callbacks are passed to the error handler and don't cancel the dispatch.
+         *
+         * @param key           The key of the dispatch
+         * @param error_handler The function called with the error of a failed callback
+         * @param args          The arguments passed to the callbacks
+         * @return              The count of failed callbacks
+         * @author              Cedric Hammes
+         * @since               18/10/2026
+         */
+        auto dispatch(const u32 key, const ErrorHandlerFunction error_handler, TArgs... args) const noexcept -> usize {
+            auto dispatch_list = _dispatch_lists.find(key);
+            if(dispatch_list == _dispatch_lists.end()) {
+                dispatch_list = _dispatch_lists.emplace(key, build_dispatch_list(key)).first;
+            }
+            return call(dispatch_list->second, error_handler, args...);
+        }
+
+        /**
+         * This function calls all callbacks without a key. Errors of the callbacks are passed to the error handler and
+         * don't cancel the dispatch.
+         *
+         * @param error_handler The function called with the error of a failed callback
+         * @param args          The arguments passed to the callbacks
+         * @return              The count of failed callbacks
+         * @author              Cedric Hammes
+         * @since               18/10/2026
+         */
+        auto dispatch_unkeyed(const ErrorHandlerFunction error_handler, TArgs... args) const noexcept -> usize {
+            if(!_is_unkeyed_dispatch_list_valid) {
+                _unkeyed_dispatch_list = build_dispatch_list(std::nullopt);
+                _is_unkeyed_dispatch_list_valid = true;
+            }
+            return call(_unkeyed_dispatch_list, error_handler, args...);
+        }
+
+        [[nodiscard]] inline auto get_size() const noexcept -> usize {
+            return _entries.size();
+        }
+
+    private:
+        [[nodiscard]] auto build_dispatch_list(const std::optional<u32> key) const noexcept -> std::vector<const Entry*> {
+            std::vector<const Entry*> dispatch_list {};
+            for(const auto& entry : _entries) {
+                if(!entry.key.has_value() || entry.key == key) {
+                    dispatch_list.push_back(&entry);
+                }
+            }
+
+            std::stable_sort(dispatch_list.begin(), dispatch_list.end(), [](const Entry* left, const Entry* right) {
+                return left->priority > right->priority;
+            });
+            return dispatch_list;
+        }
+
+        static auto call(const std::vector<const Entry*>& dispatch_list, const ErrorHandlerFunction error_handler, TArgs&... args) noexcept
+            -> usize {
+            usize error_count = 0;
+            for(const auto* entry : dispatch_list) {
+                if(auto result = entry->function(args..., entry->data); result.is_error()) {
+                    error_handler(result.get_error());
+                    error_count++;
+                }
+            }
+            return error_count;
+        }
+    };
+}// namespace erebos
@@ -0,0 +1,174 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#pragma once
+#include "erebos/utils.hpp"
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace erebos {
+    template<typename TSignature>
+    class Delegate;
+
+    /**
+     * This class is a move-only callable wrapper. Unlike std::function, the call is a single indirect call through a
+     * function pointer. Function pointers and small callables (e.g. lambdas with a few captures) are stored inline, larger
+     * callables are allocated once when the delegate is created. Trivially copyable callables are moved without an
+     * indirect call and need no destructor.
+     *
+     * @tparam TReturn The return type of the callable
+     * @tparam TArgs   The argument types of the callable
+     * @author         Cedric Hammes
+     * @since          18/10/2026
+     */
+    template<typename TReturn, typename... TArgs>
+    class Delegate<TReturn(TArgs...)> final {
+    public:
+        static constexpr usize INLINE_SIZE = 4 * sizeof(void*);
+
+    private:
+        using InvokeFunction = TReturn (*)(void* storage, TArgs... args);
+        using ManageFunction = void (*)(void* destination, void* source) noexcept;
+
+        template<typename F>
+        static constexpr bool is_stored_inline = sizeof(F) <= INLINE_SIZE && alignof(F) <= alignof(std::max_align_t) &&
+                                                 std::is_nothrow_move_constructible_v<F>;
+
+        alignas(std::max_align_t) std::byte _storage[INLINE_SIZE];
+        InvokeFunction _invoke_function;
+        ManageFunction _manage_function;
+
+    public:
+        Delegate() noexcept
+            : _storage {}
+            , _invoke_function {nullptr}
+            , _manage_function {nullptr} {
+        }
+
+        /**
+         * This constructor wraps the specified callable. The callable is stored inline if it fits into the inline
+         * storage, otherwise it's moved to the heap.
+         *
+         * @param function The callable to wrap
+         * @author         Cedric Hammes
+         * @since          18/10/2026
+         */
+        template<typename F>
+            requires(!std::is_same_v<std::remove_cvref_t<F>, Delegate> && std::is_invocable_r_v<TReturn, std::decay_t<F>&, TArgs...>)
+        Delegate(F&& function)// NOLINT(google-explicit-constructor)
+            : _storage {} {
+            using TFunction = std::decay_t<F>;
+            if constexpr(is_stored_inline<TFunction>) {
+                ::new(static_cast<void*>(_storage)) TFunction(std::forward<F>(function));
+                _invoke_function = [](void* storage, TArgs... args) -> TReturn {
+                    return (*std::launder(static_cast<TFunction*>(storage)))(std::forward<TArgs>(args)...);
+                };
+
+                if constexpr(std::is_trivially_copyable_v<TFunction>) {
+                    _manage_function = nullptr;
+                }
+                else {
+                    _manage_function = [](void* destination, void* source) noexcept {
+                        auto* source_function = std::launder(static_cast<TFunction*>(source));
+                        if(destination != nullptr) {
+                            ::new(destination) TFunction(std::move(*source_function));
+                        }
+                        source_function->~TFunction();
+                    };
+                }
+            }
+            else {
+                auto* heap_function = new TFunction(std::forward<F>(function));
+                std::memcpy(_storage, static_cast<const void*>(&heap_function), sizeof(heap_function));
+                _invoke_function = [](void* storage, TArgs... args) -> TReturn {
+                    return (**static_cast<TFunction**>(storage))(std::forward<TArgs>(args)...);
+                };
+                _manage_function = [](void* destination, void* source) noexcept {
+                    if(destination != nullptr) {
+                        std::memcpy(destination, source, sizeof(TFunction*));
+                        return;
+                    }
+                    delete *static_cast<TFunction**>(source);
+                };
+            }
+        }
+
+        Delegate(Delegate&& other) noexcept
+            : _storage {}
+            , _invoke_function {other._invoke_function}
+            , _manage_function {other._manage_function} {
+            move_storage_from(other);
+        }
+
+        ~Delegate() noexcept {
+            reset();
+        }
+
+        EREBOS_DELETE_COPY(Delegate);
+
+        auto operator=(Delegate&& other) noexcept -> Delegate& {
+            if(this != &other) {
+                reset();
+                _invoke_function = other._invoke_function;
+                _manage_function = other._manage_function;
+                move_storage_from(other);
+            }
+            return *this;
+        }
+
+        /**
+         * This function destroys the wrapped callable, the delegate is empty afterwards.
+         *
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        auto reset() noexcept -> void {
+            if(_manage_function != nullptr) {
+                _manage_function(nullptr, _storage);
+            }
+            _invoke_function = nullptr;
+            _manage_function = nullptr;
+        }
+
+        inline auto operator()(TArgs... args) const -> TReturn {
+            return _invoke_function(const_cast<std::byte*>(_storage), std::forward<TArgs>(args)...);
+        }
+
+        [[nodiscard]] inline explicit operator bool() const noexcept {
+            return _invoke_function != nullptr;
+        }
+
+    private:
+        auto move_storage_from(Delegate& other) noexcept -> void {
+            if(_manage_function != nullptr) {
+                _manage_function(_storage, other._storage);
+            }
+            else {
+                std::memcpy(_storage, other._storage, INLINE_SIZE);
+            }
+
+            // The callable of the other delegate was moved or the ownership of the heap callable was transferred
+            other._invoke_function = nullptr;
+            other._manage_function = nullptr;
+        }
+    };
+}// namespace erebos
@@ -0,0 +1,149 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#pragma once
+#include "erebos/utils.hpp"
+#include <SDL2/SDL.h>
+#include <chrono>
+#include <optional>
+
+namespace erebos {
+    enum class WindowActivity : u8 {
+        FOCUSED,
+        UNFOCUSED,
+        MINIMIZED
+    };
+
+    /**
+     * This structure configures the frame rates of the frame scheduler. A frame rate of zero disables the frame cap, so
+     * the frames are rendered as fast as the render callbacks (or the present mode) allow. While the window is minimized,
+     * no frames are rendered unless a minimized frame rate is specified.
+     */
+    struct FrameSchedulerConfig final {
+        u32 target_frame_rate {0};
+        u32 unfocused_frame_rate {15};
+        std::optional<u32> minimized_frame_rate {};
+    };
+
+    /**
+     * This class schedules the frames of the window loop. The frame rate depends on the activity of the window, which
+     * is derived from the SDL window events. The time until the next frame is split into an idle part, in which the loop
+     * blocks on events, and a precise part at the end, which is waited with a sleep/spin hybrid. The precise part adapts
+     * to the measured oversleeping of the system's sleep.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    class FrameScheduler final {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        static constexpr std::chrono::microseconds SPIN_THRESHOLD {200};
+        static constexpr std::chrono::milliseconds MAX_IDLE_TIMEOUT {250};
+
+    private:
+        FrameSchedulerConfig _config;
+        bool _is_focused;
+        bool _is_minimized;
+        Clock::time_point _next_frame_time;
+        Clock::duration _sleep_overshoot;
+
+    public:
+        /**
+         * This constructor creates a frame scheduler for a focused window, which schedules the first frame immediately.
+         *
+         * @param config The frame rates of the scheduler
+         * @author       Cedric Hammes
+         * @since        18/10/2026
+         */
+        explicit FrameScheduler(FrameSchedulerConfig config = {}) noexcept;
+        ~FrameScheduler() noexcept = default;
+        EREBOS_DEFAULT_MOVE_COPY(FrameScheduler);
+
+        /**
+         * This function updates the activity of the window, if the specified event is a focus, minimize or restore
+         * event of the window.
+         *
+         * @param event The event to handle
+         * @author      Cedric Hammes
+         * @since       18/10/2026
+         */
+        auto handle_event(const SDL_Event& event) noexcept -> void;
+
+        /**
+         * This function returns the interval between two frames for the current activity of the window.
+         *
+         * @return The frame interval, zero if the frame rate is uncapped or nothing if no frames are rendered
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        [[nodiscard]] auto get_frame_interval() const noexcept -> std::optional<Clock::duration>;
+
+        /**
+         * This function returns how long the loop can block on events before the next frame must be prepared. The
+         * precise wait at the end of the interval isn't included, so zero means that the loop must begin the next frame.
+         *
+         * @param now The current time
+         * @return    The timeout for the event wait in milliseconds
+         * @author    Cedric Hammes
+         * @since     18/10/2026
+         */
+        [[nodiscard]] auto get_event_wait_timeout(Clock::time_point now) const noexcept -> std::chrono::milliseconds;
+
+        /**
+         * This function waits precisely until the next frame is due and schedules the frame after it. This should only
+         * be called when the event wait timeout is zero.
+         *
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        auto begin_frame() noexcept -> void;
+
+        /**
+         * This function schedules the next frame one interval after the previous scheduled frame. If the loop fell
+         * behind the schedule, the next frame is scheduled relative to the current time instead, so missed frames are
+         * not rendered in a burst.
+         *
+         * @param now The time at which the current frame begins
+         * @author    Cedric Hammes
+         * @since     18/10/2026
+         */
+        auto schedule_next_frame(Clock::time_point now) noexcept -> void;
+
+        /**
+         * This function waits until the specified deadline. The system sleep is used until shortly before the deadline,
+         * the rest is spun. The oversleeping of each sleep is measured to adapt when the spinning starts.
+         *
+         * @param deadline The time to wait for
+         * @author         Cedric Hammes
+         * @since          18/10/2026
+         */
+        auto wait_until(Clock::time_point deadline) noexcept -> void;
+
+        [[nodiscard]] auto get_activity() const noexcept -> WindowActivity;
+
+        [[nodiscard]] inline auto get_next_frame_time() const noexcept -> Clock::time_point {
+            return _next_frame_time;
+        }
+
+        [[nodiscard]] inline auto get_sleep_overshoot() const noexcept -> Clock::duration {
+            return _sleep_overshoot;
+        }
+    };
+}// namespace erebos
@@ -0,0 +1,249 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#pragma once
+#include "erebos/utils.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+// All log calls below this level are removed at compile-time, so their arguments are never evaluated
+#ifndef EREBOS_LOG_ACTIVE_LEVEL
+#ifdef BUILD_DEBUG
+#define EREBOS_LOG_ACTIVE_LEVEL SPDLOG_LEVEL_TRACE
+#else
+#define EREBOS_LOG_ACTIVE_LEVEL SPDLOG_ACTIVE_LEVEL
+#endif
+#endif
+
+#define EREBOS_LOG_CALL(level, ...) ::erebos::log::log(::spdlog::source_loc {__FILE__, __LINE__, SPDLOG_FUNCTION}, level, __VA_ARGS__)
+
+#if EREBOS_LOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_TRACE
+#define EREBOS_LOG_TRACE(...) EREBOS_LOG_CALL(::spdlog::level::trace, __VA_ARGS__)
+#else
+#define EREBOS_LOG_TRACE(...) (void) 0
+#endif
+
+#if EREBOS_LOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_DEBUG
+#define EREBOS_LOG_DEBUG(...) EREBOS_LOG_CALL(::spdlog::level::debug, __VA_ARGS__)
+#else
+#define EREBOS_LOG_DEBUG(...) (void) 0
+#endif
+
+#if EREBOS_LOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_INFO
+#define EREBOS_LOG_INFO(...) EREBOS_LOG_CALL(::spdlog::level::info, __VA_ARGS__)
+#else
+#define EREBOS_LOG_INFO(...) (void) 0
+#endif
+
+#if EREBOS_LOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_WARN
+#define EREBOS_LOG_WARN(...) EREBOS_LOG_CALL(::spdlog::level::warn, __VA_ARGS__)
+#else
+#define EREBOS_LOG_WARN(...) (void) 0
+#endif
+
+#if EREBOS_LOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_ERROR
+#define EREBOS_LOG_ERROR(...) EREBOS_LOG_CALL(::spdlog::level::err, __VA_ARGS__)
+#else
+#define EREBOS_LOG_ERROR(...) (void) 0
+#endif
+
+#if EREBOS_LOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_CRITICAL
+#define EREBOS_LOG_CRITICAL(...) EREBOS_LOG_CALL(::spdlog::level::critical, __VA_ARGS__)
+#else
+#define EREBOS_LOG_CRITICAL(...) (void) 0
+#endif
+
+namespace erebos::log {
+    constexpr usize LOG_RECORD_PAYLOAD_SIZE = 952;
+
+    /**
+     * A log record, which is passed to the backend thread. The record only stores the pointer of the format string
+     * and the encoded arguments, the formatting is done by the format function on the backend thread. If the strings
+     * of the arguments don't fit into the payload, the message is formatted on the calling thread instead and the
+     * record owns the formatted message, which is released by the backend thread.
+     */
+    struct LogRecord final {
+        using FormatFunction = void (*)(fmt::memory_buffer& buffer, std::string_view format, const u8* payload);
+
+        FormatFunction format_function;
+        const char* format_data;
+        usize format_size;
+        spdlog::source_loc location;
+        spdlog::level::level_enum level;
+        spdlog::log_clock::time_point time;
+        std::string* message;
+        std::array<u8, LOG_RECORD_PAYLOAD_SIZE> payload;
+    };
+
+    namespace detail {
+        // Strings are copied into the record, because the backend formats them after the caller released them
+        struct StoredString final {};
+
+        // All other arguments than strings, arithmetic values, enums and pointers are formatted on the calling thread.
+        // Other trivially copyable types may be views (e.g. std::span or the result of fmt::join), which reference data
+        // released before the backend formats the record.
+        struct StoredFormattedString final {};
+
+        template<typename T>
+        constexpr bool IS_STORED_BY_VALUE = std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>;
+
+        template<typename T>
+        using StoredType = std::conditional_t<std::is_convertible_v<const T&, std::string_view>,
+                                              StoredString,
+                                              std::conditional_t<IS_STORED_BY_VALUE<T>, T, StoredFormattedString>>;
+
+        template<typename T>
+        using DecodedType = std::conditional_t<std::is_empty_v<T>, std::string_view, T>;
+
+        template<typename T>
+        constexpr usize FIXED_SIZE = std::is_empty_v<T> ? sizeof(u32) : sizeof(T);
+
+        // The length is written first, strings exceeding the remaining bytes of the payload are marked as overflowed
+        inline auto encode_string(u8*& cursor, usize& string_budget, bool& is_overflowed, const std::string_view value) noexcept
+                -> void {
+            if(is_overflowed || value.size() > string_budget) [[unlikely]] {
+                is_overflowed = true;
+                return;
+            }
+
+            const auto length = static_cast<u32>(value.size());
+            std::memcpy(cursor, &length, sizeof(u32));
+            std::memcpy(cursor + sizeof(u32), value.data(), length);
+            cursor += sizeof(u32) + length;
+            string_budget -= length;
+        }
+
+        // Views like the result of fmt::join can only be formatted as rvalue, so the arguments are forwarded
+        template<typename TStored, typename T>
+        auto encode(u8*& cursor, usize& string_budget, bool& is_overflowed, T&& value) noexcept -> void {
+            if constexpr(std::is_same_v<TStored, StoredString>) {
+                encode_string(cursor, string_budget, is_overflowed, std::string_view {value});
+            }
+            else if constexpr(std::is_same_v<TStored, StoredFormattedString>) {
+                encode_string(cursor, string_budget, is_overflowed, fmt::format("{}", std::forward<T>(value)));
+            }
+            else {
+                std::memcpy(cursor, &value, sizeof(TStored));
+                cursor += sizeof(TStored);
+            }
+        }
+
+        template<typename TStored>
+        [[nodiscard]] auto decode(const u8*& cursor) noexcept -> DecodedType<TStored> {
+            if constexpr(std::is_empty_v<TStored>) {
+                u32 length = 0;
+                std::memcpy(&length, cursor, sizeof(u32));
+                const std::string_view value {reinterpret_cast<const char*>(cursor + sizeof(u32)), length};
+                cursor += sizeof(u32) + length;
+                return value;
+            }
+            else {
+                TStored value;
+                std::memcpy(&value, cursor, sizeof(TStored));
+                cursor += sizeof(TStored);
+                return value;
+            }
+        }
+
+        template<typename... TStored>
+        auto format_record(fmt::memory_buffer& buffer, const std::string_view format, const u8* payload) -> void {
+            // The braced initialization decodes the arguments from left to right
+            [[maybe_unused]] const u8* cursor = payload;
+            std::tuple<DecodedType<TStored>...> values {decode<TStored>(cursor)...};
+            std::apply(
+                    [&](auto&... value) {
+                        fmt::vformat_to(std::back_inserter(buffer), format, fmt::make_format_args(value...));
+                    },
+                    values);
+        }
+
+        auto push_record(const LogRecord& record) noexcept -> void;
+    }// namespace detail
+
+    /**
+     * This function encodes the arguments into a log record and pushes it into the queue of the backend thread, which
+     * formats the record and passes it to the default spdlog logger. The calling thread never formats the message or
+     * takes the lock of a sink. Strings, arithmetic values, enums and pointers are copied into the record, other
+     * arguments are formatted on the calling thread. If the strings don't fit into the record, the whole message is
+     * formatted on the calling thread. If the queue is full, the record is dropped and counted.
+     *
+     * @tparam TArgs    The types of the arguments
+     * @param location  The source location of the log call
+     * @param level     The level of the log message
+     * @param format    The format string, must live until the record was formatted (e.g. a string literal)
+     * @param args      The arguments of the log message
+     * @author          Cedric Hammes
+     * @since           18/10/2026
+     */
+    template<typename... TArgs>
+    auto log(const spdlog::source_loc location, const spdlog::level::level_enum level, fmt::format_string<TArgs...> format, TArgs&&... args) noexcept
+            -> void {
+        using namespace detail;
+        constexpr usize fixed_size = (FIXED_SIZE<StoredType<std::remove_cvref_t<TArgs>>> + ... + 0);
+        static_assert(fixed_size <= LOG_RECORD_PAYLOAD_SIZE, "Arguments of log message are too large for the log record");
+        if(!spdlog::default_logger_raw()->should_log(level)) {
+            return;
+        }
+
+        LogRecord record;
+        const fmt::string_view format_view = format;
+        record.format_function = &format_record<StoredType<std::remove_cvref_t<TArgs>>...>;
+        record.format_data = format_view.data();
+        record.format_size = format_view.size();
+        record.location = location;
+        record.level = level;
+        record.time = spdlog::log_clock::now();
+        record.message = nullptr;
+
+        [[maybe_unused]] auto* cursor = record.payload.data();
+        [[maybe_unused]] auto string_budget = LOG_RECORD_PAYLOAD_SIZE - fixed_size;
+        [[maybe_unused]] bool is_overflowed = false;
+        (encode<StoredType<std::remove_cvref_t<TArgs>>>(cursor, string_budget, is_overflowed, std::forward<TArgs>(args)), ...);
+        if(is_overflowed) [[unlikely]] {
+            record.message = new std::string {fmt::vformat(format_view, fmt::make_format_args(args...))};
+        }
+        detail::push_record(record);
+    }
+
+    /**
+     * This function blocks until all log records, which were pushed before the call, are passed to the logger and
+     * flushes the default logger.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    auto flush() noexcept -> void;
+
+    /**
+     * This function returns the count of log records, which were dropped because the queue of the backend thread was
+     * full.
+     *
+     * @return The count of dropped log records
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    [[nodiscard]] auto get_dropped_record_count() noexcept -> usize;
+}// namespace erebos::log
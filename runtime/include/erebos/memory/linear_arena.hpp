@@ -0,0 +1,171 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#pragma once
+#include "erebos/utils.hpp"
+#include <memory_resource>
+
+namespace erebos::memory {
+    struct AllocationStatistics final {
+        usize allocation_count;
+        usize allocated_bytes;
+        usize peak_bytes;
+        usize capacity;
+    };
+
+    /**
+     * This class is a linear (bump) allocator, which allocates memory chunks from the upstream resource and hands out
+     * memory by incrementing a pointer. Deallocations are ignored, the memory gets released by resetting or rewinding
+     * the arena. The chunks are kept after a reset, so the arena doesn't allocate anymore after it is warmed up. This
+     * class is not thread-safe.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    class LinearArena final : public std::pmr::memory_resource {
+        struct Chunk final {
+            Chunk* next;
+            usize size;
+        };
+
+        std::pmr::memory_resource* _upstream;
+        usize _chunk_size;
+        Chunk* _first_chunk;
+        Chunk* _current_chunk;
+        u8* _position;
+        u8* _end;
+        AllocationStatistics _statistics;
+
+    public:
+        struct Marker final {
+            Chunk* chunk;
+            u8* position;
+            usize allocated_bytes;
+        };
+
+        /**
+         * This constructor creates an empty arena. The first chunk gets allocated with the first allocation.
+         *
+         * @param chunk_size The minimum size of the chunks allocated from the upstream resource
+         * @param upstream   The resource to allocate the chunks from
+         * @author           Cedric Hammes
+         * @since            18/10/2026
+         */
+        explicit LinearArena(usize chunk_size = 1024 * 1024,
+                             std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) noexcept;
+        LinearArena(LinearArena&& other) noexcept;
+        ~LinearArena() noexcept override;
+        EREBOS_DELETE_COPY(LinearArena);
+        auto operator=(LinearArena&& other) noexcept -> LinearArena&;
+
+        /**
+         * This function releases all allocations of this arena at once. The chunks stay allocated and get reused by
+         * the following allocations. The allocation count and peak are reset too, so the statistics only cover the
+         * allocations since the last reset.
+         *
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        auto reset() noexcept -> void;
+
+        /**
+         * This function returns a marker of the current position in the arena, which can be passed to rewind to release
+         * all allocations done after this call.
+         *
+         * @return The marker of the current position
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        [[nodiscard]] inline auto get_marker() const noexcept -> Marker {
+            return {_current_chunk, _position, _statistics.allocated_bytes};
+        }
+
+        /**
+         * This function releases all allocations, which were done after the specified marker was acquired.
+         *
+         * @param marker The marker to rewind to
+         * @author       Cedric Hammes
+         * @since        18/10/2026
+         */
+        auto rewind(const Marker& marker) noexcept -> void;
+
+        [[nodiscard]] inline auto get_statistics() const noexcept -> const AllocationStatistics& {
+            return _statistics;
+        }
+
+    protected:
+        auto do_allocate(usize bytes, usize alignment) -> void* override;
+        auto do_deallocate(void* pointer, usize bytes, usize alignment) -> void override;
+        [[nodiscard]] auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override;
+
+    private:
+        auto release_chunks() noexcept -> void;
+    };
+
+    /**
+     * This class is a scoped view into a linear arena. All allocations done through this resource are released when
+     * the scope ends, so it can be used like a stack allocator for temporary containers. Scopes must be destroyed in
+     * the reverse order of their creation.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    class ScopedArena final : public std::pmr::memory_resource {
+        LinearArena* _arena;
+        LinearArena::Marker _marker;
+
+    public:
+        explicit ScopedArena(LinearArena& arena) noexcept
+            : _arena {&arena}
+            , _marker {arena.get_marker()} {
+        }
+
+        ~ScopedArena() noexcept override {
+            _arena->rewind(_marker);
+        }
+
+        ScopedArena(ScopedArena&& other) noexcept = delete;
+        EREBOS_DELETE_COPY(ScopedArena);
+
+    protected:
+        auto do_allocate(usize bytes, usize alignment) -> void* override {
+            return _arena->allocate(bytes, alignment);
+        }
+
+        auto do_deallocate([[maybe_unused]] void* pointer,
+                           [[maybe_unused]] usize bytes,
+                           [[maybe_unused]] usize alignment) -> void override {
+        }
+
+        [[nodiscard]] auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override {
+            return this == &other;
+        }
+    };
+
+    /**
+     * This function returns the per-frame arena of the calling thread. Memory allocated from this arena is valid until
+     * the frame arena of the thread gets reset, which happens in Frame::begin_frame for the render thread. Threads which
+     * never begin a frame should only use this arena through a ScopedArena.
+     *
+     * @return The frame arena of the calling thread
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    [[nodiscard]] auto get_frame_arena() noexcept -> LinearArena&;
+}// namespace erebos::memory
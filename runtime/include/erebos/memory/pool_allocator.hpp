@@ -0,0 +1,89 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#pragma once
+#include "erebos/memory/linear_arena.hpp"
+#include "erebos/utils.hpp"
+#include <memory_resource>
+
+namespace erebos::memory {
+    /**
+     * This class is a pool allocator of fixed-size blocks. Freed blocks are stored in an intrusive free list and get
+     * reused by the next allocation, the pages of the pool are only released with the pool itself. Allocations which
+     * don't fit into a block are forwarded to the upstream resource. This class is not thread-safe.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    class PoolAllocator final : public std::pmr::memory_resource {
+        struct FreeBlock final {
+            FreeBlock* next;
+        };
+
+        struct Page final {
+            Page* next;
+        };
+
+        std::pmr::memory_resource* _upstream;
+        usize _block_size;
+        usize _blocks_per_page;
+        FreeBlock* _free_list;
+        Page* _pages;
+        AllocationStatistics _statistics;
+
+    public:
+        /**
+         * This constructor creates an empty pool. The first page gets allocated with the first allocation.
+         *
+         * @param block_size      The size of a single block in the pool
+         * @param blocks_per_page The count of blocks allocated at once from the upstream resource
+         * @param upstream        The resource to allocate the pages and oversized allocations from
+         * @author                Cedric Hammes
+         * @since                 18/10/2026
+         */
+        explicit PoolAllocator(usize block_size,
+                               usize blocks_per_page = 256,
+                               std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) noexcept;
+        PoolAllocator(PoolAllocator&& other) noexcept;
+        ~PoolAllocator() noexcept override;
+        EREBOS_DELETE_COPY(PoolAllocator);
+        auto operator=(PoolAllocator&& other) noexcept -> PoolAllocator&;
+
+        [[nodiscard]] inline auto get_block_size() const noexcept -> usize {
+            return _block_size;
+        }
+
+        [[nodiscard]] inline auto get_statistics() const noexcept -> const AllocationStatistics& {
+            return _statistics;
+        }
+
+    protected:
+        auto do_allocate(usize bytes, usize alignment) -> void* override;
+        auto do_deallocate(void* pointer, usize bytes, usize alignment) -> void override;
+        [[nodiscard]] auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override;
+
+    private:
+        [[nodiscard]] inline auto fits_into_block(usize bytes, usize alignment) const noexcept -> bool {
+            return bytes <= _block_size && alignment <= alignof(std::max_align_t);
+        }
+
+        auto allocate_page() -> void;
+        auto release_pages() noexcept -> void;
+    };
+}// namespace erebos::memory
@@ -0,0 +1,135 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#pragma once
+#include "erebos/utils.hpp"
+#include <array>
+#include <vector>
+
+#ifdef EREBOS_ALLOCATION_TRACKING
+#define EREBOS_ALLOCATION_SCOPE_CONCAT_IMPL(a, b) a##b
+#define EREBOS_ALLOCATION_SCOPE_CONCAT(a, b) EREBOS_ALLOCATION_SCOPE_CONCAT_IMPL(a, b)
+#define EREBOS_ALLOCATION_SCOPE(tag) \
+    const ::erebos::memory::AllocationScope EREBOS_ALLOCATION_SCOPE_CONCAT(erebos_allocation_scope_, __LINE__) {tag}
+#else
+#define EREBOS_ALLOCATION_SCOPE(tag)
+#endif
+
+namespace erebos::memory {
+    /**
+     * The allocation counters of a thread or of a scope. The byte values are based on the usable size of the
+     * allocations, so they include the internal rounding of the allocator.
+     */
+    struct AllocationCounters final {
+        usize allocation_count;
+        usize deallocation_count;
+        usize allocated_bytes;
+        usize live_bytes;
+        usize peak_live_bytes;
+    };
+
+    struct AllocationSample final {
+        const char* tag;
+        usize size;
+        usize frame_count;
+        std::array<void*, 16> frames;
+    };
+
+    /**
+     * This class tags all allocations of the current thread, which are done while the scope is alive. Scopes can be
+     * nested, the innermost scope wins. When the allocation tracking is compiled out, this class is empty.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    class AllocationScope final {
+#ifdef EREBOS_ALLOCATION_TRACKING
+        const char* _previous_tag;
+        AllocationCounters _begin_counters;
+#endif
+
+    public:
+        explicit AllocationScope(const char* tag) noexcept;
+        ~AllocationScope() noexcept;
+        AllocationScope(AllocationScope&& other) noexcept = delete;
+        EREBOS_DELETE_COPY(AllocationScope);
+
+        /**
+         * This function returns the counters of all allocations done by this thread since the scope was created.
+         * The peak value is the peak of the thread while the scope was alive.
+         *
+         * @return The allocation counters of this scope
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        [[nodiscard]] auto get_counters() const noexcept -> AllocationCounters;
+    };
+
+    /**
+     * This function returns whether the allocation tracking is compiled into the runtime. All counter functions return
+     * empty counters if that's not the case.
+     *
+     * @return Whether the allocation tracking is enabled
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    [[nodiscard]] constexpr auto is_allocation_tracking_enabled() noexcept -> bool {
+#ifdef EREBOS_ALLOCATION_TRACKING
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    [[nodiscard]] auto get_thread_allocation_counters() noexcept -> AllocationCounters;
+    [[nodiscard]] auto get_global_allocation_counters() noexcept -> AllocationCounters;
+
+    /**
+     * This function sets the rate of the call-stack sampling. Every n-th allocation of a thread captures the call
+     * stack of the allocation into a global ring buffer of samples. A rate of zero disables the sampling.
+     *
+     * @param every_nth_allocation The sampling rate
+     * @author                     Cedric Hammes
+     * @since                      18/10/2026
+     */
+    auto set_allocation_sample_rate(usize every_nth_allocation) noexcept -> void;
+
+    /**
+     * This function returns a copy of the latest allocation samples.
+     *
+     * @return The captured allocation samples
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    [[nodiscard]] auto get_allocation_samples() -> std::vector<AllocationSample>;
+
+    /**
+     * This function logs the global allocation counters, the counters of all tags, the sampled call stacks and the
+     * statistics of mimalloc. This is intended to be called periodically, not in every frame.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    auto dump_allocation_statistics() noexcept -> void;
+
+    namespace detail {
+        auto on_allocate(void* pointer) noexcept -> void;
+        auto on_deallocate(void* pointer) noexcept -> void;
+    }// namespace detail
+}// namespace erebos::memory
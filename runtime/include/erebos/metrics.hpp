@@ -0,0 +1,253 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#pragma once
+#include "erebos/utils.hpp"
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+namespace erebos::metrics {
+    /**
+     * The metrics of a single frame. The memory values are snapshots taken at the end of the frame, the uploaded bytes
+     * are the bytes copied to the device during the frame.
+     */
+    struct FrameSample final {
+        u64 frame_index;
+        std::chrono::nanoseconds frame_time;
+        std::chrono::nanoseconds cpu_time;
+        std::chrono::nanoseconds gpu_time;
+        u32 command_buffer_count;
+        u32 submit_count;
+        usize frame_arena_bytes;
+        usize live_heap_bytes;
+        u64 device_memory_usage;
+        u64 device_memory_budget;
+        u64 uploaded_bytes;
+    };
+
+    /**
+     * The summary of a set of frames. All times are in milliseconds, the upload bandwidth is in bytes per second.
+     */
+    struct MetricsSummary final {
+        usize sample_count;
+        double frame_time_p50;
+        double frame_time_p95;
+        double frame_time_p99;
+        double average_cpu_time;
+        double average_gpu_time;
+        double average_command_buffer_count;
+        double average_submit_count;
+        double upload_bandwidth;
+    };
+
+    enum class MetricsFormat : u8 {
+        CSV,
+        JSON
+    };
+
+    namespace detail {
+        /**
+         * This class counts values in logarithmic buckets with 64 linear sub-buckets per power of two, so the
+         * percentiles of any count of values are computed in constant memory. A percentile is the middle of its bucket
+         * clamped into the range of the added values, so its relative error is below one percent.
+         *
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        class PercentileHistogram final {
+            std::vector<u64> _counts;
+            u64 _count;
+            int64_t _min;
+            int64_t _max;
+
+        public:
+            static constexpr u32 SUB_BUCKET_BITS = 6;
+            static constexpr usize SUB_BUCKET_COUNT = usize {1} << SUB_BUCKET_BITS;
+            // The values are below 2^63, so the highest bucket starts at 2^62 with its sub-buckets
+            static constexpr usize BUCKET_COUNT = (64 - SUB_BUCKET_BITS) * SUB_BUCKET_COUNT;
+
+            PercentileHistogram();
+
+            /**
+             * This function counts the value in its bucket. Negative values are counted as zero.
+             *
+             * @param value The value to count
+             * @author      Cedric Hammes
+             * @since       18/10/2026
+             */
+            auto add(int64_t value) noexcept -> void;
+
+            /**
+             * This function returns the percentile of the counted values with the nearest-rank method.
+             *
+             * @param percentile The percentile between 0 and 100
+             * @return           The value at the percentile or zero if no value was counted
+             * @author           Cedric Hammes
+             * @since            18/10/2026
+             */
+            [[nodiscard]] auto compute_percentile(double percentile) const noexcept -> int64_t;
+
+            [[nodiscard]] inline auto get_count() const noexcept -> u64 {
+                return _count;
+            }
+        };
+
+        // The sums of the samples, which are averaged into the summary
+        struct MetricsTotals final {
+            usize sample_count;
+            int64_t frame_time;
+            int64_t cpu_time;
+            int64_t gpu_time;
+            u64 command_buffer_count;
+            u64 submit_count;
+            u64 uploaded_bytes;
+
+            auto add(const FrameSample& sample) noexcept -> void;
+            [[nodiscard]] auto summarize(std::span<int64_t> frame_times) const noexcept -> MetricsSummary;
+            [[nodiscard]] auto summarize(const PercentileHistogram& frame_times) const noexcept -> MetricsSummary;
+        };
+    }// namespace detail
+
+    /**
+     * This function returns the percentile of the values with the nearest-rank method. The values are reordered.
+     *
+     * @param values     The values, must not be empty
+     * @param percentile The percentile between 0 and 100
+     * @return           The value at the percentile
+     * @author           Cedric Hammes
+     * @since            18/10/2026
+     */
+    [[nodiscard]] auto compute_percentile(std::span<int64_t> values, double percentile) noexcept -> int64_t;
+
+    /**
+     * This class keeps the samples of the last frames in a ring buffer and summarizes them, e.g. for an overlay. The
+     * summary only covers the frames in the window, so it follows changes of the load quickly.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    class FrameMetrics final {
+        std::vector<FrameSample> _samples;
+        usize _window_size;
+        usize _next_sample;
+        mutable std::vector<int64_t> _frame_times;
+
+    public:
+        static constexpr usize DEFAULT_WINDOW_SIZE = 512;
+
+        explicit FrameMetrics(usize window_size = DEFAULT_WINDOW_SIZE) noexcept;
+        ~FrameMetrics() noexcept = default;
+        EREBOS_DELETE_COPY(FrameMetrics);
+        EREBOS_DEFAULT_MOVE(FrameMetrics);
+
+        /**
+         * This function adds the sample into the window. If the window is full, the oldest sample is replaced.
+         *
+         * @param sample The sample of the last frame
+         * @author       Cedric Hammes
+         * @since        18/10/2026
+         */
+        auto add_sample(const FrameSample& sample) noexcept -> void;
+
+        /**
+         * This function summarizes the samples in the window.
+         *
+         * @return The summary of the window
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        [[nodiscard]] auto get_summary() const noexcept -> MetricsSummary;
+
+        /**
+         * This function returns the last added sample. The window must not be empty.
+         *
+         * @return The last sample
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        [[nodiscard]] auto get_last_sample() const noexcept -> const FrameSample&;
+
+        [[nodiscard]] inline auto get_sample_count() const noexcept -> usize {
+            return _samples.size();
+        }
+    };
+
+    /**
+     * This class streams the samples into a CSV or JSON file, so the memory usage doesn't grow with the length of the
+     * run. The JSON file contains the samples and the summary of all written samples, the CSV file only contains the
+     * samples. The frame time percentiles of the summary are computed from a histogram of fixed size.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    class MetricsWriter final {
+        std::FILE* _file;
+        MetricsFormat _format;
+        detail::PercentileHistogram _frame_times;
+        detail::MetricsTotals _totals;
+
+    public:
+        /**
+         * This constructor opens the file and writes the header. Files with the extension .json are written as JSON,
+         * all other files as CSV.
+         *
+         * @param path The path of the metrics file
+         * @author     Cedric Hammes
+         * @since      18/10/2026
+         */
+        explicit MetricsWriter(const std::filesystem::path& path);
+        MetricsWriter(MetricsWriter&& other) noexcept;
+
+        /**
+         * This destructor writes the footer of the file and closes it.
+         *
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        ~MetricsWriter() noexcept;
+        EREBOS_DELETE_COPY(MetricsWriter);
+
+        /**
+         * This function appends the sample to the file.
+         *
+         * @param sample The sample to write
+         * @author       Cedric Hammes
+         * @since        18/10/2026
+         */
+        auto write_sample(const FrameSample& sample) noexcept -> void;
+
+        /**
+         * This function returns the summary of all written samples.
+         *
+         * @return The summary of the written samples
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        [[nodiscard]] auto get_summary() noexcept -> MetricsSummary;
+
+        [[nodiscard]] inline auto get_format() const noexcept -> MetricsFormat {
+            return _format;
+        }
+
+        auto operator=(MetricsWriter&& other) noexcept -> MetricsWriter&;
+    };
+}// namespace erebos::metrics
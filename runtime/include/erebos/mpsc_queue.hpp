@@ -0,0 +1,123 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#pragma once
+#include "erebos/spsc_queue.hpp"
+#include "erebos/utils.hpp"
+#include <array>
+#include <atomic>
+#include <optional>
+#include <type_traits>
+
+namespace erebos {
+    /**
+     * This class is a bounded lock-free queue for any count of producer threads and exactly one consumer thread. Every
+     * slot has a sequence number, which tells the producers whether the slot is free and the consumer whether the value
+     * in the slot was published. The producers only share the tail, so pushing a value is a single compare-and-swap
+     * when there is no contention.
+     *
+     * @tparam T        The type of the values, must be nothrow copy-assignable
+     * @tparam CAPACITY The count of slots in the queue, must be a power of two
+     * @author          Cedric Hammes
+     * @since           18/10/2026
+     */
+    template<typename T, usize CAPACITY>
+        requires((CAPACITY & (CAPACITY - 1)) == 0 && CAPACITY > 1 && std::is_nothrow_copy_assignable_v<T>)
+    class MPSCQueue final {
+        static constexpr usize INDEX_MASK = CAPACITY - 1;
+
+        struct Slot final {
+            std::atomic<usize> sequence;
+            T value;
+        };
+
+        alignas(CACHE_LINE_SIZE) std::atomic<usize> _tail;
+        alignas(CACHE_LINE_SIZE) usize _head;
+        alignas(CACHE_LINE_SIZE) std::array<Slot, CAPACITY> _slots;
+
+    public:
+        MPSCQueue() noexcept
+            : _tail {0}
+            , _head {0}
+            , _slots {} {
+            for(usize i = 0; i < CAPACITY; i++) {
+                _slots[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        MPSCQueue(MPSCQueue&& other) noexcept = delete;
+        EREBOS_DELETE_COPY(MPSCQueue);
+
+        /**
+         * This function pushes the value into the queue. This function can be called by any thread.
+         *
+         * @param value The value to push
+         * @return      Whether the value was pushed or the queue is full
+         * @author      Cedric Hammes
+         * @since       18/10/2026
+         */
+        [[nodiscard]] auto try_push(const T& value) noexcept -> bool {
+            auto tail = _tail.load(std::memory_order_relaxed);
+            while(true) {
+                auto& slot = _slots[tail & INDEX_MASK];
+                const auto sequence = slot.sequence.load(std::memory_order_acquire);
+                const auto difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(tail);
+                if(difference == 0) {
+                    // The slot is free, claim it by advancing the tail
+                    if(_tail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed)) {
+                        slot.value = value;
+                        slot.sequence.store(tail + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if(difference < 0) {
+                    // The slot wasn't consumed since the last round, so the queue is full
+                    return false;
+                }
+                else {
+                    tail = _tail.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * This function pops the oldest value from the queue. This function must only be called by the consumer thread.
+         * A value pushed by another thread is only visible when all values before it were published.
+         *
+         * @return The oldest value or nothing if the queue is empty
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        [[nodiscard]] auto try_pop() noexcept -> std::optional<T> {
+            auto& slot = _slots[_head & INDEX_MASK];
+            if(slot.sequence.load(std::memory_order_acquire) != _head + 1) {
+                return std::nullopt;
+            }
+
+            std::optional<T> value {slot.value};
+            slot.sequence.store(_head + CAPACITY, std::memory_order_release);
+            _head++;
+            return value;
+        }
+
+        [[nodiscard]] constexpr auto get_capacity() const noexcept -> usize {
+            return CAPACITY;
+        }
+    };
+}// namespace erebos
@@ -0,0 +1,51 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#pragma once
+#include "erebos/utils.hpp"
+
+// Enables an instruction set extension for a single function, so SIMD code paths can be compiled into the runtime
+// without raising the baseline of the whole build. MSVC allows the intrinsics without a flag.
+#if defined(ARCH_X86) && (defined(COMPILER_GCC) || defined(COMPILER_CLANG))
+#define EREBOS_TARGET_FEATURES(features) __attribute__((target(features)))
+#else
+#define EREBOS_TARGET_FEATURES(features)
+#endif
+
+namespace erebos::platform {
+    /**
+     * The instruction set extensions of the CPU, which are used by the SIMD code paths of the runtime. NEON is part
+     * of the ARM64 baseline and only reported on ARM64 builds.
+     */
+    struct CPUFeatures final {
+        bool has_sse4_1;
+        bool has_avx2;
+        bool has_neon;
+    };
+
+    /**
+     * This function detects the features of the CPU once and returns the cached features on subsequent calls. On x86,
+     * AVX2 is only reported if the operating system saves the AVX registers.
+     *
+     * @return The features of the CPU
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    [[nodiscard]] auto get_cpu_features() noexcept -> const CPUFeatures&;
+}// namespace erebos::platform
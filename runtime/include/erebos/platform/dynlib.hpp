@@ -52,7 +52,7 @@ namespace erebos::platform {
 
         /**
          * This function acquires the address of the specified function (by name) and casts that address into the
-         * specified function pointer.
+         * specified function pointer. Libraries with many symbols should be resolved in bulk with a SymbolTable.
          *
          * @tparam R    The function's return type
          * @tparam ARGS The function's argument types
@@ -62,7 +62,7 @@ namespace erebos::platform {
          * @since  06/05/2023
          */
         template<typename R, typename... ARGS>
-        [[nodiscard]] inline auto get_function(const std::string& name) noexcept -> erebos::Result<R (*)(ARGS...)> {
+        [[nodiscard]] inline auto get_function(const char* name) const noexcept -> erebos::Result<R (*)(ARGS...)> {
             auto address_result = get_function_address(name);
 
             if(!address_result) {
@@ -84,9 +84,20 @@ namespace erebos::platform {
             return _handle;
         }
 
+        /**
+         * This function returns the address of the specified symbol without formatting an error, so it can be used for
+         * bulk lookups which only report the missing symbols.
+         *
+         * @param name The null-terminated name of the symbol
+         * @return     The address of the symbol or null if the symbol wasn't found
+         * @author     Cedric Hammes
+         * @since      18/10/2026
+         */
+        [[nodiscard]] auto find_symbol(const char* name) const noexcept -> void*;
+
         auto operator=(LibraryLoader&& other) noexcept -> LibraryLoader&;
 
     private:
-        [[nodiscard]] auto get_function_address(const std::string& name) noexcept -> erebos::Result<void*>;
+        [[nodiscard]] auto get_function_address(const char* name) const noexcept -> erebos::Result<void*>;
     };
 }// namespace erebos::platform
\ No newline at end of file
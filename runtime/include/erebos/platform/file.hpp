@@ -21,7 +21,10 @@
 #include "erebos/platform/platform.hpp"
 #include "erebos/result.hpp"
 #include "erebos/utils.hpp"
+#include <chrono>
 #include <filesystem>
+#include <optional>
+#include <span>
 
 #ifdef PLATFORM_UNIX
 #include <fcntl.h>
@@ -29,7 +32,29 @@
 #endif
 
 namespace erebos::platform {
-    EREBOS_BITFLAGS(uint8_t, AccessMode, READ = 0b001, WRITE = 0b010, EXECUTE = 0b100)
+    // DIRECT bypasses the page cache, so reads need offsets, sizes and buffers aligned to the block size of the device
+    EREBOS_BITFLAGS(uint8_t, AccessMode, READ = 0b0001, WRITE = 0b0010, EXECUTE = 0b0100, DIRECT = 0b1000)
+
+    enum FileEventType : erebos::u8 { CREATED, DELETED, WRITTEN, UNKNOWN };
+
+    struct FileEvent final {
+        FileEventType type;
+        std::filesystem::path file;
+    };
+
+    /**
+     * This struct contains the metadata of a file. The last write time is relative to the Unix epoch, the file ID is
+     * the inode on Unix and the file index on Windows. The block size is the preferred size of I/O operations.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    struct FileMetadata final {
+        erebos::usize size;
+        std::chrono::nanoseconds last_write_time;
+        erebos::u64 file_id;
+        erebos::u32 block_size;
+    };
 
     class FileMapping final {
 #ifdef PLATFORM_WINDOWS
@@ -88,6 +113,7 @@ namespace erebos::platform {
         std::filesystem::path _path;
         AccessMode _access;
         FileHandle _handle;
+        mutable std::optional<FileMetadata> _metadata;
 
     public:
         /**
@@ -104,12 +130,117 @@ namespace erebos::platform {
         EREBOS_DELETE_COPY(File);
 
         [[nodiscard]] auto map_into_memory() const noexcept -> erebos::Result<FileMapping>;
-        [[nodiscard]] auto get_file_size() const noexcept -> erebos::Result<erebos::usize>;
+
+        /**
+         * This function reads from the specified offset of the file into the buffer without moving a shared file
+         * position, so multiple threads can read from the file at the same time. The buffer is only partially filled
+         * at the end of the file.
+         *
+         * @param buffer The buffer to read into
+         * @param offset The offset in the file to read from
+         * @return       The count of bytes read or an error
+         * @author       Cedric Hammes
+         * @since        18/10/2026
+         */
+        [[nodiscard]] auto read_at(std::span<erebos::u8> buffer, erebos::usize offset) const noexcept -> erebos::Result<erebos::usize>;
+
+        /**
+         * This function advises the operating system to drop the cached pages of the specified range, so data which is
+         * only read once doesn't push other data out of the page cache. This is a no-op on platforms without advice.
+         *
+         * @param offset The offset of the range
+         * @param size   The size of the range
+         * @author       Cedric Hammes
+         * @since        18/10/2026
+         */
+        auto discard_cached_pages(erebos::usize offset, erebos::usize size) const noexcept -> void;
+
+        /**
+         * This function returns the metadata of the file. The metadata is read once with a single system call and
+         * cached until it's invalidated, so changes of the file by other handles or processes are only visible after
+         * the invalidation.
+         *
+         * @return The metadata of the file or an error
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        [[nodiscard]] inline auto get_metadata() const noexcept -> erebos::Result<FileMetadata> {
+            if(!_metadata.has_value()) {
+                EREBOS_TRY_ASSIGN(_metadata, read_handle_metadata());
+            }
+            return *_metadata;
+        }
+
+        /**
+         * This function returns the current size of the file. The size is always read from the handle, because writes
+         * change it without invalidating the cached metadata. The cached metadata is refreshed by the read.
+         *
+         * @return The size of the file or an error
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        [[nodiscard]] inline auto get_file_size() const noexcept -> erebos::Result<erebos::usize> {
+            EREBOS_TRY_ASSIGN(_metadata, read_handle_metadata());
+            return _metadata->size;
+        }
+
+        inline auto invalidate_metadata() noexcept -> void {
+            _metadata.reset();
+        }
+
+        /**
+         * This function invalidates the cached metadata, if the specified event of a file watcher is about this file.
+         * Both paths are made absolute and normalized before the comparison, so relative paths of the watcher match.
+         *
+         * @param event The event of the file watcher
+         * @author      Cedric Hammes
+         * @since       18/10/2026
+         */
+        inline auto handle_file_event(const FileEvent& event) noexcept -> void {
+            if(event.file.filename() != _path.filename()) {
+                return;
+            }
+
+            std::error_code error_code {};
+            const auto event_path = std::filesystem::absolute(event.file, error_code).lexically_normal();
+            const auto path = std::filesystem::absolute(_path, error_code).lexically_normal();
+            if(error_code || event_path == path) {
+                _metadata.reset();
+            }
+        }
+
+        [[nodiscard]] inline auto get_path() const noexcept -> const std::filesystem::path& {
+            return _path;
+        }
 
         [[nodiscard]] inline auto operator*() const noexcept -> FileHandle {
             return _handle;
         }
 
         auto operator=(File&& other) noexcept -> File&;
+
+    private:
+        [[nodiscard]] auto read_handle_metadata() const noexcept -> erebos::Result<FileMetadata>;
     };
+
+    /**
+     * This function reads the metadata of the specified file without opening it.
+     *
+     * @param path The path of the file
+     * @return     The metadata of the file or an error
+     * @author     Cedric Hammes
+     * @since      18/10/2026
+     */
+    [[nodiscard]] auto read_metadata(const std::filesystem::path& path) noexcept -> erebos::Result<FileMetadata>;
+
+    /**
+     * This function reads the metadata of all specified files with one system call per file on Unix, e.g. for the scan
+     * of an asset database. The files aren't opened and the results are in the order of the paths.
+     *
+     * @param paths The paths of the files
+     * @return      The metadata or an error for every file
+     * @author      Cedric Hammes
+     * @since       18/10/2026
+     */
+    [[nodiscard]] auto read_metadata(std::span<const std::filesystem::path> paths) noexcept -> std::vector<erebos::Result<FileMetadata>>;
 }// namespace erebos::platform
\ No newline at end of file
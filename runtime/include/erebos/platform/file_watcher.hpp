@@ -32,13 +32,6 @@
 #endif
 
 namespace erebos::platform {
-    enum FileEventType : erebos::u8 { CREATED, DELETED, WRITTEN, UNKNOWN };
-
-    struct FileEvent final {
-        FileEventType type;
-        std::filesystem::path file;
-    };
-
     class FileWatcher {
         FileWatcherHandle _handle;
         std::filesystem::path _base_path;
@@ -68,7 +61,7 @@ namespace erebos::platform {
                 if(const auto result = callback_function(std::move(_event_queue.front())); !result) {
                     return erebos::Error {result.get_error()};
                 }
-                _event_queue.pop_back();
+                _event_queue.pop_front();
             }
             return {};
         }
@@ -0,0 +1,129 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#pragma once
+#include "erebos/platform/file.hpp"
+#include "erebos/result.hpp"
+#include "erebos/utils.hpp"
+#include <memory>
+#include <new>
+#include <optional>
+#include <semaphore>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace erebos::platform {
+    constexpr usize DEFAULT_STREAM_BUFFER_SIZE = 4 << 20;
+    constexpr usize DEFAULT_STREAM_READAHEAD_DEPTH = 3;
+    constexpr usize MAX_STREAM_READAHEAD_DEPTH = 16;
+    constexpr usize DIRECT_IO_ALIGNMENT = 4096;
+
+    /**
+     * This class streams a large file sequentially in chunks, e.g. asset packs which are uploaded into the GPU. The
+     * file is opened with direct I/O when the file system supports it, so the data doesn't pollute the page cache,
+     * otherwise the pages are dropped from the cache after they were read. A reader thread fills a ring of aligned
+     * buffers ahead of the consumer, the count of buffers is the readahead depth (three buffers by default).
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    class StreamReader final {
+        struct Chunk final {
+            usize size;
+            std::optional<std::string> error;
+        };
+
+        struct AlignedDeleter final {
+            usize alignment;
+
+            auto operator()(u8* pointer) const noexcept -> void {
+                ::operator delete[](pointer, std::align_val_t {alignment});
+            }
+        };
+
+        bool _is_direct;
+        File _file;
+        usize _file_size;
+        usize _buffer_size;
+        usize _readahead_depth;
+        std::unique_ptr<u8[], AlignedDeleter> _buffers;
+        std::vector<Chunk> _chunks;
+        std::counting_semaphore<MAX_STREAM_READAHEAD_DEPTH + 1> _free_chunks;
+        std::counting_semaphore<MAX_STREAM_READAHEAD_DEPTH + 1> _filled_chunks;
+        usize _chunk_index;
+        bool _is_holding_chunk;
+        bool _is_finished;
+        atomic_bool _is_running;
+        std::thread _reader_thread;
+
+    public:
+        /**
+         * This constructor opens the file and starts the reader thread. The buffer size is rounded up to the alignment
+         * of direct I/O. If the file doesn't exist or the readahead depth isn't between two and the maximum depth,
+         * this constructor throws a runtime error.
+         *
+         * @param path            The path of the file to stream
+         * @param buffer_size     The size of a single chunk
+         * @param readahead_depth The count of buffers which are read ahead of the consumer
+         * @author                Cedric Hammes
+         * @since                 18/10/2026
+         */
+        explicit StreamReader(const std::filesystem::path& path,
+                              usize buffer_size = DEFAULT_STREAM_BUFFER_SIZE,
+                              usize readahead_depth = DEFAULT_STREAM_READAHEAD_DEPTH);
+        StreamReader(StreamReader&& other) noexcept = delete;
+
+        /**
+         * This destructor stops the reader thread and waits until the chunk in flight is read.
+         *
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        ~StreamReader() noexcept;
+        EREBOS_DELETE_COPY(StreamReader);
+
+        /**
+         * This function returns the next chunk of the file and hands the previous chunk back to the reader thread, so
+         * the returned data is only valid until the next call. The data is meant to be copied directly into mapped
+         * staging memory without an intermediate copy.
+         *
+         * @return The next chunk, nothing at the end of the file or an error if the read failed
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        [[nodiscard]] auto next() noexcept -> Result<std::optional<std::span<const u8>>>;
+
+        [[nodiscard]] inline auto is_direct() const noexcept -> bool {
+            return _is_direct;
+        }
+
+        [[nodiscard]] inline auto get_file_size() const noexcept -> usize {
+            return _file_size;
+        }
+
+        [[nodiscard]] inline auto get_buffer_size() const noexcept -> usize {
+            return _buffer_size;
+        }
+
+    private:
+        auto read_chunks() noexcept -> void;
+    };
+}// namespace erebos::platform
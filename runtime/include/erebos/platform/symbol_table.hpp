@@ -0,0 +1,188 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#pragma once
+#include "erebos/platform/dynlib.hpp"
+#include "erebos/utils.hpp"
+#include <algorithm>
+#include <array>
+#include <string_view>
+#include <tuple>
+
+namespace erebos::platform {
+    /**
+     * This struct stores a string literal as template argument, so symbol names can be part of the type of a symbol
+     * table. The string contains the null terminator, so it can be passed to the dynamic linker without a copy.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    template<usize SIZE>
+    struct FixedString final {
+        std::array<char, SIZE> data;
+
+        consteval FixedString(const char (&string)[SIZE]) noexcept// NOLINT(google-explicit-constructor)
+            : data {} {
+            std::copy_n(string, SIZE, data.begin());
+        }
+
+        [[nodiscard]] constexpr auto c_str() const noexcept -> const char* {
+            return data.data();
+        }
+
+        [[nodiscard]] constexpr auto view() const noexcept -> std::string_view {
+            return {data.data(), SIZE - 1};
+        }
+    };
+
+    /**
+     * This function hashes the name of a symbol with FNV-1a, so symbols can be looked up in a symbol table at compile
+     * time.
+     *
+     * @param name The name of the symbol
+     * @return     The hash of the name
+     * @author     Cedric Hammes
+     * @since      18/10/2026
+     */
+    [[nodiscard]] constexpr auto hash_symbol_name(const std::string_view name) noexcept -> u64 {
+        u64 hash = 0xCBF29CE484222325;
+        for(const auto character : name) {
+            hash ^= static_cast<u8>(character);
+            hash *= 0x100000001B3;
+        }
+        return hash;
+    }
+
+    /**
+     * This struct declares a symbol of a symbol table with its name and the signature of the function. Optional symbols
+     * don't fail the resolution of the table, they are null if the library doesn't export them.
+     *
+     * @tparam NAME        The name of the exported symbol
+     * @tparam TSignature  The signature of the function
+     * @tparam IS_REQUIRED Whether the resolution fails without the symbol or not
+     * @author             Cedric Hammes
+     * @since              18/10/2026
+     */
+    template<FixedString NAME, typename TSignature, bool IS_REQUIRED = true>
+    struct Symbol final {
+        using Function = TSignature*;
+        static constexpr auto name = NAME;
+        static constexpr auto hash = hash_symbol_name(NAME.view());
+        static constexpr auto is_required = IS_REQUIRED;
+    };
+
+    /**
+     * This class resolves all declared symbols of a library in bulk when it's constructed. The symbols are looked up by
+     * their hashed name at compile time, so a call through the table is a plain indirect call without lookup or
+     * allocation. The names are passed to the dynamic linker as string literals, only a failed resolution allocates for
+     * the error message.
+     *
+     * @code
+     * using SlangSymbols = SymbolTable<Symbol<"slang_createGlobalSession", SlangResult(SlangInt, ISlangGlobalSession**)>,
+     *                                  Symbol<"spGetBuildTagString", const char*(), false>>;
+     * const SlangSymbols symbols {library};
+     * symbols.get<"slang_createGlobalSession">()(SLANG_API_VERSION, &session);
+     * @endcode
+     *
+     * @tparam TSymbols The symbols of the table
+     * @author          Cedric Hammes
+     * @since           18/10/2026
+     */
+    template<typename... TSymbols>
+    class SymbolTable final {
+        static constexpr std::array<const char*, sizeof...(TSymbols)> NAMES {TSymbols::name.c_str()...};
+        static constexpr std::array<u64, sizeof...(TSymbols)> HASHES {TSymbols::hash...};
+        static constexpr std::array<bool, sizeof...(TSymbols)> IS_REQUIRED {TSymbols::is_required...};
+
+        [[nodiscard]] static consteval auto has_unique_hashes() noexcept -> bool {
+            for(usize i = 0; i < HASHES.size(); i++) {
+                for(usize j = i + 1; j < HASHES.size(); j++) {
+                    if(HASHES[i] == HASHES[j]) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+        static_assert(has_unique_hashes(), "Symbol table contains duplicated symbols");
+
+        [[nodiscard]] static consteval auto find_index(const u64 hash) noexcept -> usize {
+            return static_cast<usize>(std::find(HASHES.begin(), HASHES.end(), hash) - HASHES.begin());
+        }
+
+        std::array<void*, sizeof...(TSymbols)> _addresses;
+
+    public:
+        /**
+         * This constructor resolves all symbols of the table in the specified library. If required symbols are
+         * missing, this constructor throws a runtime error with the names of all missing symbols.
+         *
+         * @param library The library exporting the symbols
+         * @author        Cedric Hammes
+         * @since         18/10/2026
+         */
+        explicit SymbolTable(const LibraryLoader& library)
+            : _addresses {} {
+            usize missing_count = 0;
+            for(usize i = 0; i < NAMES.size(); i++) {
+                _addresses[i] = library.find_symbol(NAMES[i]);
+                if(_addresses[i] == nullptr && IS_REQUIRED[i]) {
+                    missing_count++;
+                }
+            }
+
+            if(missing_count > 0) {
+                std::string missing_names {};
+                for(usize i = 0; i < NAMES.size(); i++) {
+                    if(_addresses[i] == nullptr && IS_REQUIRED[i]) {
+                        missing_names += missing_names.empty() ? NAMES[i] : fmt::format(", {}", NAMES[i]);
+                    }
+                }
+                throw std::runtime_error {fmt::format("Unable to resolve {} symbols in {}: {}", missing_count, library.get_name(), missing_names)};
+            }
+        }
+        EREBOS_DEFAULT_MOVE_COPY(SymbolTable);
+
+        /**
+         * This function returns the function pointer of the specified symbol. The symbol is looked up at compile time,
+         * the function pointer of optional symbols is null if the library doesn't export them.
+         *
+         * @tparam NAME The name of the symbol
+         * @return      The function pointer of the symbol
+         * @author      Cedric Hammes
+         * @since       18/10/2026
+         */
+        template<FixedString NAME>
+        [[nodiscard]] inline auto get() const noexcept {
+            constexpr auto index = find_index(hash_symbol_name(NAME.view()));
+            static_assert(index < sizeof...(TSymbols), "Symbol is not declared in the symbol table");
+            using Function = typename std::tuple_element_t<index, std::tuple<TSymbols...>>::Function;
+            return reinterpret_cast<Function>(_addresses[index]);// NOLINT
+        }
+
+        template<FixedString NAME>
+        [[nodiscard]] inline auto is_resolved() const noexcept -> bool {
+            return get<NAME>() != nullptr;
+        }
+
+        [[nodiscard]] static constexpr auto get_size() noexcept -> usize {
+            return sizeof...(TSymbols);
+        }
+    };
+}// namespace erebos::platform
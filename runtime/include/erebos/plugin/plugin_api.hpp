@@ -0,0 +1,68 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#ifdef PLATFORM_WINDOWS
+#define EREBOS_PLUGIN_EXPORT __declspec(dllexport)
+#else
+#define EREBOS_PLUGIN_EXPORT __attribute__((visibility("default")))
+#endif
+
+/**
+ * This macro exports the entry point of a plugin, which returns the specified plugin API. The API must outlive the
+ * plugin library, so it should be a global constant.
+ */
+#define EREBOS_DEFINE_PLUGIN(api)                                                                   \
+    extern "C" EREBOS_PLUGIN_EXPORT auto erebos_get_plugin_api() -> const erebos::plugin::PluginApi* { \
+        return &(api);                                                                              \
+    }
+
+namespace erebos::plugin {
+    /**
+     * The version of the plugin API. The version is incremented with every change of the layout or the semantics of the
+     * plugin API, so the host never calls into a plugin built against another version.
+     */
+    constexpr std::uint32_t PLUGIN_API_VERSION = 1;
+
+    /**
+     * This struct is the function table of a plugin. The plugin only communicates over this table with the host, so
+     * only plain data crosses the boundary of the library and the host can unload the library at any time after the
+     * instance was destroyed.
+     *
+     * The state of an instance is handed over to the instance of the reloaded library by save_state and load_state.
+     * save_state returns the size of the state and only writes the state if the buffer is large enough, so the host can
+     * query the size with an empty buffer. load_state returns false if the state can't be restored, the host keeps the
+     * old library in this case.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    struct PluginApi final {
+        std::uint32_t api_version;
+        const char* name;
+        void* (*create)();
+        void (*destroy)(void* instance);
+        void (*update)(void* instance, double delta_time);
+        std::size_t (*save_state)(const void* instance, std::uint8_t* buffer, std::size_t buffer_size);
+        bool (*load_state)(void* instance, const std::uint8_t* buffer, std::size_t buffer_size);
+    };
+}// namespace erebos::plugin
@@ -0,0 +1,99 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#pragma once
+#include "erebos/platform/dynlib.hpp"
+#include "erebos/platform/file_watcher.hpp"
+#include "erebos/plugin/plugin_api.hpp"
+#include "erebos/result.hpp"
+#include "erebos/utils.hpp"
+#include <chrono>
+#include <filesystem>
+#include <memory>
+
+namespace erebos::plugin {
+    /**
+     * The budget of a reload, from the copy of the library to the handoff of the state. Reloads exceeding the budget
+     * are reported as warning.
+     */
+    constexpr auto RELOAD_TIME_BUDGET = std::chrono::milliseconds {100};
+
+    /**
+     * This class loads a plugin library and reloads it, when the library was rebuilt. The library is copied to a shadow
+     * path before it's loaded, so the build can overwrite the library while it's loaded and the dynamic linker never
+     * returns the already loaded library for the same path. The plugin API is resolved once per load, the state of the
+     * instance is handed over to the instance of the reloaded library. If the reload fails, the old library stays
+     * loaded.
+     *
+     * The reload is triggered by the file events of the library's directory, which are handled on the calling thread by
+     * handle_file_events. The module isn't thread-safe.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    class PluginModule final {
+        std::filesystem::path _path;
+        std::filesystem::path _shadow_path;
+        u32 _generation;
+        platform::LibraryLoader _library;
+        const PluginApi* _api;
+        void* _instance;
+        std::unique_ptr<platform::FileWatcher> _watcher;
+        std::chrono::nanoseconds _last_reload_time;
+
+    public:
+        explicit PluginModule(const std::filesystem::path& path, bool is_watched = true);
+        PluginModule(PluginModule&& other) noexcept;
+        ~PluginModule() noexcept;
+        EREBOS_DELETE_COPY(PluginModule);
+
+        auto update(double delta_time) noexcept -> void;
+        [[nodiscard]] auto reload() noexcept -> Result<void>;
+        [[nodiscard]] auto handle_file_events() noexcept -> Result<bool>;
+
+        [[nodiscard]] inline auto get_path() const noexcept -> const std::filesystem::path& {
+            return _path;
+        }
+
+        [[nodiscard]] inline auto get_api() const noexcept -> const PluginApi& {
+            return *_api;
+        }
+
+        [[nodiscard]] inline auto get_instance() const noexcept -> void* {
+            return _instance;
+        }
+
+        /**
+         * This function returns the count of successful reloads since the library was loaded the first time.
+         *
+         * @return The generation of the loaded library
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        [[nodiscard]] inline auto get_generation() const noexcept -> u32 {
+            return _generation;
+        }
+
+        [[nodiscard]] inline auto get_last_reload_time() const noexcept -> std::chrono::nanoseconds {
+            return _last_reload_time;
+        }
+
+        auto operator=(PluginModule&& other) noexcept -> PluginModule&;
+    };
+}// namespace erebos::plugin
@@ -0,0 +1,159 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#pragma once
+#include "erebos/result.hpp"
+#include "erebos/utils.hpp"
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <string_view>
+
+#if defined(ARCH_X86) && defined(COMPILER_MSVC)
+#include <intrin.h>
+#elif defined(ARCH_X86)
+#include <x86intrin.h>
+#endif
+
+#ifdef EREBOS_PROFILING
+#define EREBOS_PROFILE_CONCAT_IMPL(a, b) a##b
+#define EREBOS_PROFILE_CONCAT(a, b) EREBOS_PROFILE_CONCAT_IMPL(a, b)
+#define EREBOS_PROFILE_SCOPE(name) const ::erebos::profiler::ProfileScope EREBOS_PROFILE_CONCAT(erebos_profile_scope_, __LINE__) {name}
+#define EREBOS_PROFILE_THREAD_NAME(name) ::erebos::profiler::set_thread_name(name)
+#else
+#define EREBOS_PROFILE_SCOPE(name)
+#define EREBOS_PROFILE_THREAD_NAME(name)
+#endif
+
+namespace erebos::profiler {
+    /**
+     * A finished zone of a thread. The name is not copied, so it must be a string literal or live until the capture
+     * is stopped.
+     */
+    struct ZoneEvent final {
+        const char* name;
+        u64 begin;
+        u64 end;
+    };
+
+    namespace detail {
+        extern std::atomic_bool is_capturing;
+
+        auto push_zone(const ZoneEvent& event) noexcept -> void;
+
+        // Returns the count of thread buffers, which are still allocated
+        [[nodiscard]] auto get_thread_buffer_count() noexcept -> usize;
+    }// namespace detail
+
+    /**
+     * This function returns whether the profile zones are compiled into the runtime. If that's not the case, all
+     * EREBOS_PROFILE_SCOPE zones expand to nothing.
+     *
+     * @return Whether the profiling is enabled
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    [[nodiscard]] constexpr auto is_profiling_enabled() noexcept -> bool {
+#ifdef EREBOS_PROFILING
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * This function reads the cheapest monotonic tick counter of the platform. On x86 and ARM64 this is the invariant
+     * timestamp counter of the CPU, on other platforms the nanoseconds of std::chrono::steady_clock. The ticks are
+     * converted into nanoseconds when the zones are written into the trace.
+     *
+     * @return The current tick count
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    [[nodiscard]] inline auto get_ticks() noexcept -> u64 {
+#if defined(ARCH_X86)
+        return __rdtsc();
+#elif defined(ARCH_ARM64) && !defined(COMPILER_MSVC)
+        u64 ticks = 0;
+        asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+        return ticks;
+#else
+        return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    /**
+     * This class measures the time between its construction and destruction and pushes the zone into the ring buffer
+     * of the calling thread, if a capture is running. The zone is dropped if the ring buffer is full.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    class ProfileScope final {
+        const char* _name;
+        u64 _begin;
+
+    public:
+        explicit ProfileScope(const char* name) noexcept
+            : _name {name}
+            , _begin {detail::is_capturing.load(std::memory_order_relaxed) ? get_ticks() : 0} {
+        }
+
+        ~ProfileScope() noexcept {
+            if(_begin != 0) {
+                detail::push_zone({_name, _begin, get_ticks()});
+            }
+        }
+
+        ProfileScope(ProfileScope&& other) noexcept = delete;
+        EREBOS_DELETE_COPY(ProfileScope);
+    };
+
+    /**
+     * This function sets the name of the calling thread in the trace.
+     *
+     * @param name The name of the thread
+     * @author     Cedric Hammes
+     * @since      18/10/2026
+     */
+    auto set_thread_name(std::string_view name) noexcept -> void;
+
+    /**
+     * This function starts the capture of zones into the specified file. A background thread drains the ring buffers
+     * of all threads in the specified interval and writes the zones as Chrome trace JSON, which can be opened with
+     * chrome://tracing or the Perfetto UI.
+     *
+     * @param path           The path of the trace file
+     * @param flush_interval The interval the ring buffers are drained in
+     * @return               Void or an error
+     * @author               Cedric Hammes
+     * @since                18/10/2026
+     */
+    [[nodiscard]] auto start_capture(const std::filesystem::path& path,
+                                     std::chrono::milliseconds flush_interval = std::chrono::milliseconds {50}) noexcept -> Result<void>;
+
+    /**
+     * This function stops the capture, writes the remaining zones and closes the trace file.
+     *
+     * @return The count of zones, which were dropped because a ring buffer was full
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    auto stop_capture() noexcept -> usize;
+}// namespace erebos::profiler
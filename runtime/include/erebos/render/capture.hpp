@@ -0,0 +1,180 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#pragma once
+#include "erebos/platform/file.hpp"
+#include "erebos/result.hpp"
+#include "erebos/utils.hpp"
+#include <array>
+#include <cstdio>
+#include <optional>
+#include <string_view>
+
+namespace erebos::render {
+    constexpr u32 CAPTURE_MAGIC = 0x50434245;// EBCP
+    constexpr u16 CAPTURE_VERSION = 1;
+
+    enum class CaptureCommandType : u16 {
+        BEGIN_FRAME,
+        END_FRAME,
+        ACQUIRE_COMMAND_BUFFER,
+        BEGIN_COMMAND_BUFFER,
+        END_COMMAND_BUFFER,
+        BEGIN_LABEL,
+        END_LABEL,
+        CLEAR_IMAGE,
+        UPLOAD,
+        SUBMIT
+    };
+
+    /**
+     * A command read from a capture. Only the fields of the command type are set: the queue index for
+     * ACQUIRE_COMMAND_BUFFER, the usage flags for BEGIN_COMMAND_BUFFER, the name for BEGIN_LABEL, the color for
+     * CLEAR_IMAGE and the size for UPLOAD. The name points into the mapped capture.
+     */
+    struct CaptureCommand final {
+        CaptureCommandType type;
+        u32 value;
+        u64 size;
+        std::array<float, 4> color;
+        std::string_view name;
+    };
+
+    /**
+     * This class records the frames of the renderer into a compact binary capture. Every command is stored as type,
+     * payload size and payload. The header is rewritten when the writer is destroyed, so it contains the count of
+     * frames and the largest upload of the capture.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    class CaptureWriter final {
+        std::FILE* _file;
+        u32 _frame_count;
+        u32 _image_width;
+        u32 _image_height;
+        u64 _max_upload_size;
+
+    public:
+        /**
+         * This constructor creates the capture file and writes the header.
+         *
+         * @param path         The path of the capture file
+         * @param image_width  The width of the image the frames are rendered into
+         * @param image_height The height of the image the frames are rendered into
+         * @author             Cedric Hammes
+         * @since              18/10/2026
+         */
+        CaptureWriter(const std::filesystem::path& path, u32 image_width, u32 image_height);
+        CaptureWriter(CaptureWriter&& other) noexcept;
+
+        /**
+         * This destructor rewrites the header and closes the capture file.
+         *
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        ~CaptureWriter() noexcept;
+        EREBOS_DELETE_COPY(CaptureWriter);
+
+        auto begin_frame() noexcept -> void;
+        auto end_frame() noexcept -> void;
+        auto acquire_command_buffer(u32 queue_index) noexcept -> void;
+        auto begin_command_buffer(u32 usage_flags) noexcept -> void;
+        auto end_command_buffer() noexcept -> void;
+        auto begin_label(std::string_view name) noexcept -> void;
+        auto end_label() noexcept -> void;
+        auto clear_image(const std::array<float, 4>& color) noexcept -> void;
+        auto upload(u64 size) noexcept -> void;
+        auto submit() noexcept -> void;
+
+        [[nodiscard]] inline auto get_frame_count() const noexcept -> u32 {
+            return _frame_count;
+        }
+
+        auto operator=(CaptureWriter&& other) noexcept -> CaptureWriter&;
+
+    private:
+        auto write_command(CaptureCommandType type, const void* payload = nullptr, u16 payload_size = 0) noexcept -> void;
+        auto write_header() noexcept -> void;
+    };
+
+    /**
+     * This class reads the commands of a capture from the memory-mapped capture file, so the replay doesn't copy or
+     * parse the capture up-front.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    class CaptureReader final {
+        platform::FileMapping _mapping;
+        usize _offset;
+        u32 _frame_count;
+        u32 _image_width;
+        u32 _image_height;
+        u64 _max_upload_size;
+
+    public:
+        /**
+         * This constructor maps the capture file into the memory and validates the header. If the file isn't a
+         * capture or was written by another version, this constructor throws a runtime error.
+         *
+         * @param path The path of the capture file
+         * @author     Cedric Hammes
+         * @since      18/10/2026
+         */
+        explicit CaptureReader(const std::filesystem::path& path);
+        ~CaptureReader() noexcept = default;
+        EREBOS_DELETE_COPY(CaptureReader);
+        EREBOS_DEFAULT_MOVE(CaptureReader);
+
+        /**
+         * This function reads the next command of the capture.
+         *
+         * @return The next command, nothing at the end of the capture or an error if the capture is corrupted
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        [[nodiscard]] auto next() noexcept -> Result<std::optional<CaptureCommand>>;
+
+        /**
+         * This function moves the reader back to the first command, so the capture can be replayed again.
+         *
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        auto rewind() noexcept -> void;
+
+        [[nodiscard]] inline auto get_frame_count() const noexcept -> u32 {
+            return _frame_count;
+        }
+
+        [[nodiscard]] inline auto get_image_width() const noexcept -> u32 {
+            return _image_width;
+        }
+
+        [[nodiscard]] inline auto get_image_height() const noexcept -> u32 {
+            return _image_height;
+        }
+
+        [[nodiscard]] inline auto get_max_upload_size() const noexcept -> u64 {
+            return _max_upload_size;
+        }
+    };
+}// namespace erebos::render
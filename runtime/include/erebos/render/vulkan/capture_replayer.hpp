@@ -0,0 +1,69 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#pragma once
+#include "erebos/render/capture.hpp"
+#include "erebos/render/vulkan/device.hpp"
+#include "erebos/render/vulkan/frame.hpp"
+#include <chrono>
+#include <vector>
+
+namespace erebos::render::vulkan {
+    struct ReplayStatistics final {
+        u32 frame_count;
+        u32 submit_count;
+        u32 command_buffer_count;
+        usize command_count;
+        std::chrono::nanoseconds recording_time;
+        std::chrono::nanoseconds max_frame_recording_time;
+        std::chrono::nanoseconds total_time;
+    };
+
+    /**
+     * This class replays a frame capture headless on the specified device. The frames are recorded through the same
+     * frames and queue frames as the editor uses, but the image is an offscreen image with the extent of the capture
+     * and the frames aren't presented. This allows to measure the CPU recording cost and the submit counts of a
+     * capture reproducible on every device (including software rasterizers like lavapipe).
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    class CaptureReplayer final {
+        const Device* _device;
+        VkExtent2D _extent;
+        VkImage _image;
+        VmaAllocation _image_allocation;
+        VkDeviceSize _upload_size;
+        VkBuffer _staging_buffer;
+        VmaAllocation _staging_allocation;
+        VkBuffer _upload_buffer;
+        VmaAllocation _upload_allocation;
+
+        [[nodiscard]] auto replay_commands(CaptureReader& reader, std::vector<Frame>& frames, ReplayStatistics& statistics) noexcept
+                -> Result<void>;
+
+    public:
+        explicit CaptureReplayer(const Device& device, const CaptureReader& reader);
+        ~CaptureReplayer() noexcept;
+        EREBOS_DELETE_COPY(CaptureReplayer);
+        CaptureReplayer(CaptureReplayer&& other) noexcept = delete;
+
+        [[nodiscard]] auto replay(CaptureReader& reader) noexcept -> Result<ReplayStatistics>;
+    };
+}// namespace erebos::render::vulkan
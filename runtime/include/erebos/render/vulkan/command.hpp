@@ -20,6 +20,7 @@
 #pragma once
 #include "erebos/platform/platform.hpp"
 #include "erebos/render/vulkan/command.hpp"
+#include "erebos/render/vulkan/debug_utils.hpp"
 #include "erebos/render/vulkan/sync/fence.hpp"
 
 namespace erebos::render::vulkan {
@@ -51,8 +52,45 @@ namespace erebos::render::vulkan {
         ~CommandBuffer() noexcept;
         EREBOS_DELETE_COPY(CommandBuffer);
 
-        [[nodiscard]] auto begin(VkCommandBufferUsageFlags usage = 0) const noexcept -> Result<void>;
-        [[nodiscard]] auto end() const noexcept -> Result<void>;
+        [[nodiscard]] auto begin(VkCommandBufferUsageFlags usage = 0) const noexcept -> Result<void, ErrorCode>;
+        [[nodiscard]] auto end() const noexcept -> Result<void, ErrorCode>;
+
+        /**
+         * This function opens a debug label region in this command buffer, which is shown by capture tools like
+         * RenderDoc. In release builds this function does nothing.
+         *
+         * @param name  The name of the label region
+         * @param color The color of the label region
+         * @author      Cedric Hammes
+         * @since       18/10/2026
+         */
+        inline auto begin_label(const std::string_view name, const LabelColor& color = {}) const noexcept -> void {
+            vulkan::begin_label(_command_buffer, name, color);
+        }
+
+        /**
+         * This function closes the last opened debug label region in this command buffer. In release builds this
+         * function does nothing.
+         *
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        inline auto end_label() const noexcept -> void {
+            vulkan::end_label(_command_buffer);
+        }
+
+        /**
+         * This function inserts a single debug label into this command buffer. In release builds this function does
+         * nothing.
+         *
+         * @param name  The name of the label
+         * @param color The color of the label
+         * @author      Cedric Hammes
+         * @since       18/10/2026
+         */
+        inline auto insert_label(const std::string_view name, const LabelColor& color = {}) const noexcept -> void {
+            vulkan::insert_label(_command_buffer, name, color);
+        }
 
         /**
          * This function returns the raw handle to the command buffer
@@ -68,6 +106,29 @@ namespace erebos::render::vulkan {
         auto operator=(CommandBuffer&& other) noexcept -> CommandBuffer&;
     };
 
+    /**
+     * This class opens a debug label region in the command buffer on construction and closes it on destruction.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    class CommandBufferLabel final {
+        const CommandBuffer* _command_buffer;
+
+    public:
+        CommandBufferLabel(const CommandBuffer& command_buffer, const std::string_view name, const LabelColor& color = {}) noexcept
+            : _command_buffer {&command_buffer} {
+            command_buffer.begin_label(name, color);
+        }
+
+        ~CommandBufferLabel() noexcept {
+            _command_buffer->end_label();
+        }
+
+        CommandBufferLabel(CommandBufferLabel&& other) noexcept = delete;
+        EREBOS_DELETE_COPY(CommandBufferLabel);
+    };
+
     class CommandPool final {
         const Device* _device;
         VkCommandPool _command_pool;
@@ -76,11 +137,13 @@ namespace erebos::render::vulkan {
 
     public:
         /**
-         * This constructor creates a command pool on the specified device
+         * This constructor creates a command pool on the specified device. In debug builds the command pool is named
+         * after the queue family.
          *
-         * @param device The device for create the pool
-         * @author       Cedric Hammes
-         * @since        14/03/2024
+         * @param device             The device for create the pool
+         * @param queue_family_index The queue family of the command buffers
+         * @author                   Cedric Hammes
+         * @since                    14/03/2024
          */
         CommandPool(const Device& device, uint32_t queue_family_index);
         CommandPool(CommandPool&& other) noexcept;
@@ -102,7 +165,7 @@ namespace erebos::render::vulkan {
          * @author      Cedric Hammes
          * @since       14/03/2024
          */
-        [[nodiscard]] auto allocate(uint32_t count) const noexcept -> Result<std::vector<CommandBuffer>>;
+        [[nodiscard]] auto allocate(uint32_t count) const noexcept -> Result<std::vector<CommandBuffer>, ErrorCode>;
 
         /**
          * This function creates a one-time command buffer and executes the specified function. After the run, the
@@ -119,22 +182,15 @@ namespace erebos::render::vulkan {
             static_assert(std::is_convertible_v<F, std::function<void(CommandBuffer&)>>, "Invalid command buffer consumer");
 
             // Create command buffer and submit fence
-            const auto command_buffers = allocate(1);
-            if(command_buffers.is_error()) {
-                return Error(command_buffers.get_error());
-            }
-            const auto submit_fence = sync::Fence(*_device);
-            const auto command_buffer = &command_buffers.get()[0];
+            EREBOS_TRY_ASSIGN(const auto command_buffers, allocate(1));
+            const auto submit_fence = sync::Fence(*_device, false, "One-Time Submit Fence");
+            const auto command_buffer = &command_buffers[0];
             const auto raw_command_buffer = **command_buffer;
 
             // Perform operation
-            if(auto begin_result = command_buffer->begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT); begin_result.is_error()) {
-                return begin_result;
-            }
+            EREBOS_TRY(command_buffer->begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT));
             function(&command_buffer);
-            if(auto end_result = command_buffer->end(); end_result.is_error()) {
-                return end_result;
-            }
+            EREBOS_TRY(command_buffer->end());
 
 
             // Submit
@@ -146,9 +202,7 @@ namespace erebos::render::vulkan {
                 return Error(fmt::format("Unable to emit one-time command buffer: {}", platform::get_last_error()));
             }
 
-            if(auto wait_result = submit_fence.wait(); wait_result.is_error()) {
-                return wait_result;
-            }
+            EREBOS_TRY(submit_fence.wait());
             return {};
         }
 
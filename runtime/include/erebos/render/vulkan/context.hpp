@@ -35,6 +35,7 @@ namespace erebos::render::vulkan {
 
     public:
         explicit VulkanContext(const Window& window);
+        VulkanContext();
         VulkanContext(VulkanContext&& other) noexcept;
         ~VulkanContext() noexcept;
         EREBOS_DELETE_COPY(VulkanContext);
@@ -68,8 +69,23 @@ namespace erebos::render::vulkan {
             return _surface_handle;
         }
 
+        /**
+         * This function returns whether the context was created without window. Headless contexts have no surface, so
+         * no swapchain can be created with devices of this context.
+         *
+         * @return Whether the context is headless or not
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        [[nodiscard]] inline auto is_headless() const noexcept -> bool {
+            return _window == nullptr;
+        }
+
         [[nodiscard]] inline auto operator*() const noexcept -> VkInstance {
             return _instance_handle;
         }
+
+    private:
+        auto create_instance(std::vector<const char*> extensions) -> void;
     };
 }// namespace erebos::render::vulkan
\ No newline at end of file
@@ -0,0 +1,195 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#pragma once
+#include "erebos/utils.hpp"
+#include <algorithm>
+#include <array>
+#include <string_view>
+#include <type_traits>
+#include <volk.h>
+
+namespace erebos::render::vulkan {
+    // The color of a label, a color with all components set to zero is ignored by the tools
+    using LabelColor = std::array<float, 4>;
+
+    namespace detail {
+        constexpr usize MAX_DEBUG_NAME_LENGTH = 255;
+
+        // Vulkan expects null-terminated names, so the name is copied into a buffer on the stack
+        template<typename... TArgs>
+        [[nodiscard]] auto format_debug_name(fmt::format_string<TArgs...> format, TArgs&&... args) noexcept
+            -> std::array<char, MAX_DEBUG_NAME_LENGTH + 1> {
+            std::array<char, MAX_DEBUG_NAME_LENGTH + 1> name {};
+            fmt::format_to_n(name.data(), MAX_DEBUG_NAME_LENGTH, format, std::forward<TArgs>(args)...);
+            return name;
+        }
+
+        template<typename T>
+        [[nodiscard]] auto to_object_handle(const T handle) noexcept -> u64 {
+            if constexpr(std::is_pointer_v<T>) {
+                return reinterpret_cast<u64>(handle);
+            }
+            else {
+                return static_cast<u64>(handle);
+            }
+        }
+    }// namespace detail
+
+    template<typename T>
+    constexpr auto object_type_of = VK_OBJECT_TYPE_UNKNOWN;
+    template<>
+    constexpr auto object_type_of<VkDevice> = VK_OBJECT_TYPE_DEVICE;
+    template<>
+    constexpr auto object_type_of<VkQueue> = VK_OBJECT_TYPE_QUEUE;
+    template<>
+    constexpr auto object_type_of<VkCommandPool> = VK_OBJECT_TYPE_COMMAND_POOL;
+    template<>
+    constexpr auto object_type_of<VkCommandBuffer> = VK_OBJECT_TYPE_COMMAND_BUFFER;
+    template<>
+    constexpr auto object_type_of<VkFence> = VK_OBJECT_TYPE_FENCE;
+    template<>
+    constexpr auto object_type_of<VkSemaphore> = VK_OBJECT_TYPE_SEMAPHORE;
+    template<>
+    constexpr auto object_type_of<VkQueryPool> = VK_OBJECT_TYPE_QUERY_POOL;
+    template<>
+    constexpr auto object_type_of<VkSwapchainKHR> = VK_OBJECT_TYPE_SWAPCHAIN_KHR;
+    template<>
+    constexpr auto object_type_of<VkBuffer> = VK_OBJECT_TYPE_BUFFER;
+    template<>
+    constexpr auto object_type_of<VkImage> = VK_OBJECT_TYPE_IMAGE;
+
+    /**
+     * This function returns whether the debug utils names and labels are compiled into the runtime. This is only the
+     * case in debug builds, in release builds all functions in this file compile to nothing.
+     *
+     * @return Whether the debug utils are enabled
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    [[nodiscard]] constexpr auto is_debug_utils_enabled() noexcept -> bool {
+#ifdef BUILD_DEBUG
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * This function names the Vulkan object, so validation messages and capture tools like RenderDoc show the name
+     * instead of the raw handle. The name is truncated after 255 characters.
+     *
+     * @tparam T       The type of the object handle
+     * @tparam TArgs   The types of the format arguments
+     * @param device   The device owning the object
+     * @param handle   The handle of the object
+     * @param format   The format string of the name
+     * @param args     The format arguments of the name
+     * @author         Cedric Hammes
+     * @since          18/10/2026
+     */
+    template<typename T, typename... TArgs>
+    auto set_object_name([[maybe_unused]] VkDevice device,
+                         [[maybe_unused]] const T handle,
+                         [[maybe_unused]] fmt::format_string<TArgs...> format,
+                         [[maybe_unused]] TArgs&&... args) noexcept -> void {
+        static_assert(object_type_of<T> != VK_OBJECT_TYPE_UNKNOWN, "Unsupported Vulkan object type");
+#ifdef BUILD_DEBUG
+        if(::vkSetDebugUtilsObjectNameEXT == nullptr || handle == VK_NULL_HANDLE) {
+            return;
+        }
+
+        const auto name = detail::format_debug_name(format, std::forward<TArgs>(args)...);
+        VkDebugUtilsObjectNameInfoEXT name_info {};
+        name_info.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT;
+        name_info.objectType = object_type_of<T>;
+        name_info.objectHandle = detail::to_object_handle(handle);
+        name_info.pObjectName = name.data();
+        ::vkSetDebugUtilsObjectNameEXT(device, &name_info);
+#endif
+    }
+
+    /**
+     * This function opens a label region in the command buffer. Every region has to be closed with end_label in the
+     * same command buffer.
+     *
+     * @param command_buffer The command buffer to write the label into
+     * @param name           The name of the label region
+     * @param color          The color of the label region
+     * @author               Cedric Hammes
+     * @since                18/10/2026
+     */
+    inline auto begin_label([[maybe_unused]] VkCommandBuffer command_buffer,
+                            [[maybe_unused]] const std::string_view name,
+                            [[maybe_unused]] const LabelColor& color = {}) noexcept -> void {
+#ifdef BUILD_DEBUG
+        if(::vkCmdBeginDebugUtilsLabelEXT == nullptr) {
+            return;
+        }
+
+        const auto label_name = detail::format_debug_name("{}", name);
+        VkDebugUtilsLabelEXT label {};
+        label.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT;
+        label.pLabelName = label_name.data();
+        std::copy(color.begin(), color.end(), label.color);
+        ::vkCmdBeginDebugUtilsLabelEXT(command_buffer, &label);
+#endif
+    }
+
+    /**
+     * This function closes the last opened label region in the command buffer.
+     *
+     * @param command_buffer The command buffer to write the label into
+     * @author               Cedric Hammes
+     * @since                18/10/2026
+     */
+    inline auto end_label([[maybe_unused]] VkCommandBuffer command_buffer) noexcept -> void {
+#ifdef BUILD_DEBUG
+        if(::vkCmdEndDebugUtilsLabelEXT != nullptr) {
+            ::vkCmdEndDebugUtilsLabelEXT(command_buffer);
+        }
+#endif
+    }
+
+    /**
+     * This function inserts a single label into the command buffer, which marks a point instead of a region.
+     *
+     * @param command_buffer The command buffer to write the label into
+     * @param name           The name of the label
+     * @param color          The color of the label
+     * @author               Cedric Hammes
+     * @since                18/10/2026
+     */
+    inline auto insert_label([[maybe_unused]] VkCommandBuffer command_buffer,
+                             [[maybe_unused]] const std::string_view name,
+                             [[maybe_unused]] const LabelColor& color = {}) noexcept -> void {
+#ifdef BUILD_DEBUG
+        if(::vkCmdInsertDebugUtilsLabelEXT == nullptr) {
+            return;
+        }
+
+        const auto label_name = detail::format_debug_name("{}", name);
+        VkDebugUtilsLabelEXT label {};
+        label.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT;
+        label.pLabelName = label_name.data();
+        std::copy(color.begin(), color.end(), label.color);
+        ::vkCmdInsertDebugUtilsLabelEXT(command_buffer, &label);
+#endif
+    }
+}// namespace erebos::render::vulkan
@@ -0,0 +1,206 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#pragma once
+#include "erebos/render/vulkan/command.hpp"
+#include "erebos/render/vulkan/device.hpp"
+#include "erebos/render/vulkan/sync/fence.hpp"
+#include <chrono>
+#include <functional>
+#include <unordered_map>
+
+namespace erebos::render::vulkan {
+    struct DefragmentationStatistics final {
+        usize pass_count;
+        usize moved_allocation_count;
+        usize ignored_allocation_count;
+        VkDeviceSize moved_bytes;
+        VkDeviceSize freed_bytes;
+        usize freed_memory_block_count;
+    };
+
+    /**
+     * This callback is called after a registered buffer was moved into a new buffer. The callback must patch all
+     * descriptors and device addresses, which reference the old buffer. The device address is zero, if the buffer wasn't
+     * created with VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT.
+     */
+    using BufferMovedCallbackFunction = std::function<void(VkBuffer new_buffer, VkDeviceAddress new_address, void* data)>;
+
+    /**
+     * This class runs an incremental defragmentation of the allocator's memory. The defragmentation is split into passes,
+     * which are executed under a time budget, so the defragmentation can run over multiple frames. Only registered
+     * buffers are moved, all other allocations are ignored by the passes. The content of concurrent buffers is copied on
+     * the transfer queue, the content of exclusive buffers on the direct queue, which is expected to own them. The copies
+     * of a pass are polled by the following calls of run, so the CPU never waits for the GPU. After the copies, the old
+     * buffers are kept alive until the frames in flight, which may still reference them, are complete.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    class Defragmenter final {
+        struct RegisteredBuffer final {
+            VkBuffer buffer;
+            VkBufferCreateInfo create_info;
+            BufferMovedCallbackFunction moved_callback;
+            void* data;
+            std::vector<u32> queue_family_indices;
+        };
+
+        struct PendingMove final {
+            usize move_index;
+            VmaAllocation allocation;
+            VkBuffer old_buffer;
+            VkBuffer new_buffer;
+            VkDeviceSize size;
+            bool is_exclusive;
+        };
+
+        const Device* _device;
+        VmaPool _pool;
+        VkDeviceSize _max_bytes_per_pass;
+        u32 _frames_in_flight;
+        CommandPool _transfer_command_pool;
+        CommandPool _direct_command_pool;
+        std::vector<CommandBuffer> _transfer_command_buffers;
+        std::vector<CommandBuffer> _direct_command_buffers;
+        sync::Fence _copy_fence;
+        VmaDefragmentationContext _defragmentation_context;
+        VmaDefragmentationPassMoveInfo _pass_info;
+        bool _is_pass_submitted;
+        u32 _remaining_retire_frame_count;
+        std::unordered_map<VmaAllocation, RegisteredBuffer> _registered_buffers;
+        std::vector<PendingMove> _pending_moves;
+        std::vector<VkBuffer> _retired_buffers;
+        DefragmentationStatistics _statistics;
+
+    public:
+        /**
+         * This constructor creates a defragmenter for the default pools of the device's allocator or the specified pool.
+         * The old buffers of a pass are destroyed after the specified count of frames, so run must be called once per
+         * frame after the frame waited for its last submission. With zero frames in flight, the old buffers are
+         * destroyed right after the copies and the caller must ensure that the device doesn't use them anymore.
+         *
+         * @param device             The device to defragment the memory of
+         * @param pool               The pool to defragment or null for the default pools
+         * @param max_bytes_per_pass The maximum count of bytes moved in a single pass
+         * @param frames_in_flight   The count of frames, which may reference a buffer after it was replaced
+         * @author                   Cedric Hammes
+         * @since                    18/10/2026
+         */
+        explicit Defragmenter(const Device& device,
+                              VmaPool pool = nullptr,
+                              VkDeviceSize max_bytes_per_pass = 16 * 1024 * 1024,
+                              u32 frames_in_flight = 2);
+
+        /**
+         * This destructor waits for the copies of a submitted pass and ends the defragmentation. The moves of the
+         * submitted pass are discarded, so the registered buffers keep their old handles. If the old buffers of a pass
+         * are still kept alive for the frames in flight, the destructor waits for the device before destroying them.
+         *
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        ~Defragmenter() noexcept;
+        EREBOS_DELETE_COPY(Defragmenter);
+        Defragmenter(Defragmenter&& other) noexcept = delete;
+
+        /**
+         * This function registers a buffer, which can be moved by the defragmentation. The buffer must be created with
+         * the transfer source and destination usage flags. Concurrent buffers must be shared with the transfer queue
+         * family, exclusive buffers must be owned by the direct queue family.
+         *
+         * @param allocation     The allocation of the buffer
+         * @param buffer         The buffer itself
+         * @param create_info    The info used to create the buffer
+         * @param moved_callback The callback called after the buffer was moved
+         * @param data           The data passed to the callback
+         * @return               Void or an error
+         * @author               Cedric Hammes
+         * @since                18/10/2026
+         */
+        [[nodiscard]] auto register_buffer(VmaAllocation allocation,
+                                           VkBuffer buffer,
+                                           const VkBufferCreateInfo& create_info,
+                                           BufferMovedCallbackFunction moved_callback,
+                                           void* data) noexcept -> Result<void>;
+
+        /**
+         * This function unregisters the buffer of the specified allocation. This must be called before the buffer gets
+         * destroyed by its owner. If the buffer is moved by the submitted pass, the move is discarded.
+         *
+         * @param allocation The allocation of the buffer
+         * @author           Cedric Hammes
+         * @since            18/10/2026
+         */
+        auto unregister_buffer(VmaAllocation allocation) noexcept -> void;
+
+        /**
+         * This function returns the current buffer handle of the specified allocation. The handle changes when the
+         * buffer was moved by the defragmentation.
+         *
+         * @param allocation The allocation of the buffer
+         * @return           The buffer handle or null if the allocation isn't registered
+         * @author           Cedric Hammes
+         * @since            18/10/2026
+         */
+        [[nodiscard]] auto get_buffer(VmaAllocation allocation) const noexcept -> VkBuffer;
+
+        /**
+         * This function continues the defragmentation until the time budget is exhausted, the copies of the submitted
+         * pass aren't complete yet, the old buffers of a pass wait for the frames in flight or the defragmentation is
+         * complete. A new defragmentation is started if no defragmentation is running. This should be called once per
+         * frame after the frame waited for its last submission. The registered buffers must not be written by the GPU
+         * while a defragmentation is running, because the writes during the copies of a pass are lost.
+         *
+         * @param time_budget The time budget for the passes in this call
+         * @return            Whether the defragmentation is complete or an error
+         * @author            Cedric Hammes
+         * @since             18/10/2026
+         */
+        [[nodiscard]] auto run(std::chrono::microseconds time_budget) noexcept -> Result<bool>;
+
+        /**
+         * This function returns the fragmentation of the defragmented memory as ratio of the unused bytes in all
+         * memory blocks to the size of all memory blocks.
+         *
+         * @return The fragmentation between 0.0 and 1.0
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        [[nodiscard]] auto get_fragmentation() const noexcept -> float;
+
+        [[nodiscard]] inline auto is_running() const noexcept -> bool {
+            return _defragmentation_context != nullptr;
+        }
+
+        [[nodiscard]] inline auto get_statistics() const noexcept -> const DefragmentationStatistics& {
+            return _statistics;
+        }
+
+    private:
+        [[nodiscard]] auto begin_pass(std::chrono::steady_clock::time_point deadline) noexcept -> Result<bool>;
+        [[nodiscard]] auto end_pass() noexcept -> Result<bool>;
+        [[nodiscard]] auto record_moves(std::chrono::steady_clock::time_point deadline) noexcept -> Result<void>;
+        [[nodiscard]] auto submit_copies() noexcept -> Result<void>;
+        auto complete_moves() noexcept -> void;
+        auto destroy_retired_buffers() noexcept -> void;
+        auto discard_pass() noexcept -> void;
+        auto end_defragmentation() noexcept -> void;
+    };
+}// namespace erebos::render::vulkan
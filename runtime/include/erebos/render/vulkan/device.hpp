@@ -19,6 +19,7 @@
 
 #pragma once
 #include "erebos/render/vulkan/context.hpp"
+#include "erebos/render/vulkan/pipeline_layout.hpp"
 #include "erebos/render/vulkan/queue.hpp"
 #include "erebos/utils.hpp"
 #include <mimalloc.h>
@@ -26,6 +27,13 @@
 #include <vk_mem_alloc.h>
 
 namespace erebos::render::vulkan {
+    // The time domain of the host clock used by std::chrono::steady_clock, GPU timestamps are calibrated against it
+#ifdef PLATFORM_WINDOWS
+    constexpr auto host_time_domain = VK_TIME_DOMAIN_QUERY_PERFORMANCE_COUNTER_EXT;
+#else
+    constexpr auto host_time_domain = VK_TIME_DOMAIN_CLOCK_MONOTONIC_EXT;
+#endif
+
     class Device final {
         const VulkanContext* _context;
         VkPhysicalDevice _physical_device;
@@ -33,6 +41,10 @@ namespace erebos::render::vulkan {
         RpsDevice _rps_device;
         VmaAllocator _allocator;
         std::vector<Queue> _queues;
+        PipelineLayoutCache _pipeline_layout_cache;
+        bool _is_present_wait_supported;
+        bool _is_calibrated_timestamps_supported;
+        float _timestamp_period;
 
     public:
         /**
@@ -84,6 +96,26 @@ namespace erebos::render::vulkan {
             return _queues;
         }
 
+        /**
+         * This function returns the queue for graphics, compute and transfer commands. All other queues fall back to
+         * this queue's family if the device has no dedicated family for them.
+         *
+         * @return The direct queue
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        [[nodiscard]] inline auto get_direct_queue() const noexcept -> const Queue& {
+            return _queues[0];
+        }
+
+        [[nodiscard]] inline auto get_compute_queue() const noexcept -> const Queue& {
+            return _queues[1];
+        }
+
+        [[nodiscard]] inline auto get_transfer_queue() const noexcept -> const Queue& {
+            return _queues[2];
+        }
+
         /**
          * This function returns the handle of the device's physical device
          *
@@ -117,6 +149,53 @@ namespace erebos::render::vulkan {
             return _allocator;
         }
 
+        /**
+         * This function returns the device's cache of descriptor set layouts and pipeline layouts. Pipelines should
+         * acquire their layouts through this cache, so pipelines with the same layout share the layout handles.
+         *
+         * @return The device's pipeline layout cache
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        [[nodiscard]] inline auto get_pipeline_layout_cache() noexcept -> PipelineLayoutCache& {
+            return _pipeline_layout_cache;
+        }
+
+        /**
+         * This function returns whether the device was created with VK_KHR_present_id and VK_KHR_present_wait. These
+         * extensions are optional and only enabled if the device supports both of them.
+         *
+         * @return Whether present ids and present wait are usable
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        [[nodiscard]] inline auto is_present_wait_supported() const noexcept -> bool {
+            return _is_present_wait_supported;
+        }
+
+        /**
+         * This function returns whether the device was created with VK_EXT_calibrated_timestamps and supports the
+         * calibration of the device time domain against the host time domain.
+         *
+         * @return Whether GPU timestamps can be calibrated against the host clock
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        [[nodiscard]] inline auto is_calibrated_timestamps_supported() const noexcept -> bool {
+            return _is_calibrated_timestamps_supported;
+        }
+
+        /**
+         * This function returns the count of nanoseconds it takes for a timestamp query value to be incremented by one.
+         *
+         * @return The timestamp period in nanoseconds
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        [[nodiscard]] inline auto get_timestamp_period() const noexcept -> float {
+            return _timestamp_period;
+        }
+
         /**
          * This operator function returns the handle of the virtual device.
          *
@@ -18,46 +18,97 @@
  */
 
 #pragma once
+#include "erebos/memory/linear_arena.hpp"
 #include "erebos/render/vulkan/command.hpp"
 #include "erebos/render/vulkan/device.hpp"
+#include "erebos/render/vulkan/gpu_profiler.hpp"
 #include "erebos/render/vulkan/queue.hpp"
 #include "erebos/render/vulkan/sync/fence.hpp"
 #include "erebos/render/vulkan/sync/semaphore.hpp"
+#include <array>
+#include <memory>
 
 namespace erebos::render::vulkan {
     class QueueFrame final {
+        static constexpr usize COMMAND_BUFFER_ARENA_CHUNK_SIZE = 4096;
+
+        // The command buffer lists of a frame are allocated from an arena of the queue frame. The lists of the next
+        // frame are built in the other arena, so the arena of the last frame is released as a whole in begin_frame.
+        struct CommandBufferLists final {
+            memory::LinearArena arena;
+            std::pmr::vector<CommandBuffer> recording_command_buffers;
+            std::pmr::vector<CommandBuffer> cached_command_buffers;
+
+            CommandBufferLists() noexcept
+                : arena {COMMAND_BUFFER_ARENA_CHUNK_SIZE}
+                , recording_command_buffers {&arena}
+                , cached_command_buffers {&arena} {
+            }
+        };
+
         Device const* _device;
         sync::Semaphore _timeline_semaphore;
         CommandPool _command_pool;
-        std::vector<CommandBuffer> _recording_command_buffers;
-        std::vector<CommandBuffer> _cached_command_buffers;
+        std::unique_ptr<std::array<CommandBufferLists, 2>> _command_buffer_lists;
+        usize _command_buffer_list_index;
         Queue const* _queue;
+        GpuProfiler _profiler;
 
     public:
         QueueFrame(Device const& device, Queue const& queue)
             : _device(&device)
-            , _timeline_semaphore(device)
+            , _timeline_semaphore(device, false, "Queue Frame Timeline Semaphore")
             , _command_pool(device, queue.get_family_index())
+            , _command_buffer_lists(std::make_unique<std::array<CommandBufferLists, 2>>())
+            , _command_buffer_list_index(0)
             , _queue(&queue)
-            , _recording_command_buffers()
-            , _cached_command_buffers() {
+            , _profiler(device, queue) {
         }
         EREBOS_DEFAULT_MOVE(QueueFrame);
         EREBOS_DELETE_COPY(QueueFrame);
 
-        [[nodiscard]] auto acquire_command_buffer() noexcept -> Result<CommandBuffer*>;
+        [[nodiscard]] auto acquire_command_buffer() noexcept -> Result<CommandBuffer*, ErrorCode>;
+
+        /**
+         * This function moves all recorded command buffers into the cache of the next frame and releases the arena of
+         * the last frame. The command pool must be reset before, so the cached command buffers can be recorded again.
+         *
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        auto recycle_command_buffers() noexcept -> void;
 
-        [[nodiscard]] inline auto get_recording_command_buffers() noexcept -> std::vector<CommandBuffer>& {
-            return _recording_command_buffers;
+        [[nodiscard]] inline auto get_recording_command_buffers() noexcept -> std::pmr::vector<CommandBuffer>& {
+            return (*_command_buffer_lists)[_command_buffer_list_index].recording_command_buffers;
         }
 
-        [[nodiscard]] inline auto get_cached_command_buffers() noexcept -> std::vector<CommandBuffer>& {
-            return _cached_command_buffers;
+        /**
+         * This function returns the allocation statistics of the arena, which holds the command buffer lists of the
+         * current frame.
+         *
+         * @return The allocation statistics of the command buffer lists
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        [[nodiscard]] inline auto get_allocation_statistics() const noexcept -> const memory::AllocationStatistics& {
+            return (*_command_buffer_lists)[_command_buffer_list_index].arena.get_statistics();
         }
 
         [[nodiscard]] inline auto get_command_pool() const noexcept -> const CommandPool& {
             return _command_pool;
         }
+
+        /**
+         * This function returns the GPU profiler of this queue frame. The timings of the profiler are read back in
+         * begin_frame of the frame, so they belong to the last submission of this frame.
+         *
+         * @return The GPU profiler
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        [[nodiscard]] inline auto get_profiler() noexcept -> GpuProfiler& {
+            return _profiler;
+        }
     };
 
     class Frame final {
@@ -66,14 +117,16 @@ namespace erebos::render::vulkan {
         sync::Semaphore _rendering_done_semaphore;
         sync::Fence _queue_submit_fence;
         std::vector<QueueFrame> _queue_frames;
+        memory::AllocationStatistics _allocation_statistics;
 
     public:
         explicit Frame(Device const& device)
             : _device(&device)
-            , _image_acquired_semaphore(device)
-            , _rendering_done_semaphore(device)
-            , _queue_submit_fence(device, true)
-            , _queue_frames() {
+            , _image_acquired_semaphore(device, false, "Image Acquired Semaphore")
+            , _rendering_done_semaphore(device, false, "Rendering Done Semaphore")
+            , _queue_submit_fence(device, true, "Queue Submit Fence")
+            , _queue_frames()
+            , _allocation_statistics() {
             _queue_frames.reserve(device.get_queues().size());
             for(const auto& queue : device.get_queues()) {
                 _queue_frames.emplace_back(device, queue);
@@ -83,7 +136,45 @@ namespace erebos::render::vulkan {
         EREBOS_DEFAULT_MOVE(Frame);
         EREBOS_DELETE_COPY(Frame);
 
-        [[nodiscard]] auto begin_frame() noexcept -> Result<void>;
+        /**
+         * This function begins the frame by waiting for the last submission of this frame and resetting the command
+         * pools of all queues and the frame arena of the calling thread. All memory allocated from the frame arena is
+         * invalid after this call. The GPU timings of the last submission are read back after the wait, so the read
+         * back never stalls.
+         *
+         * @return Void or an error
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        [[nodiscard]] auto begin_frame() noexcept -> Result<void, ErrorCode>;
+
+        /**
+         * This function submits the recorded command buffers of the direct queue. The submission waits for the image
+         * acquired semaphore, signals the rendering done semaphore and the queue submit fence of this frame. Headless
+         * frames (like the replay of a capture) aren't presented, so they only signal the queue submit fence.
+         *
+         * @param is_presented Whether the frame is presented to the swapchain or not
+         * @return             Void or an error
+         * @author             Cedric Hammes
+         * @since              18/10/2026
+         */
+        [[nodiscard]] auto submit(bool is_presented = true) noexcept -> Result<void, ErrorCode>;
+
+        [[nodiscard]] inline auto get_queue_frames() noexcept -> std::vector<QueueFrame>& {
+            return _queue_frames;
+        }
+
+        /**
+         * This function returns the allocation statistics of the frame arena for the frame recorded before the last
+         * call of begin_frame. This can be used to observe the per-frame allocation rate.
+         *
+         * @return The allocation statistics of the last frame
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        [[nodiscard]] inline auto get_allocation_statistics() const noexcept -> const memory::AllocationStatistics& {
+            return _allocation_statistics;
+        }
 
         [[nodiscard]] inline auto get_image_acquired_semaphore() const noexcept -> const sync::Semaphore& {
             return _image_acquired_semaphore;
@@ -0,0 +1,214 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#pragma once
+#include "erebos/render/vulkan/command.hpp"
+#include "erebos/render/vulkan/device.hpp"
+#include <limits>
+#include <string_view>
+#include <vector>
+
+namespace erebos::render::vulkan {
+    namespace detail {
+        // Computes the signed distance between the timestamps, the bits above the valid bits of the timestamps are ignored
+        [[nodiscard]] constexpr auto get_timestamp_delta(const u64 timestamp, const u64 base_timestamp, const u32 valid_bits) noexcept
+            -> int64_t {
+            const auto shift = 64 - valid_bits;
+            return static_cast<int64_t>((timestamp - base_timestamp) << shift) >> shift;
+        }
+    }// namespace detail
+
+    /**
+     * This struct contains the GPU time of a profiled scope. If the profiler is calibrated, the begin and end are
+     * nanoseconds in the time domain of std::chrono::steady_clock, so they can be merged with CPU timings. Otherwise
+     * they are nanoseconds relative to the first timestamp of the frame.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    struct GpuTiming final {
+        std::string_view name;
+        u32 index;
+        u32 depth;
+        u64 begin;
+        u64 end;
+
+        [[nodiscard]] constexpr auto get_duration() const noexcept -> u64 {
+            return end - begin;
+        }
+    };
+
+    /**
+     * This class measures the GPU time of scopes in the command buffers of a queue frame with a timestamp query pool.
+     * The results are read back when the frame begins the next time, so the queries are already finished and the read
+     * back never stalls. With N frames in flight, the timings are N frames late. The profiler isn't thread-safe, all
+     * scopes of a frame have to be recorded by the same thread.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    class GpuProfiler final {
+        struct Scope final {
+            std::string_view name;
+            u32 index;
+            u32 depth;
+            u32 query_index;
+        };
+
+        const Device* _device;
+        VkQueryPool _query_pool;
+        u32 _query_capacity;
+        u32 _query_count;
+        u32 _depth;
+        u32 _timestamp_valid_bits;
+        std::vector<Scope> _scopes;
+        std::vector<u64> _query_results;
+        std::vector<GpuTiming> _timings;
+
+    public:
+        static constexpr u32 DEFAULT_SCOPE_CAPACITY = 256;
+        static constexpr u32 INVALID_SCOPE = std::numeric_limits<u32>::max();
+
+        /**
+         * This constructor creates the timestamp query pool for the specified queue. If the queue family doesn't
+         * support timestamps, no pool is created and all scopes are ignored.
+         *
+         * @param device         The device to create the query pool on
+         * @param queue          The queue the profiled command buffers are submitted to
+         * @param scope_capacity The maximum count of scopes per frame
+         * @author               Cedric Hammes
+         * @since                18/10/2026
+         */
+        GpuProfiler(const Device& device, const Queue& queue, u32 scope_capacity = DEFAULT_SCOPE_CAPACITY);
+        GpuProfiler(GpuProfiler&& other) noexcept;
+        ~GpuProfiler() noexcept;
+        EREBOS_DELETE_COPY(GpuProfiler);
+
+        /**
+         * This function writes the begin timestamp of a scope into the command buffer. If the query pool is full, the
+         * scope is ignored. In debug builds a label region with the name of the scope is opened in the command buffer,
+         * even if the scope is ignored.
+         *
+         * @param command_buffer The command buffer to write the timestamp into
+         * @param name           The name of the scope, it has to be valid until the timings are read back
+         * @param index          An additional index of the scope, like the command index of a render graph node
+         * @return               The scope or INVALID_SCOPE if the scope is ignored
+         * @author               Cedric Hammes
+         * @since                18/10/2026
+         */
+        [[nodiscard]] auto begin_scope(const CommandBuffer& command_buffer, std::string_view name, u32 index = 0) noexcept -> u32;
+
+        /**
+         * This function writes the end timestamp of the scope into the command buffer and closes the label region of
+         * the scope.
+         *
+         * @param command_buffer The command buffer to write the timestamp into
+         * @param scope          The scope returned by begin_scope
+         * @author               Cedric Hammes
+         * @since                18/10/2026
+         */
+        auto end_scope(const CommandBuffer& command_buffer, u32 scope) noexcept -> void;
+
+        /**
+         * This function records the commands of the specified batch of the RPS render graph into the command buffer.
+         * Every command is recorded separately and wrapped into its own scope named after the node, so every node of
+         * the render graph is timed.
+         *
+         * @param render_graph   The render graph to record
+         * @param command_buffer The command buffer to record the commands into
+         * @param frame_index    The index of the frame passed to RPS
+         * @param batch_index    The index of the command batch in the batch layout of the render graph
+         * @param user_context   The user context passed to the node callbacks
+         * @return               Void or an error
+         * @author               Cedric Hammes
+         * @since                18/10/2026
+         */
+        [[nodiscard]] auto record_render_graph(RpsRenderGraph render_graph,
+                                               const CommandBuffer& command_buffer,
+                                               u64 frame_index,
+                                               u32 batch_index,
+                                               void* user_context = nullptr) noexcept -> Result<void, ErrorCode>;
+
+        /**
+         * This function reads the timestamps of the last recorded frame back, converts them into timings and resets
+         * the query pool. This function has to be called after the submission of the frame has finished.
+         *
+         * @return Void or an error
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        [[nodiscard]] auto read_back() noexcept -> Result<void, ErrorCode>;
+
+        /**
+         * This function returns the timings of the last read back frame, sorted by the begin of the scopes.
+         *
+         * @return The timings of the last read back frame
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        [[nodiscard]] inline auto get_timings() const noexcept -> const std::vector<GpuTiming>& {
+            return _timings;
+        }
+
+        /**
+         * This function returns the GPU time of the last read back frame, from the begin of the first scope to the end
+         * of the last scope.
+         *
+         * @return The GPU time of the last read back frame in nanoseconds
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        [[nodiscard]] auto get_frame_duration() const noexcept -> u64;
+
+        [[nodiscard]] inline auto is_enabled() const noexcept -> bool {
+            return _query_pool != nullptr;
+        }
+
+        [[nodiscard]] inline auto is_calibrated() const noexcept -> bool {
+            return _device->is_calibrated_timestamps_supported();
+        }
+
+        auto operator=(GpuProfiler&& other) noexcept -> GpuProfiler&;
+    };
+
+    /**
+     * This class writes the begin timestamp of a scope on construction and the end timestamp on destruction.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    class GpuScope final {
+        GpuProfiler* _profiler;
+        const CommandBuffer* _command_buffer;
+        u32 _scope;
+
+    public:
+        GpuScope(GpuProfiler& profiler, const CommandBuffer& command_buffer, const std::string_view name) noexcept
+            : _profiler {&profiler}
+            , _command_buffer {&command_buffer}
+            , _scope {profiler.begin_scope(command_buffer, name)} {
+        }
+
+        ~GpuScope() noexcept {
+            _profiler->end_scope(*_command_buffer, _scope);
+        }
+
+        EREBOS_DELETE_COPY(GpuScope);
+    };
+}// namespace erebos::render::vulkan
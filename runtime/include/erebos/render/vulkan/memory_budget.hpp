@@ -0,0 +1,209 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#pragma once
+#include "erebos/result.hpp"
+#include "erebos/utils.hpp"
+#include <functional>
+#include <optional>
+#include <vk_mem_alloc.h>
+
+namespace erebos::render::vulkan {
+    enum class MemoryPressure : u8 {
+        LOW,
+        MEDIUM,
+        HIGH,
+        CRITICAL
+    };
+
+    struct HeapBudget final {
+        VkDeviceSize usage;
+        VkDeviceSize budget;
+        MemoryPressure pressure;
+    };
+
+    /**
+     * This callback is called when a streaming resource gets evicted. The callback must release the memory of the
+     * resource, the resource is already unregistered when the callback is called.
+     */
+    using EvictCallbackFunction = std::function<void(void* data)>;
+    using StreamingResourceHandle = u64;
+
+    /**
+     * This class tracks the memory usage of all heaps against the budget reported by VMA and evicts registered streaming
+     * resources in least-recently-used order, before an allocation would exceed the budget of a heap. The budget of every
+     * heap can be overridden, which allows to simulate low-memory devices. When the manager is created without an
+     * allocator, the usage of a heap is the size of all resident streaming resources in the heap.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    class MemoryBudgetManager final {
+        struct StreamingResource final {
+            StreamingResourceHandle handle;
+            u32 heap_index;
+            VkDeviceSize size;
+            u64 last_used_frame;
+            EvictCallbackFunction evict_callback;
+            void* data;
+        };
+
+        VmaAllocator _allocator;
+        u64 _frame_index;
+        std::vector<HeapBudget> _heap_budgets;
+        std::vector<std::optional<VkDeviceSize>> _budget_overrides;
+        std::vector<VkDeviceSize> _simulated_budgets;
+        std::vector<StreamingResource> _streaming_resources;
+        StreamingResourceHandle _next_resource_handle;
+        usize _evicted_resource_count;
+
+    public:
+        /**
+         * This constructor creates a budget manager for all heaps of the specified allocator. The allocator must be
+         * created with VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT to receive the budget of the driver.
+         *
+         * @param allocator The allocator to track the budget of
+         * @author          Cedric Hammes
+         * @since           18/10/2026
+         */
+        explicit MemoryBudgetManager(VmaAllocator allocator) noexcept;
+
+        /**
+         * This constructor creates a budget manager without a device, which simulates heaps with the specified
+         * budgets. The usage of the heaps is only based on the registered streaming resources.
+         *
+         * @param heap_budgets The budget of each simulated heap
+         * @author             Cedric Hammes
+         * @since              18/10/2026
+         */
+        explicit MemoryBudgetManager(std::vector<VkDeviceSize> heap_budgets) noexcept;
+        ~MemoryBudgetManager() noexcept = default;
+        EREBOS_DEFAULT_MOVE(MemoryBudgetManager);
+        EREBOS_DELETE_COPY(MemoryBudgetManager);
+
+        /**
+         * This function advances the frame index of the manager and the allocator and fetches the current usage and
+         * budget of all heaps. This should be called once per frame.
+         *
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        auto update() noexcept -> void;
+
+        /**
+         * This function overrides the budget of the specified heap with a smaller budget than reported by the driver.
+         * An empty override restores the budget of the driver.
+         *
+         * @param heap_index The index of the heap
+         * @param budget     The simulated budget of the heap
+         * @author           Cedric Hammes
+         * @since            18/10/2026
+         */
+        auto set_budget_override(u32 heap_index, std::optional<VkDeviceSize> budget) noexcept -> void;
+
+        /**
+         * This function registers a streaming resource, which can be evicted by the manager to free up memory in the
+         * specified heap. The resource is marked as used in the current frame.
+         *
+         * @param heap_index     The index of the heap the resource lives in
+         * @param size           The size of the resource's memory
+         * @param evict_callback The callback to release the resource
+         * @param data           The data passed to the callback
+         * @return               The handle of the registered resource or an error, if the heap doesn't exist
+         * @author               Cedric Hammes
+         * @since                18/10/2026
+         */
+        [[nodiscard]] auto register_resource(u32 heap_index, VkDeviceSize size, EvictCallbackFunction evict_callback, void* data) noexcept
+            -> Result<StreamingResourceHandle>;
+
+        /**
+         * This function unregisters the specified streaming resource without evicting it. This should be called when
+         * the resource is released by its owner.
+         *
+         * @param handle The handle of the resource
+         * @author       Cedric Hammes
+         * @since        18/10/2026
+         */
+        auto unregister_resource(StreamingResourceHandle handle) noexcept -> void;
+
+        /**
+         * This function marks the specified streaming resource as used in the current frame, so it gets evicted after
+         * all resources which weren't used since.
+         *
+         * @param handle The handle of the resource
+         * @author       Cedric Hammes
+         * @since        18/10/2026
+         */
+        auto touch(StreamingResourceHandle handle) noexcept -> void;
+
+        /**
+         * This function ensures that an allocation of the specified size fits into the budget of the heap. If that's
+         * not the case, the least recently used streaming resources of the heap are evicted until their sizes cover the
+         * missing bytes. Resources used in the current frame are never evicted. If the allocation doesn't fit even after
+         * evicting all candidates, nothing is evicted and this function returns an error.
+         *
+         * @param heap_index The index of the heap
+         * @param size       The size of the planned allocation
+         * @return           Void or an error
+         * @author           Cedric Hammes
+         * @since            18/10/2026
+         */
+        [[nodiscard]] auto ensure_budget(u32 heap_index, VkDeviceSize size) noexcept -> Result<void>;
+
+        /**
+         * This function returns the index of the heap, in which the specified memory type lives. Without an allocator,
+         * every memory type is mapped to the heap with the same index.
+         *
+         * @param memory_type_index The index of the memory type
+         * @return                  The index of the heap or an error, if the memory type doesn't exist
+         * @author                  Cedric Hammes
+         * @since                   18/10/2026
+         */
+        [[nodiscard]] auto get_heap_index(u32 memory_type_index) const noexcept -> Result<u32>;
+
+        /**
+         * This function returns the memory pressure of the specified heap.
+         *
+         * @param heap_index The index of the heap
+         * @return           The memory pressure of the heap or an error, if the heap doesn't exist
+         * @author           Cedric Hammes
+         * @since            18/10/2026
+         */
+        [[nodiscard]] auto get_pressure(u32 heap_index) const noexcept -> Result<MemoryPressure>;
+
+        [[nodiscard]] inline auto get_heap_budgets() const noexcept -> const std::vector<HeapBudget>& {
+            return _heap_budgets;
+        }
+
+        [[nodiscard]] inline auto get_streaming_resource_count() const noexcept -> usize {
+            return _streaming_resources.size();
+        }
+
+        [[nodiscard]] inline auto get_evicted_resource_count() const noexcept -> usize {
+            return _evicted_resource_count;
+        }
+
+        [[nodiscard]] inline auto get_frame_index() const noexcept -> u64 {
+            return _frame_index;
+        }
+
+    private:
+        auto update_heap_budgets() noexcept -> void;
+    };
+}// namespace erebos::render::vulkan
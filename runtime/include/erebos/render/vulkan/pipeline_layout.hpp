@@ -0,0 +1,167 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#pragma once
+#include "erebos/result.hpp"
+#include "erebos/utils.hpp"
+#include <initializer_list>
+#include <span>
+#include <unordered_map>
+#include <volk.h>
+
+namespace erebos::render::vulkan {
+    /**
+     * This structure describes the layout of a single descriptor set. The bindings are always sorted by their binding
+     * index, so two equal layouts are also equal in their memory representation and hash.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    struct DescriptorSetLayoutInfo final {
+        std::vector<VkDescriptorSetLayoutBinding> bindings;
+
+        [[nodiscard]] auto operator==(const DescriptorSetLayoutInfo& other) const noexcept -> bool;
+    };
+
+    /**
+     * This structure describes the layout of a pipeline. The descriptor set layouts are indexed by their set number, so
+     * sets that are not used by any shader stage are represented by an empty descriptor set layout.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    struct PipelineLayoutInfo final {
+        std::vector<DescriptorSetLayoutInfo> sets;
+        std::vector<VkPushConstantRange> push_constant_ranges;
+
+        [[nodiscard]] auto operator==(const PipelineLayoutInfo& other) const noexcept -> bool;
+    };
+
+    struct DescriptorSetLayoutInfoHash final {
+        [[nodiscard]] auto operator()(const DescriptorSetLayoutInfo& info) const noexcept -> usize;
+    };
+
+    /**
+     * This function reflects the specified SPIR-V module with SPIRV-Reflect and derives the descriptor set layouts and
+     * push constant ranges of the module's shader stage from it.
+     *
+     * @param spirv_code The code of the SPIR-V module
+     * @return           The pipeline layout info of the module or an error
+     * @author           Cedric Hammes
+     * @since            18/10/2026
+     */
+    [[nodiscard]] auto reflect_pipeline_layout(std::span<const u32> spirv_code) noexcept -> Result<PipelineLayoutInfo>;
+
+    /**
+     * This function merges the layout of the source into the target layout. Bindings which are used by multiple stages
+     * are combined into one binding with the stage flags of all stages. All push constant ranges are merged into a
+     * single range, which covers all ranges and is visible to all stages. If a binding is declared with different
+     * descriptor types in the layouts, this function returns an error.
+     *
+     * @param target The layout to merge into
+     * @param source The layout to merge from
+     * @return       Void or an error
+     * @author       Cedric Hammes
+     * @since        18/10/2026
+     */
+    [[nodiscard]] auto merge_pipeline_layouts(PipelineLayoutInfo& target, const PipelineLayoutInfo& source) noexcept -> Result<void>;
+
+    /**
+     * This class is a hash-consed cache of descriptor set layouts and pipeline layouts. Equal layout descriptions share
+     * one Vulkan handle, which is owned by the cache and destroyed with it. This cache is not thread-safe.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    class PipelineLayoutCache final {
+        struct PipelineLayoutKey final {
+            std::vector<VkDescriptorSetLayout> set_layouts;
+            std::vector<VkPushConstantRange> push_constant_ranges;
+
+            [[nodiscard]] auto operator==(const PipelineLayoutKey& other) const noexcept -> bool;
+        };
+
+        struct PipelineLayoutKeyHash final {
+            [[nodiscard]] auto operator()(const PipelineLayoutKey& key) const noexcept -> usize;
+        };
+
+        VkDevice _device;
+        std::unordered_map<DescriptorSetLayoutInfo, VkDescriptorSetLayout, DescriptorSetLayoutInfoHash> _descriptor_set_layouts;
+        std::unordered_map<PipelineLayoutKey, VkPipelineLayout, PipelineLayoutKeyHash> _pipeline_layouts;
+
+    public:
+        explicit PipelineLayoutCache(VkDevice device) noexcept;
+        PipelineLayoutCache(PipelineLayoutCache&& other) noexcept;
+        ~PipelineLayoutCache() noexcept;
+        EREBOS_DELETE_COPY(PipelineLayoutCache);
+        auto operator=(PipelineLayoutCache&& other) noexcept -> PipelineLayoutCache&;
+
+        /**
+         * This function returns the descriptor set layout for the specified description. If there is no cached layout
+         * with the same description, the layout gets created and inserted into the cache.
+         *
+         * @param info The description of the descriptor set layout
+         * @return     The descriptor set layout or an error
+         * @author     Cedric Hammes
+         * @since      18/10/2026
+         */
+        [[nodiscard]] auto get_descriptor_set_layout(const DescriptorSetLayoutInfo& info) noexcept -> Result<VkDescriptorSetLayout>;
+
+        /**
+         * This function returns the pipeline layout for the specified description. If there is no cached layout with
+         * the same description, the layout (and all missing descriptor set layouts) gets created and inserted into the
+         * cache.
+         *
+         * @param info The description of the pipeline layout
+         * @return     The pipeline layout or an error
+         * @author     Cedric Hammes
+         * @since      18/10/2026
+         */
+        [[nodiscard]] auto get_pipeline_layout(const PipelineLayoutInfo& info) noexcept -> Result<VkPipelineLayout>;
+
+        /**
+         * This function reflects all specified SPIR-V modules, merges their layouts and returns the pipeline layout for
+         * the merged description.
+         *
+         * @param spirv_modules The code of all SPIR-V modules used by the pipeline
+         * @return              The pipeline layout or an error
+         * @author              Cedric Hammes
+         * @since               18/10/2026
+         */
+        [[nodiscard]] auto get_pipeline_layout(std::initializer_list<std::span<const u32>> spirv_modules) noexcept
+            -> Result<VkPipelineLayout>;
+
+        /**
+         * This function destroys all cached layouts. All handles, which were returned by this cache, are invalid after
+         * this call.
+         *
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        auto clear() noexcept -> void;
+
+        [[nodiscard]] inline auto get_descriptor_set_layout_count() const noexcept -> usize {
+            return _descriptor_set_layouts.size();
+        }
+
+        [[nodiscard]] inline auto get_pipeline_layout_count() const noexcept -> usize {
+            return _pipeline_layouts.size();
+        }
+    };
+}// namespace erebos::render::vulkan
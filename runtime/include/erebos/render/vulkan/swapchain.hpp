@@ -0,0 +1,221 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#pragma once
+#include "erebos/render/vulkan/device.hpp"
+#include "erebos/render/vulkan/queue.hpp"
+#include "erebos/render/vulkan/sync/fence.hpp"
+#include "erebos/render/vulkan/sync/semaphore.hpp"
+#include <chrono>
+#include <optional>
+#include <span>
+
+namespace erebos::render::vulkan {
+    enum class PresentMode : u8 {
+        MAILBOX,
+        IMMEDIATE,
+        FIFO,
+        FIFO_RELAXED
+    };
+
+    /**
+     * This structure configures the swapchain. The first supported present mode of the preferred present modes is
+     * used, FIFO is used as fallback because every device supports it. The image count is clamped to the limits of the
+     * surface. The maximum frame latency is the count of presents, which can be queued before the swapchain waits for a
+     * present to be displayed. This is only used when the device supports present wait.
+     */
+    struct SwapchainConfig final {
+        std::vector<PresentMode> preferred_present_modes {PresentMode::MAILBOX, PresentMode::FIFO};
+        u32 image_count {3};
+        u32 max_frame_latency {1};
+    };
+
+    /**
+     * The statistics of the input-to-photon latency. With present wait, the latency is measured until the present of
+     * the frame was displayed. Without present wait, the latency is measured until the frame was queued for presentation.
+     */
+    struct LatencyStatistics final {
+        std::chrono::microseconds last;
+        std::chrono::microseconds average;
+        std::chrono::microseconds max;
+        usize sample_count;
+        bool is_photon_latency;
+    };
+
+    namespace detail {
+        // Returns the first supported present mode of the preferred present modes or FIFO, which is always supported
+        [[nodiscard]] auto select_present_mode(std::span<const VkPresentModeKHR> supported_present_modes,
+                                               std::span<const PresentMode> preferred_present_modes) noexcept -> VkPresentModeKHR;
+
+        // Clamps the requested image count into the limits of the surface, a maximum of zero means there is no maximum
+        [[nodiscard]] auto clamp_image_count(u32 image_count, const VkSurfaceCapabilitiesKHR& surface_capabilities) noexcept -> u32;
+
+        // Returns the present ID to wait for to keep the frame latency or zero, if the present ID wasn't presented to the
+        // current swapchain. The first present ID is the first ID presented after the last recreation.
+        [[nodiscard]] auto get_latency_wait_present_id(u64 present_id, u64 first_present_id, u32 max_frame_latency) noexcept -> u64;
+    }// namespace detail
+
+    /**
+     * This class wraps the swapchain of the Vulkan context's surface. When the swapchain gets recreated, the old
+     * swapchain is passed to the new swapchain and retired instead of waiting for the device. An empty submission with
+     * a fence is queued on the present queue when a swapchain is retired. The retired swapchain is destroyed after the
+     * fence was signaled and, with present wait, after its last present was completed.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    class Swapchain final {
+        struct RetiredSwapchain final {
+            VkSwapchainKHR swapchain;
+            std::vector<VkImageView> image_views;
+            sync::Fence retire_fence;
+            u64 last_present_id;
+        };
+
+        struct PendingPresent final {
+            u64 present_id;
+            std::chrono::steady_clock::time_point input_time;
+        };
+
+        const Device* _device;
+        SwapchainConfig _config;
+        VkSurfaceFormatKHR _surface_format;
+        VkPresentModeKHR _present_mode;
+        VkExtent2D _extent;
+        VkSwapchainKHR _swapchain_handle;
+        std::vector<VkImage> _images;
+        std::vector<VkImageView> _image_views;
+        std::vector<RetiredSwapchain> _retired_swapchains;
+        std::vector<PendingPresent> _pending_presents;
+        const Queue* _present_queue;
+        u64 _present_id;
+        u64 _first_present_id;
+        bool _is_outdated;
+        LatencyStatistics _latency_statistics;
+
+    public:
+        /**
+         * This constructor creates the swapchain for the surface of the device's Vulkan context with the size of the
+         * context's window.
+         *
+         * @param device         The device to create the swapchain on
+         * @param surface_format The format of the swapchain images
+         * @param config         The configuration of the swapchain
+         * @author               Cedric Hammes
+         * @since                18/10/2026
+         */
+        Swapchain(const Device& device, VkSurfaceFormatKHR surface_format, SwapchainConfig config = {});
+        Swapchain(Swapchain&& other) noexcept;
+        ~Swapchain() noexcept;
+        EREBOS_DELETE_COPY(Swapchain);
+        auto operator=(Swapchain&& other) noexcept -> Swapchain&;
+
+        /**
+         * This function acquires the next image of the swapchain and signals the specified semaphore when the image is
+         * ready. If the swapchain is out of date, the option is empty and the swapchain must be recreated.
+         *
+         * @param image_acquired_semaphore The semaphore to signal
+         * @return                         The index of the acquired image, nothing or an error
+         * @author                         Cedric Hammes
+         * @since                          18/10/2026
+         */
+        [[nodiscard]] auto acquire_next_image(const sync::Semaphore& image_acquired_semaphore) noexcept -> Result<std::optional<u32>>;
+
+        /**
+         * This function queues the specified image for presentation after the semaphore was signaled. If the input
+         * time is specified, the latency from the input to the present is recorded in the latency statistics.
+         *
+         * @param queue          The queue to present on
+         * @param image_index    The index of the image to present
+         * @param wait_semaphore The semaphore signaled when the rendering is done
+         * @param input_time     The time of the oldest input handled in this frame
+         * @return               Void or an error
+         * @author               Cedric Hammes
+         * @since                18/10/2026
+         */
+        [[nodiscard]] auto present(const Queue& queue,
+                                   u32 image_index,
+                                   const sync::Semaphore& wait_semaphore,
+                                   std::optional<std::chrono::steady_clock::time_point> input_time = {}) noexcept -> Result<void>;
+
+        /**
+         * This function waits until no more than the maximum frame latency presents are queued. This should be called
+         * before the input of the next frame is sampled, so the input is as fresh as possible when the frame gets
+         * displayed. Without present wait, this function only collects the completed presents.
+         *
+         * @param timeout The maximum time to wait
+         * @return        Void or an error
+         * @author        Cedric Hammes
+         * @since         18/10/2026
+         */
+        [[nodiscard]] auto wait_for_frame_latency(std::chrono::nanoseconds timeout = std::chrono::milliseconds {100}) noexcept
+            -> Result<void>;
+
+        /**
+         * This function recreates the swapchain with the specified size. The old swapchain is retired and destroyed
+         * later, so this doesn't wait for the device. If the size is zero (e.g. the window is minimized), the swapchain
+         * stays out of date.
+         *
+         * @param extent The new size of the swapchain images
+         * @return       Void or an error
+         * @author       Cedric Hammes
+         * @since        18/10/2026
+         */
+        [[nodiscard]] auto recreate(VkExtent2D extent) noexcept -> Result<void>;
+
+        [[nodiscard]] inline auto is_outdated() const noexcept -> bool {
+            return _is_outdated;
+        }
+
+        [[nodiscard]] inline auto get_extent() const noexcept -> VkExtent2D {
+            return _extent;
+        }
+
+        [[nodiscard]] inline auto get_images() const noexcept -> const std::vector<VkImage>& {
+            return _images;
+        }
+
+        [[nodiscard]] inline auto get_image_views() const noexcept -> const std::vector<VkImageView>& {
+            return _image_views;
+        }
+
+        [[nodiscard]] inline auto get_surface_format() const noexcept -> VkSurfaceFormatKHR {
+            return _surface_format;
+        }
+
+        [[nodiscard]] inline auto get_present_mode() const noexcept -> VkPresentModeKHR {
+            return _present_mode;
+        }
+
+        [[nodiscard]] inline auto get_latency_statistics() const noexcept -> const LatencyStatistics& {
+            return _latency_statistics;
+        }
+
+        [[nodiscard]] inline auto operator*() const noexcept -> VkSwapchainKHR {
+            return _swapchain_handle;
+        }
+
+    private:
+        [[nodiscard]] auto create(VkExtent2D extent) noexcept -> Result<void>;
+        auto collect_completed_presents() noexcept -> void;
+        [[nodiscard]] auto is_retired_swapchain_unused(const RetiredSwapchain& retired_swapchain) const noexcept -> bool;
+        auto record_latency(std::chrono::steady_clock::duration latency) noexcept -> void;
+        auto destroy_image_views(std::vector<VkImageView>& image_views) const noexcept -> void;
+    };
+}// namespace erebos::render::vulkan
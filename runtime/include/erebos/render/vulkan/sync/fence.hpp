@@ -18,6 +18,8 @@
  */
 
 #pragma once
+#include "erebos/profiler.hpp"
+#include "erebos/render/vulkan/debug_utils.hpp"
 #include "erebos/render/vulkan/device.hpp"
 
 namespace erebos::render::vulkan::sync {
@@ -35,14 +37,15 @@ namespace erebos::render::vulkan::sync {
     public:
         /**
          * Initialize the fence (and set it signaled if flag was set) and stores a pointer of the device in the fence
-         * itself.
+         * itself. In debug builds the fence is named with the specified name.
          *
          * @param device      Reference to the device
          * @param is_signaled Whether set the fence already signaled or not
+         * @param name        The debug name of the fence
          * @author            Cedric Hammes
          * @since             28/03/2024
          */
-        explicit Fence(const Device& device, const bool is_signaled = false)
+        explicit Fence(const Device& device, const bool is_signaled = false, const std::string_view name = "Fence")
             : _device(&device)
             , _handle() {
             VkFenceCreateInfo fence_create_info {};
@@ -51,6 +54,7 @@ namespace erebos::render::vulkan::sync {
             if(const auto error = ::vkCreateFence(**_device, &fence_create_info, nullptr, &_handle); error != VK_SUCCESS) {
                 throw std::runtime_error(fmt::format("Unable to create fence: {}", vk_strerror(error)));
             }
+            set_object_name(**_device, _handle, "{}", name);
         }
 
         Fence(Fence&& other) noexcept
@@ -62,6 +66,19 @@ namespace erebos::render::vulkan::sync {
 
         EREBOS_DELETE_COPY(Fence);
 
+        /**
+         * This destructor destroys the fence if the handle is valid
+         *
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        ~Fence() noexcept {
+            if(_handle != nullptr) {
+                ::vkDestroyFence(**_device, _handle, nullptr);
+                _handle = nullptr;
+            }
+        }
+
         /**
          * This function awaits the semaphore to be signaled as indicator that a task ended etc. If the timeout exceeds
          * this
@@ -75,17 +92,48 @@ namespace erebos::render::vulkan::sync {
          * @since          28/03/2024
          */
         // clang-format off
-        template<typename TRep = std::int64_t, typename TPeriod = std::ratio<std::numeric_limits<TRep>::max()>>
+        template<typename TRep = std::int64_t, typename TPeriod = std::nano>
         [[nodiscard]] auto wait(const std::chrono::duration<TRep, TPeriod> timeout = std::chrono::duration<TRep, TPeriod>::max())
-            const noexcept -> Result<void> {
-            constexpr auto timeout_millis = std::chrono::duration_cast<std::chrono::milliseconds>(timeout).count();
-            if(const auto error = ::vkWaitForFences(_device, 1, &_handle, true, timeout_millis)) {
-                return Error(fmt::format("Unable to wait for fence to be signaled: {}", vk_strerror(error)));
+            const noexcept -> Result<void, ErrorCode> {
+            EREBOS_PROFILE_SCOPE("vkWaitForFences");
+            const auto timeout_nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(timeout).count();
+            if(const auto error = ::vkWaitForFences(**_device, 1, &_handle, true, static_cast<std::uint64_t>(timeout_nanos)); error != VK_SUCCESS) {
+                return Error(ErrorCode {ErrorKind::WAIT_FOR_FENCE, error});
             }
             return {};
         }
         // clang-format on
 
+        /**
+         * This function resets the fence into the unsignaled state, so it can be reused for another submission.
+         *
+         * @return Void or an error
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        /**
+         * This function returns whether the fence is signaled without waiting for it, so the completion of a
+         * submission can be polled across frames.
+         *
+         * @return Whether the fence is signaled or an error
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        [[nodiscard]] auto is_signaled() const noexcept -> Result<bool, ErrorCode> {
+            const auto status = ::vkGetFenceStatus(**_device, _handle);
+            if(status != VK_SUCCESS && status != VK_NOT_READY) {
+                return Error(ErrorCode {ErrorKind::GET_FENCE_STATUS, status});
+            }
+            return status == VK_SUCCESS;
+        }
+
+        [[nodiscard]] auto reset() const noexcept -> Result<void, ErrorCode> {
+            if(const auto error = ::vkResetFences(**_device, 1, &_handle); error != VK_SUCCESS) {
+                return Error(ErrorCode {ErrorKind::RESET_FENCE, error});
+            }
+            return {};
+        }
+
         auto operator=(Fence&& other) noexcept -> Fence& {
             _device = other._device;
             _handle = other._handle;
@@ -18,6 +18,7 @@
  */
 
 #pragma once
+#include "erebos/render/vulkan/debug_utils.hpp"
 #include "erebos/render/vulkan/device.hpp"
 
 namespace erebos::render::vulkan::sync {
@@ -28,19 +29,20 @@ namespace erebos::render::vulkan::sync {
     public:
         /**
          * Initialize the semaphore (as timeline semaphore if is_timeline is set to true) and set the device pointer
-         * internally.
+         * internally. In debug builds the semaphore is named with the specified name.
          *
          * @param device      Reference to the device
          * @param is_timeline Whether this semaphore is a timeline semaphore
+         * @param name        The debug name of the semaphore
          * @author            Cedric Hammes
          * @since             28/03/2024
          */
-        Semaphore(const Device& device, const bool is_timeline = false)
+        Semaphore(const Device& device, const bool is_timeline = false, const std::string_view name = "Semaphore")
             : _device(&device)
             , _handle() {
             VkSemaphoreCreateInfo semaphore_create_info {};
+            VkSemaphoreTypeCreateInfo semaphore_type_create_info {};
             if(is_timeline) {
-                VkSemaphoreTypeCreateInfo semaphore_type_create_info {};
                 semaphore_type_create_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
                 semaphore_type_create_info.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
                 semaphore_type_create_info.initialValue = 0;
@@ -50,6 +52,7 @@ namespace erebos::render::vulkan::sync {
             if (const auto error = ::vkCreateSemaphore(**_device, &semaphore_create_info, nullptr, &_handle); error != VK_SUCCESS) {
                 throw std::runtime_error(fmt::format("Unable to create semaphore: {}", vk_strerror(error)));
             }
+            set_object_name(**_device, _handle, "{}", name);
         }
 
         Semaphore(Semaphore&& other) noexcept
@@ -59,6 +62,19 @@ namespace erebos::render::vulkan::sync {
             other._handle = nullptr;
         }
 
+        /**
+         * This destructor destroys the semaphore if the handle is valid
+         *
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        ~Semaphore() noexcept {
+            if(_handle != nullptr) {
+                ::vkDestroySemaphore(**_device, _handle, nullptr);
+                _handle = nullptr;
+            }
+        }
+
         EREBOS_DELETE_COPY(Semaphore);
 
         auto operator=(Semaphore&& other) noexcept -> Semaphore& {
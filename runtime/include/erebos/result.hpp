@@ -20,10 +20,142 @@
 #pragma once
 #include "erebos/utils.hpp"
 #include <cassert>
+#include <fmt/format.h>
+#include <functional>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <variant>
 
+#define EREBOS_RESULT_CONCAT_IMPL(a, b) a##b
+#define EREBOS_RESULT_CONCAT(a, b)      EREBOS_RESULT_CONCAT_IMPL(a, b)
+
+/**
+ * This macro evaluates the expression and returns the moved error from the calling function, if the result of the
+ * expression is an error.
+ */
+#define EREBOS_TRY(...)                                                                                       \
+    if(auto&& EREBOS_RESULT_CONCAT(_erebos_result_, __LINE__) = (__VA_ARGS__);                                \
+       EREBOS_RESULT_CONCAT(_erebos_result_, __LINE__).is_error()) [[unlikely]] {                             \
+        return ::erebos::Error(std::move(EREBOS_RESULT_CONCAT(_erebos_result_, __LINE__).get_error()));       \
+    }
+
+/**
+ * This macro evaluates the expression and moves the value of the result into the target (e.g. a new variable). If the
+ * result of the expression is an error, the moved error is returned from the calling function.
+ */
+#define EREBOS_TRY_ASSIGN(target, ...)                                                                        \
+    auto&& EREBOS_RESULT_CONCAT(_erebos_result_, __LINE__) = (__VA_ARGS__);                                   \
+    if(EREBOS_RESULT_CONCAT(_erebos_result_, __LINE__).is_error()) [[unlikely]] {                             \
+        return ::erebos::Error(std::move(EREBOS_RESULT_CONCAT(_erebos_result_, __LINE__).get_error()));       \
+    }                                                                                                         \
+    target = std::move(*EREBOS_RESULT_CONCAT(_erebos_result_, __LINE__))
+
 namespace erebos {
+    /**
+     * The kind of an error code describes the operation which failed. The reason of the failure is stored as Vulkan
+     * result in the error code, if the operation is a Vulkan call.
+     */
+    enum class ErrorKind : u32 {
+        NONE = 0,
+        UNKNOWN,
+        BEGIN_COMMAND_BUFFER,
+        END_COMMAND_BUFFER,
+        ALLOCATE_COMMAND_BUFFERS,
+        RESET_COMMAND_POOL,
+        WAIT_FOR_FENCE,
+        GET_FENCE_STATUS,
+        RESET_FENCE,
+        SUBMIT_QUEUE,
+        GET_QUERY_POOL_RESULTS,
+        GET_CALIBRATED_TIMESTAMPS,
+        RECORD_RENDER_GRAPH
+    };
+
+    [[nodiscard]] constexpr auto get_error_kind_message(const ErrorKind kind) noexcept -> std::string_view {
+        switch(kind) {
+            case ErrorKind::NONE:
+                return "No error";
+            case ErrorKind::BEGIN_COMMAND_BUFFER:
+                return "Unable to begin command buffer";
+            case ErrorKind::END_COMMAND_BUFFER:
+                return "Unable to end command buffer";
+            case ErrorKind::ALLOCATE_COMMAND_BUFFERS:
+                return "Unable to allocate command buffers";
+            case ErrorKind::RESET_COMMAND_POOL:
+                return "Unable to reset command pool";
+            case ErrorKind::WAIT_FOR_FENCE:
+                return "Unable to wait for fence to be signaled";
+            case ErrorKind::GET_FENCE_STATUS:
+                return "Unable to get status of fence";
+            case ErrorKind::RESET_FENCE:
+                return "Unable to reset fence";
+            case ErrorKind::SUBMIT_QUEUE:
+                return "Unable to submit to queue";
+            case ErrorKind::GET_QUERY_POOL_RESULTS:
+                return "Unable to get query pool results";
+            case ErrorKind::GET_CALIBRATED_TIMESTAMPS:
+                return "Unable to get calibrated timestamps";
+            case ErrorKind::RECORD_RENDER_GRAPH:
+                return "Unable to record render graph commands";
+            default:
+                return "Unknown error";
+        }
+    }
+
+    /**
+     * This class is a compact and trivially copyable error, which fits into a single register. The message of the error
+     * is only formatted when it's requested, so the creation of the error never allocates. The error kind NONE is never
+     * a valid error, so Result<void, ErrorCode> uses it to represent the success without additional storage.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    class ErrorCode final {
+        ErrorKind _kind;
+        VkResult _vk_result;
+
+    public:
+        constexpr ErrorCode() noexcept
+            : _kind {ErrorKind::NONE}
+            , _vk_result {VK_SUCCESS} {
+        }
+
+        constexpr ErrorCode(const ErrorKind kind, const VkResult vk_result = VK_SUCCESS) noexcept// NOLINT(google-explicit-constructor)
+            : _kind {kind}
+            , _vk_result {vk_result} {
+        }
+
+        /**
+         * This function formats the message of the error. The message contains the failed operation and the reason of
+         * the failure, if the error has a Vulkan result.
+         *
+         * @return The message of the error
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        [[nodiscard]] auto get_message() const -> std::string {
+            if(_vk_result == VK_SUCCESS) {
+                return std::string {get_error_kind_message(_kind)};
+            }
+            return fmt::format("{}: {}", get_error_kind_message(_kind), vk_strerror(_vk_result));
+        }
+
+        [[nodiscard]] constexpr auto get_kind() const noexcept -> ErrorKind {
+            return _kind;
+        }
+
+        [[nodiscard]] constexpr auto get_vk_result() const noexcept -> VkResult {
+            return _vk_result;
+        }
+
+        [[nodiscard]] explicit operator std::string() const {
+            return get_message();
+        }
+
+        [[nodiscard]] constexpr auto operator==(const ErrorCode& other) const noexcept -> bool = default;
+    };
+
     template<typename T>
     class Error final {
         using value_type = T;
@@ -33,11 +165,26 @@ namespace erebos {
 
     public:
         // clang-format off
-        constexpr explicit Error(T value) : _value {std::forward<T>(value)} {}
+        constexpr explicit Error(T value) : _value {std::move(value)} {}
         ~Error() noexcept = default;
         // clang-format on
-        EREBOS_DEFAULT_MOVE(Error);
-        EREBOS_DELETE_COPY(Error);
+        constexpr Error(const Error& other) = default;
+        constexpr Error(Error&& other) noexcept = default;
+        constexpr auto operator=(const Error& other) -> Error& = default;
+        constexpr auto operator=(Error&& other) noexcept -> Error& = default;
+
+        /**
+         * This constructor converts an error with another error type, e.g. an error code into an error message.
+         *
+         * @param other The error to convert
+         * @author      Cedric Hammes
+         * @since       18/10/2026
+         */
+        template<typename TOther>
+            requires(!std::is_same_v<TOther, T> && std::is_constructible_v<T, const TOther&>)
+        constexpr Error(const Error<TOther>& other)// NOLINT(google-explicit-constructor)
+            : _value {T(other.get())} {
+        }
 
         [[nodiscard]] constexpr auto get() const noexcept -> const T& {
             return _value;
@@ -65,12 +212,41 @@ namespace erebos {
 
     public:
         // clang-format off
-        constexpr Result(value_type value) : _value_or_error(std::forward<value_type>(value)) {}
-        constexpr Result(Error<TError> error) : _value_or_error(std::move(error)) {}
+        constexpr Result(value_type value) : _value_or_error(std::in_place_index<0>, std::move(value)) {}
+        constexpr Result(Error<TError> error) : _value_or_error(std::in_place_index<1>, std::move(error)) {}
         ~Result() noexcept = default;
         // clang-format on
-        EREBOS_DEFAULT_MOVE(Result);
-        EREBOS_DELETE_COPY(Result);
+        constexpr Result(const Result& other) = default;
+        constexpr Result(Result&& other) noexcept = default;
+        constexpr auto operator=(const Result& other) -> Result& = default;
+        constexpr auto operator=(Result&& other) noexcept -> Result& = default;
+
+        /**
+         * This constructor converts the error of another error type into the error type of this result.
+         *
+         * @param error The error to convert
+         * @author      Cedric Hammes
+         * @since       18/10/2026
+         */
+        template<typename TOtherError>
+            requires(!std::is_same_v<TOtherError, TError> && std::is_constructible_v<TError, const TOtherError&>)
+        constexpr Result(const Error<TOtherError>& error)// NOLINT(google-explicit-constructor)
+            : _value_or_error(std::in_place_index<1>, error_type_wrapper {error}) {
+        }
+
+        /**
+         * This constructor converts a result with another error type into a result with the error type of this result.
+         *
+         * @param other The result to convert
+         * @author      Cedric Hammes
+         * @since       18/10/2026
+         */
+        template<typename TOtherError>
+            requires(!std::is_same_v<TOtherError, TError> && std::is_constructible_v<TError, const TOtherError&>)
+        constexpr Result(Result<T, TOtherError>&& other)// NOLINT(google-explicit-constructor)
+            : _value_or_error(other.is_ok() ? decltype(_value_or_error)(std::in_place_index<0>, std::move(other.get()))
+                                            : decltype(_value_or_error)(std::in_place_index<1>, error_type_wrapper {TError(other.get_error())})) {
+        }
 
         template<typename TNewValue>
         [[nodiscard]] constexpr auto forward() noexcept -> Result<TNewValue, TError> {
@@ -78,9 +254,131 @@ namespace erebos {
             return std::move(std::get<error_type_wrapper>(_value_or_error));
         }
 
-        template<typename TNewValue, typename F = std::function<TNewValue(T)>>
-        [[nodiscard]] constexpr auto map(F&& function) noexcept -> Result<TNewValue, TError> {
-            return is_ok() ? Result(std::forward(function(get()))) : Result(error_type_wrapper(get_error()));
+        /**
+         * This function maps the value of this result with the specified function. If this result is an error, the
+         * error is copied into the mapped result.
+         *
+         * @param function The function to map the value with
+         * @return         The mapped value or the error
+         * @author         Cedric Hammes
+         * @since          27/03/2024
+         */
+        template<typename F, typename TNewValue = std::invoke_result_t<F, const T&>>
+        [[nodiscard]] constexpr auto map(F&& function) const -> Result<TNewValue, TError> {
+            if(is_error()) [[unlikely]] {
+                return error_type_wrapper {get_error()};
+            }
+
+            if constexpr(std::is_void_v<TNewValue>) {
+                std::invoke(std::forward<F>(function), get());
+                return {};
+            }
+            else {
+                return std::invoke(std::forward<F>(function), get());
+            }
+        }
+
+        /**
+         * This function calls the specified function with the value and returns its result. If this result is an
+         * error, the error is moved into the returned result without calling the function.
+         *
+         * @param function The function returning the next result
+         * @return         The result of the function or the error
+         * @author         Cedric Hammes
+         * @since          18/10/2026
+         */
+        template<typename F, typename TNewResult = std::invoke_result_t<F, T&&>>
+        [[nodiscard]] constexpr auto and_then(F&& function) && -> TNewResult {
+            if(is_ok()) [[likely]] {
+                return std::invoke(std::forward<F>(function), std::move(get()));
+            }
+            return error_type_wrapper {std::move(get_error())};
+        }
+
+        template<typename F, typename TNewResult = std::invoke_result_t<F, const T&>>
+        [[nodiscard]] constexpr auto and_then(F&& function) const& -> TNewResult {
+            if(is_ok()) [[likely]] {
+                return std::invoke(std::forward<F>(function), get());
+            }
+            return error_type_wrapper {get_error()};
+        }
+
+        /**
+         * This function calls the specified function with the error and returns its result, e.g. to recover from the
+         * error. If this result is a value, the value is moved into the returned result.
+         *
+         * @param function The function handling the error
+         * @return         The value or the result of the function
+         * @author         Cedric Hammes
+         * @since          18/10/2026
+         */
+        template<typename F, typename TNewResult = std::invoke_result_t<F, TError&&>>
+        [[nodiscard]] constexpr auto or_else(F&& function) && -> TNewResult {
+            if(is_ok()) [[likely]] {
+                return std::move(get());
+            }
+            return std::invoke(std::forward<F>(function), std::move(get_error()));
+        }
+
+        template<typename F, typename TNewResult = std::invoke_result_t<F, const TError&>>
+        [[nodiscard]] constexpr auto or_else(F&& function) const& -> TNewResult {
+            if(is_ok()) [[likely]] {
+                return get();
+            }
+            return std::invoke(std::forward<F>(function), get_error());
+        }
+
+        /**
+         * This function transforms the value with the specified function. If this result is an error, the error is
+         * moved into the returned result.
+         *
+         * @param function The function transforming the value
+         * @return         The transformed value or the error
+         * @author         Cedric Hammes
+         * @since          18/10/2026
+         */
+        template<typename F, typename TNewValue = std::remove_cvref_t<std::invoke_result_t<F, T&&>>>
+        [[nodiscard]] constexpr auto transform(F&& function) && -> Result<TNewValue, TError> {
+            if(is_ok()) [[likely]] {
+                if constexpr(std::is_void_v<TNewValue>) {
+                    std::invoke(std::forward<F>(function), std::move(get()));
+                    return {};
+                }
+                else {
+                    return std::invoke(std::forward<F>(function), std::move(get()));
+                }
+            }
+            return error_type_wrapper {std::move(get_error())};
+        }
+
+        template<typename F, typename TNewValue = std::remove_cvref_t<std::invoke_result_t<F, const T&>>>
+        [[nodiscard]] constexpr auto transform(F&& function) const& -> Result<TNewValue, TError> {
+            return map(std::forward<F>(function));
+        }
+
+        /**
+         * This function transforms the error with the specified function. If this result is a value, the value is
+         * moved into the returned result.
+         *
+         * @param function The function transforming the error
+         * @return         The value or the transformed error
+         * @author         Cedric Hammes
+         * @since          18/10/2026
+         */
+        template<typename F, typename TNewError = std::remove_cvref_t<std::invoke_result_t<F, TError&&>>>
+        [[nodiscard]] constexpr auto transform_error(F&& function) && -> Result<T, TNewError> {
+            if(is_ok()) [[likely]] {
+                return std::move(get());
+            }
+            return Error<TNewError> {std::invoke(std::forward<F>(function), std::move(get_error()))};
+        }
+
+        template<typename F, typename TNewError = std::remove_cvref_t<std::invoke_result_t<F, const TError&>>>
+        [[nodiscard]] constexpr auto transform_error(F&& function) const& -> Result<T, TNewError> {
+            if(is_ok()) [[likely]] {
+                return get();
+            }
+            return Error<TNewError> {std::invoke(std::forward<F>(function), get_error())};
         }
 
         [[nodiscard]] constexpr auto move_or_throw() const -> T {
@@ -92,59 +390,173 @@ namespace erebos {
 
         [[nodiscard]] constexpr auto get() const noexcept -> const_reference {
             assert(is_ok());
-            return std::get<value_type>(_value_or_error);
+            return std::get<0>(_value_or_error);
         }
 
         [[nodiscard]] constexpr auto get() noexcept -> value_type& {
             assert(is_ok());
-            return std::get<value_type>(_value_or_error);
+            return std::get<0>(_value_or_error);
         }
 
         [[nodiscard]] constexpr auto is_ok() const noexcept -> bool {
-            return std::holds_alternative<value_type>(_value_or_error);
+            return _value_or_error.index() == 0;
         }
 
         [[nodiscard]] constexpr auto is_error() const noexcept -> bool {
             return !is_ok();
         }
 
-        [[nodiscard]] auto get_error() const noexcept -> const TError& {
+        [[nodiscard]] constexpr auto get_error() const noexcept -> const TError& {
             assert(!is_ok());
-            return std::get<error_type_wrapper>(_value_or_error).get();
+            return std::get<1>(_value_or_error).get();
         }
 
-        [[nodiscard]] auto get_error() noexcept -> TError& {
+        [[nodiscard]] constexpr auto get_error() noexcept -> TError& {
             assert(!is_ok());
-            return std::get<error_type_wrapper>(_value_or_error).get();
+            return std::get<1>(_value_or_error).get();
         }
 
-        [[nodiscard]] inline auto operator->() const noexcept -> const_pointer {
+        [[nodiscard]] constexpr auto operator->() const noexcept -> const_pointer {
             assert(is_ok());
-            return &std::get<value_type>(_value_or_error);
+            return &std::get<0>(_value_or_error);
         }
 
-        [[nodiscard]] inline auto operator->() noexcept -> pointer {
+        [[nodiscard]] constexpr auto operator->() noexcept -> pointer {
             assert(is_ok());
-            return &std::get<value_type>(_value_or_error);
+            return &std::get<0>(_value_or_error);
         }
 
-        [[nodiscard]] inline auto operator*() const noexcept -> const_reference {
+        [[nodiscard]] constexpr auto operator*() const noexcept -> const_reference {
             assert(is_ok());
-            return std::get<value_type>(_value_or_error);
+            return std::get<0>(_value_or_error);
         }
 
-        [[nodiscard]] inline auto operator*() noexcept -> reference {
+        [[nodiscard]] constexpr auto operator*() noexcept -> reference {
             assert(is_ok());
-            return std::get<value_type>(_value_or_error);
+            return std::get<0>(_value_or_error);
         }
 
-        [[nodiscard]] operator bool() const noexcept {
+        [[nodiscard]] constexpr operator bool() const noexcept {
             return is_ok();
         }
     };
 
+    namespace detail {
+        /**
+         * This class implements the monadic functions of the void results. The derived result must implement is_ok and
+         * get_error.
+         *
+         * @tparam TResult The derived result
+         * @tparam TError  The error type of the derived result
+         * @author         Cedric Hammes
+         * @since          18/10/2026
+         */
+        template<typename TResult, typename TError>
+        class VoidResultFunctions {
+        public:
+            /**
+             * This function calls the specified function and returns its result. If this result is an error, the
+             * error is moved into the returned result without calling the function.
+             *
+             * @param function The function returning the next result
+             * @return         The result of the function or the error
+             * @author         Cedric Hammes
+             * @since          18/10/2026
+             */
+            template<typename F, typename TNewResult = std::invoke_result_t<F>>
+            [[nodiscard]] constexpr auto and_then(F&& function) && -> TNewResult {
+                if(get_self().is_ok()) [[likely]] {
+                    return std::invoke(std::forward<F>(function));
+                }
+                return Error<TError> {std::move(get_self().get_error())};
+            }
+
+            template<typename F, typename TNewResult = std::invoke_result_t<F>>
+            [[nodiscard]] constexpr auto and_then(F&& function) const& -> TNewResult {
+                if(get_self().is_ok()) [[likely]] {
+                    return std::invoke(std::forward<F>(function));
+                }
+                return Error<TError> {get_self().get_error()};
+            }
+
+            /**
+             * This function calls the specified function with the error and returns its result, e.g. to recover from
+             * the error. If this result isn't an error, a successful result is returned.
+             *
+             * @param function The function handling the error
+             * @return         Void or the result of the function
+             * @author         Cedric Hammes
+             * @since          18/10/2026
+             */
+            template<typename F, typename TNewResult = std::invoke_result_t<F, TError&&>>
+            [[nodiscard]] constexpr auto or_else(F&& function) && -> TNewResult {
+                if(get_self().is_ok()) [[likely]] {
+                    return {};
+                }
+                return std::invoke(std::forward<F>(function), std::move(get_self().get_error()));
+            }
+
+            template<typename F, typename TNewResult = std::invoke_result_t<F, const TError&>>
+            [[nodiscard]] constexpr auto or_else(F&& function) const& -> TNewResult {
+                if(get_self().is_ok()) [[likely]] {
+                    return {};
+                }
+                return std::invoke(std::forward<F>(function), get_self().get_error());
+            }
+
+            /**
+             * This function calls the specified function and wraps its value into a result. If this result is an
+             * error, the error is moved into the returned result.
+             *
+             * @param function The function creating the value
+             * @return         The value of the function or the error
+             * @author         Cedric Hammes
+             * @since          18/10/2026
+             */
+            template<typename F, typename TNewValue = std::remove_cvref_t<std::invoke_result_t<F>>>
+            [[nodiscard]] constexpr auto transform(F&& function) && -> Result<TNewValue, TError> {
+                if(get_self().is_ok()) [[likely]] {
+                    if constexpr(std::is_void_v<TNewValue>) {
+                        std::invoke(std::forward<F>(function));
+                        return {};
+                    }
+                    else {
+                        return std::invoke(std::forward<F>(function));
+                    }
+                }
+                return Error<TError> {std::move(get_self().get_error())};
+            }
+
+            /**
+             * This function transforms the error with the specified function. If this result isn't an error, a
+             * successful result is returned.
+             *
+             * @param function The function transforming the error
+             * @return         Void or the transformed error
+             * @author         Cedric Hammes
+             * @since          18/10/2026
+             */
+            template<typename F, typename TNewError = std::remove_cvref_t<std::invoke_result_t<F, TError&&>>>
+            [[nodiscard]] constexpr auto transform_error(F&& function) && -> Result<void, TNewError> {
+                if(get_self().is_ok()) [[likely]] {
+                    return {};
+                }
+                return Error<TNewError> {std::invoke(std::forward<F>(function), std::move(get_self().get_error()))};
+            }
+
+        private:
+            [[nodiscard]] constexpr auto get_self() noexcept -> TResult& {
+                return static_cast<TResult&>(*this);
+            }
+
+            [[nodiscard]] constexpr auto get_self() const noexcept -> const TResult& {
+                return static_cast<const TResult&>(*this);
+            }
+        };
+    }// namespace detail
+
     template<typename TError>
-    class Result<void, TError> final {
+    class Result<void, TError> final : public detail::VoidResultFunctions<Result<void, TError>, TError> {
     public:
         using value_type = std::monostate;
         using error_type = TError;
@@ -157,31 +569,105 @@ namespace erebos {
     public:
         // clang-format off
         constexpr Result() : _value_or_error() {}
-        constexpr Result(Error<TError> error) : _value_or_error(std::move(error)) {}
+        constexpr Result(Error<TError> error) : _value_or_error(std::in_place_index<1>, std::move(error)) {}
         ~Result() noexcept = default;
         // clang-format on
-        EREBOS_DEFAULT_MOVE(Result);
-        EREBOS_DELETE_COPY(Result);
+        constexpr Result(const Result& other) = default;
+        constexpr Result(Result&& other) noexcept = default;
+        constexpr auto operator=(const Result& other) -> Result& = default;
+        constexpr auto operator=(Result&& other) noexcept -> Result& = default;
+
+        /**
+         * This constructor converts the error of another error type into the error type of this result.
+         *
+         * @param error The error to convert
+         * @author      Cedric Hammes
+         * @since       18/10/2026
+         */
+        template<typename TOtherError>
+            requires(!std::is_same_v<TOtherError, TError> && std::is_constructible_v<TError, const TOtherError&>)
+        constexpr Result(const Error<TOtherError>& error)// NOLINT(google-explicit-constructor)
+            : _value_or_error(std::in_place_index<1>, error_type_wrapper {error}) {
+        }
+
+        /**
+         * This constructor converts a result with another error type into a result with the error type of this result.
+         *
+         * @param other The result to convert
+         * @author      Cedric Hammes
+         * @since       18/10/2026
+         */
+        template<typename TOtherError>
+            requires(!std::is_same_v<TOtherError, TError> && std::is_constructible_v<TError, const TOtherError&>)
+        constexpr Result(const Result<void, TOtherError>& other)// NOLINT(google-explicit-constructor)
+            : _value_or_error(other.is_ok() ? decltype(_value_or_error)()
+                                            : decltype(_value_or_error)(std::in_place_index<1>, error_type_wrapper {TError(other.get_error())})) {
+        }
 
-        [[nodiscard]] auto get_error() const noexcept -> const TError& {
+        [[nodiscard]] constexpr auto get_error() const noexcept -> const TError& {
             assert(!is_ok());
-            return std::get<error_type_wrapper>(_value_or_error).get();
+            return std::get<1>(_value_or_error).get();
         }
 
-        [[nodiscard]] auto get_error() noexcept -> TError& {
+        [[nodiscard]] constexpr auto get_error() noexcept -> TError& {
             assert(!is_ok());
-            return std::get<error_type_wrapper>(_value_or_error).get();
+            return std::get<1>(_value_or_error).get();
         }
 
         [[nodiscard]] constexpr auto is_ok() const noexcept -> bool {
-            return std::holds_alternative<value_type>(_value_or_error);
+            return _value_or_error.index() == 0;
         }
 
         [[nodiscard]] constexpr auto is_error() const noexcept -> bool {
             return !is_ok();
         }
 
-        [[nodiscard]] operator bool() const noexcept {
+        [[nodiscard]] constexpr operator bool() const noexcept {
+            return is_ok();
+        }
+    };
+
+    /**
+     * This specialization stores only the error code, the error kind NONE represents the success. So the result has the
+     * size of the error code and is returned in a single register.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    template<>
+    class Result<void, ErrorCode> final : public detail::VoidResultFunctions<Result<void, ErrorCode>, ErrorCode> {
+    public:
+        using value_type = std::monostate;
+        using error_type = ErrorCode;
+        using error_type_wrapper = Error<ErrorCode>;
+
+    private:
+        ErrorCode _error;
+
+    public:
+        constexpr Result() noexcept
+            : _error {} {
+        }
+
+        constexpr Result(const Error<ErrorCode> error) noexcept// NOLINT(google-explicit-constructor)
+            : _error {error.get()} {
+            assert(_error.get_kind() != ErrorKind::NONE);
+        }
+
+        [[nodiscard]] constexpr auto get_error() const noexcept -> const ErrorCode& {
+            assert(!is_ok());
+            return _error;
+        }
+
+        [[nodiscard]] constexpr auto is_ok() const noexcept -> bool {
+            return _error.get_kind() == ErrorKind::NONE;
+        }
+
+        [[nodiscard]] constexpr auto is_error() const noexcept -> bool {
+            return !is_ok();
+        }
+
+        [[nodiscard]] constexpr operator bool() const noexcept {
             return is_ok();
         }
     };
@@ -195,4 +681,11 @@ namespace erebos {
             return Error(std::string(error.what()));
         }
     }
-}// namespace erebos
\ No newline at end of file
+}// namespace erebos
+
+template<>
+struct fmt::formatter<erebos::ErrorCode> : fmt::formatter<std::string_view> {
+    auto format(const erebos::ErrorCode& error_code, fmt::format_context& context) const -> decltype(context.out()) {
+        return fmt::formatter<std::string_view>::format(error_code.get_message(), context);
+    }
+};
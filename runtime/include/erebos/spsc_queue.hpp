@@ -0,0 +1,122 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#pragma once
+#include "erebos/utils.hpp"
+#include <array>
+#include <atomic>
+#include <optional>
+#include <type_traits>
+
+namespace erebos {
+    constexpr usize CACHE_LINE_SIZE = 64;
+
+    /**
+     * This class is a bounded lock-free queue for exactly one producer thread and one consumer thread. The head is only
+     * written by the consumer and the tail only by the producer, both are placed on separate cache lines with a cached
+     * copy of the other side's index, so the threads only share a cache line when the cached index is outdated.
+     *
+     * @tparam T        The type of the values, must be nothrow copy-assignable
+     * @tparam CAPACITY The count of slots in the queue, must be a power of two
+     * @author          Cedric Hammes
+     * @since           18/10/2026
+     */
+    template<typename T, usize CAPACITY>
+        requires((CAPACITY & (CAPACITY - 1)) == 0 && CAPACITY > 1 && std::is_nothrow_copy_assignable_v<T>)
+    class SPSCQueue final {
+        static constexpr usize INDEX_MASK = CAPACITY - 1;
+
+        alignas(CACHE_LINE_SIZE) std::atomic<usize> _head;
+        usize _cached_tail;
+        alignas(CACHE_LINE_SIZE) std::atomic<usize> _tail;
+        usize _cached_head;
+        alignas(CACHE_LINE_SIZE) std::array<T, CAPACITY> _slots;
+
+    public:
+        SPSCQueue() noexcept
+            : _head {0}
+            , _cached_tail {0}
+            , _tail {0}
+            , _cached_head {0}
+            , _slots {} {
+        }
+
+        SPSCQueue(SPSCQueue&& other) noexcept = delete;
+        EREBOS_DELETE_COPY(SPSCQueue);
+
+        /**
+         * This function pushes the value into the queue. This function must only be called by the producer thread.
+         *
+         * @param value The value to push
+         * @return      Whether the value was pushed or the queue is full
+         * @author      Cedric Hammes
+         * @since       18/10/2026
+         */
+        [[nodiscard]] auto try_push(const T& value) noexcept -> bool {
+            const auto tail = _tail.load(std::memory_order_relaxed);
+            if(tail - _cached_head == CAPACITY) {
+                _cached_head = _head.load(std::memory_order_acquire);
+                if(tail - _cached_head == CAPACITY) {
+                    return false;
+                }
+            }
+
+            _slots[tail & INDEX_MASK] = value;
+            _tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * This function pops the oldest value from the queue. This function must only be called by the consumer thread.
+         *
+         * @return The oldest value or nothing if the queue is empty
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        [[nodiscard]] auto try_pop() noexcept -> std::optional<T> {
+            const auto head = _head.load(std::memory_order_relaxed);
+            if(head == _cached_tail) {
+                _cached_tail = _tail.load(std::memory_order_acquire);
+                if(head == _cached_tail) {
+                    return std::nullopt;
+                }
+            }
+
+            std::optional<T> value {_slots[head & INDEX_MASK]};
+            _head.store(head + 1, std::memory_order_release);
+            return value;
+        }
+
+        /**
+         * This function returns an approximation of the count of values in the queue, the count can be outdated when
+         * the function returns.
+         *
+         * @return The count of values in the queue
+         * @author Cedric Hammes
+         * @since  18/10/2026
+         */
+        [[nodiscard]] auto get_size() const noexcept -> usize {
+            return _tail.load(std::memory_order_acquire) - _head.load(std::memory_order_acquire);
+        }
+
+        [[nodiscard]] constexpr auto get_capacity() const noexcept -> usize {
+            return CAPACITY;
+        }
+    };
+}// namespace erebos
@@ -20,8 +20,14 @@
 
 #pragma once
 #include "erebos/utils.hpp"
+#include <algorithm>
+#include <array>
+#include <concepts>
 #include <iterator>
+#include <optional>
+#include <span>
 #include <string>
+#include <string_view>
 
 /**
  * Implementation based on Boost Nowide
@@ -29,32 +35,13 @@
  * made constexpr-ready and prettified some of the code.
  */
 namespace erebos::unicode {
-    namespace {
+    namespace detail {
         using CodePoint = char32_t;
 
         constexpr CodePoint illegal = 0xFFFF'FFFFU;
         constexpr CodePoint incomplete = 0xFFFF'FFFEU;
         constexpr CodePoint replacement = 0x0000'FFFD;
 
-        // Credits: https://github.com/karmakrafts/kstd-core/blob/master/include/kstd/libc.hpp
-        // License: https://github.com/karmakrafts/kstd-core/blob/master/LICENSE
-        template<typename T>
-        [[nodiscard]] constexpr auto get_string_length(const T* str) noexcept -> usize {
-            if constexpr(std::is_same_v<T, char>) {
-                return strlen(str);
-            }
-            else if constexpr(std::is_same_v<T, wchar_t>) {
-                return wcslen(str);
-            }
-            else {
-                auto* ptr = str;
-                while(*ptr != static_cast<T>('\0')) {
-                    ++ptr;
-                }
-                return static_cast<usize>(ptr - str);// Use pointer difference
-            }
-        }
-
         constexpr auto is_valid_codepoint(CodePoint value) noexcept -> bool {
             if(value > 0x10FFFF) {
                 return false;
@@ -133,10 +120,12 @@ namespace erebos::unicode {
                     if(current == end) {
                         return incomplete;
                     }
-                    temp = static_cast<u8>(*current++);
+                    // The unit isn't consumed, so every lead unit starts a new sequence (also across chunk boundaries)
+                    temp = static_cast<u8>(*current);
                     if(!is_trail(temp)) {
                         return illegal;
                     }
+                    ++current;
                     code_point = (code_point << 6) | (temp & 0x3F);
                 }
                 if(!is_valid_codepoint(code_point) || width(code_point) != trail_size + 1) {
@@ -229,10 +218,11 @@ namespace erebos::unicode {
                 if(current == end) {
                     return incomplete;
                 }
-                const auto surr2 = static_cast<u16>(*current++);
+                const auto surr2 = static_cast<u16>(*current);
                 if(!is_second_surrogate(surr2)) {
                     return illegal;
                 }
+                ++current;
                 return combine_surrogate(surr1, surr2);
             }
 
@@ -291,49 +281,437 @@ namespace erebos::unicode {
             }
         };
 
+        template<typename CHAR>
+        concept WideChar = std::same_as<CHAR, char16_t> || std::same_as<CHAR, char32_t> || std::same_as<CHAR, wchar_t>;
+
+        /**
+         * This function returns the maximum count of units the conversion of the specified count of input units can
+         * produce, including the replacement characters of invalid sequences. A UTF-8 byte never produces more than one
+         * UTF-16 or UTF-32 unit, a UTF-16 unit never more than three UTF-8 bytes.
+         *
+         * @tparam CHAR_OUT The type of the output units
+         * @tparam CHAR_IN  The type of the input units
+         * @param length    The count of input units
+         * @return          The maximum count of output units
+         * @author          Cedric Hammes
+         * @since           18/10/2026
+         */
         template<typename CHAR_OUT, typename CHAR_IN>
-        inline auto convert_buffer(const CHAR_IN* value, CHAR_OUT* out, usize* out_count) noexcept -> void {
-            if(value == nullptr) {
-                return;
-            }
-            const auto length = get_string_length(value);
-            if(length == 0) {
-                return;
-            }
-            const auto* end = &value[length];
-            if(out_count != nullptr) {
-                const auto* current = value;
-                while(current != end) {
-                    auto code_point = UTFTraits<CHAR_IN>::decode(current, end);
-                    if(code_point == illegal || code_point == incomplete) {
-                        code_point = replacement;
-                    }
-                    *out_count += UTFTraits<CHAR_OUT>::width(code_point);
-                }
+        [[nodiscard]] constexpr auto get_max_converted_length(const usize length) noexcept -> usize {
+            if constexpr(sizeof(CHAR_IN) == 1) {
+                return length;
             }
-            if(out != nullptr) {
-                const auto* current = value;
-                while(current != end) {
-                    auto code_point = UTFTraits<CHAR_IN>::decode(current, end);
-                    if(code_point == illegal || code_point == incomplete) {
-                        code_point = replacement;
-                    }
-                    UTFTraits<CHAR_OUT>::encode(code_point, out);
-                }
+            else if constexpr(sizeof(CHAR_IN) == 2) {
+                return sizeof(CHAR_OUT) == 1 ? length * 3 : length;
+            }
+            else {
+                return length * UTFTraits<CHAR_OUT>::max_width;
+            }
+        }
+
+        template<typename CHAR_OUT, typename CHAR_IN>
+        constexpr auto convert_code_point(const CHAR_IN*& current, const CHAR_IN* end, CHAR_OUT*& out) noexcept -> void {
+            auto code_point = UTFTraits<CHAR_IN>::decode(current, end);
+            if(code_point == illegal || code_point == incomplete) {
+                code_point = replacement;
+            }
+            UTFTraits<CHAR_OUT>::encode(code_point, out);
+        }
+
+        /**
+         * This function converts the input units into the output buffer in a single pass. Invalid and incomplete
+         * sequences are replaced with the replacement character. The output buffer must be able to hold the maximum
+         * converted length of the input.
+         *
+         * @tparam CHAR_OUT The type of the output units
+         * @tparam CHAR_IN  The type of the input units
+         * @param value     The input units
+         * @param length    The count of input units
+         * @param out       The output buffer
+         * @return          The count of written output units
+         * @author          Cedric Hammes
+         * @since           18/10/2026
+         */
+        template<typename CHAR_OUT, typename CHAR_IN>
+        constexpr auto convert_buffer_scalar(const CHAR_IN* value, const usize length, CHAR_OUT* out) noexcept -> usize {
+            const auto* current = value;
+            const auto* end = value + length;
+            auto* out_begin = out;
+            while(current != end) {
+                convert_code_point(current, end, out);
+            }
+            return static_cast<usize>(out - out_begin);
+        }
+
+        /**
+         * This function converts UTF-8 into UTF-16 or UTF-32 like the scalar conversion, but uses the SIMD kernel
+         * selected for the CPU to convert runs of ASCII characters.
+         *
+         * @tparam CHAR_OUT The type of the output units
+         * @param value     The input units
+         * @param length    The count of input units
+         * @param out       The output buffer
+         * @return          The count of written output units
+         * @author          Cedric Hammes
+         * @since           18/10/2026
+         */
+        template<WideChar CHAR_OUT>
+        [[nodiscard]] auto convert_from_utf8(const char* value, usize length, CHAR_OUT* out) noexcept -> usize;
+
+        /**
+         * This function converts UTF-16 or UTF-32 into UTF-8 like the scalar conversion, but uses the SIMD kernel
+         * selected for the CPU to convert runs of ASCII characters.
+         *
+         * @tparam CHAR_IN The type of the input units
+         * @param value    The input units
+         * @param length   The count of input units
+         * @param out      The output buffer
+         * @return         The count of written output units
+         * @author         Cedric Hammes
+         * @since          18/10/2026
+         */
+        template<WideChar CHAR_IN>
+        [[nodiscard]] auto convert_to_utf8(const CHAR_IN* value, usize length, char* out) noexcept -> usize;
+
+        template<typename CHAR_OUT, typename CHAR_IN>
+        inline auto convert_buffer(const CHAR_IN* value, const usize length, CHAR_OUT* out) noexcept -> usize {
+            if constexpr(std::is_same_v<CHAR_IN, char> && WideChar<CHAR_OUT>) {
+                return convert_from_utf8(value, length, out);
+            }
+            else if constexpr(WideChar<CHAR_IN> && std::is_same_v<CHAR_OUT, char>) {
+                return convert_to_utf8(value, length, out);
+            }
+            else {
+                return convert_buffer_scalar(value, length, out);
             }
         }
 
         template<typename CHAR_OUT, typename... OUT_ARGS, typename CHAR_IN, typename... IN_ARGS>
         [[nodiscard]] inline auto convert(const std::basic_string<CHAR_IN, IN_ARGS...>& value) noexcept
             -> std::basic_string<CHAR_OUT, OUT_ARGS...> {
-            const auto* value_address = value.c_str();
-            usize count = 0;
-            convert_buffer<CHAR_OUT, CHAR_IN>(value_address, nullptr, &count);
-            std::basic_string<CHAR_OUT, OUT_ARGS...> result(count, ' ');
-            convert_buffer<CHAR_OUT, CHAR_IN>(value_address, result.data(), nullptr);
+            std::basic_string<CHAR_OUT, OUT_ARGS...> result(get_max_converted_length<CHAR_OUT, CHAR_IN>(value.size()), CHAR_OUT {});
+            result.resize(convert_buffer(value.data(), value.size(), result.data()));
             return result;
         }
-    }// namespace
+
+        /**
+         * This function returns the length of the input without the incomplete sequence at the end of the input. The
+         * decoders never consume a lead unit as part of another sequence, so the input can be split before the last
+         * lead unit without changing the result of the conversion.
+         *
+         * @tparam CHAR  The type of the input units
+         * @param value  The input units
+         * @param length The count of input units
+         * @return       The count of input units before the incomplete sequence
+         * @author       Cedric Hammes
+         * @since        18/10/2026
+         */
+        template<typename CHAR>
+        [[nodiscard]] constexpr auto get_complete_length(const CHAR* value, const usize length) noexcept -> usize {
+            if constexpr(sizeof(CHAR) == 1) {
+                const auto search_length = std::min<usize>(length, UTFTraits<CHAR>::max_width - 1);
+                for(usize offset = 1; offset <= search_length; ++offset) {
+                    const auto unit = value[length - offset];
+                    if(UTFTraits<CHAR>::is_lead(unit)) {
+                        return UTFTraits<CHAR>::trail_length(unit) >= static_cast<i32>(offset) ? length - offset : length;
+                    }
+                }
+                return length;
+            }
+            else if constexpr(sizeof(CHAR) == 2) {
+                if(length > 0 && UTFTraits<CHAR>::trail_length(value[length - 1]) == 1) {
+                    return length - 1;
+                }
+                return length;
+            }
+            else {
+                return length;
+            }
+        }
+
+        template<typename CHAR, usize LENGTH>
+        struct StringLiteral final {
+            using CharType = CHAR;
+            std::array<CHAR, LENGTH> units;
+
+            consteval StringLiteral(const CHAR (&value)[LENGTH]) noexcept// NOLINT(google-explicit-constructor)
+                : units {} {
+                std::copy_n(value, LENGTH, units.begin());
+            }
+
+            [[nodiscard]] constexpr auto get_length() const noexcept -> usize {
+                return LENGTH - 1;
+            }
+        };
+
+        template<typename CHAR_OUT, StringLiteral VALUE>
+        inline constexpr auto converted_literal = [] {
+            using CharIn = typename decltype(VALUE)::CharType;
+            constexpr auto length = [] {
+                std::array<CHAR_OUT, get_max_converted_length<CHAR_OUT, CharIn>(VALUE.get_length())> buffer {};
+                return convert_buffer_scalar(VALUE.units.data(), VALUE.get_length(), buffer.data());
+            }();
+
+            // The converted literal is NUL-terminated like the input literal
+            std::array<CHAR_OUT, length + 1> units {};
+            convert_buffer_scalar(VALUE.units.data(), VALUE.get_length(), units.data());
+            return units;
+        }();
+    }// namespace detail
+
+    /**
+     * The progress of a conversion into a caller-provided buffer.
+     */
+    struct ConvertResult final {
+        usize read;
+        usize written;
+    };
+
+    /**
+     * This function returns the maximum count of units the conversion of the specified count of input units can
+     * produce. An output buffer of this size can hold the whole conversion.
+     *
+     * @tparam CHAR_OUT The type of the output units
+     * @tparam CHAR_IN  The type of the input units
+     * @param length    The count of input units
+     * @return          The maximum count of output units
+     * @author          Cedric Hammes
+     * @since           18/10/2026
+     */
+    template<typename CHAR_OUT, typename CHAR_IN>
+    [[nodiscard]] constexpr auto get_max_converted_length(const usize length) noexcept -> usize {
+        return detail::get_max_converted_length<CHAR_OUT, CHAR_IN>(length);
+    }
+
+    /**
+     * This function converts the input into the output buffer without allocating. If the output buffer can hold the
+     * maximum converted length of the input, the input is converted in a single pass with the SIMD kernels. Otherwise
+     * the input is converted until the next code point doesn't fit into the output buffer. Invalid sequences and an
+     * incomplete sequence at the end of the input are replaced with the replacement character, use the transcoder to
+     * convert input in chunks.
+     *
+     * @tparam CHAR_OUT The type of the output units
+     * @tparam CHAR_IN  The type of the input units
+     * @param value     The input units
+     * @param out       The output buffer
+     * @return          The count of read input units and written output units
+     * @author          Cedric Hammes
+     * @since           18/10/2026
+     */
+    template<typename CHAR_OUT, typename CHAR_IN>
+    [[nodiscard]] constexpr auto convert_into(const std::span<const CHAR_IN> value, const std::span<CHAR_OUT> out) noexcept
+        -> ConvertResult {
+        if(!std::is_constant_evaluated() && out.size() >= get_max_converted_length<CHAR_OUT, CHAR_IN>(value.size())) {
+            return {value.size(), detail::convert_buffer(value.data(), value.size(), out.data())};
+        }
+
+        const auto* current = value.data();
+        const auto* end = value.data() + value.size();
+        auto* out_current = out.data();
+        while(current != end) {
+            std::array<CHAR_OUT, detail::UTFTraits<CHAR_OUT>::max_width> units {};
+            auto* units_end = units.data();
+            auto* next = current;
+            detail::convert_code_point(next, end, units_end);
+
+            const auto unit_count = static_cast<usize>(units_end - units.data());
+            if(unit_count > static_cast<usize>(out.data() + out.size() - out_current)) {
+                break;
+            }
+            out_current = std::copy_n(units.data(), unit_count, out_current);
+            current = next;
+        }
+        return {static_cast<usize>(current - value.data()), static_cast<usize>(out_current - out.data())};
+    }
+
+    /**
+     * This class converts input, which is split into chunks (e.g. a streamed file), without allocating. An incomplete
+     * sequence at the end of a chunk is carried over and completed with the next chunk, so the concatenated output is
+     * the same as the output of the whole input. After the last chunk, the remaining carry is flushed with finish.
+     *
+     * @tparam CHAR_OUT The type of the output units
+     * @tparam CHAR_IN  The type of the input units
+     * @author          Cedric Hammes
+     * @since           18/10/2026
+     */
+    template<typename CHAR_OUT, typename CHAR_IN>
+    class Transcoder final {
+        static constexpr usize MAX_INPUT_WIDTH = detail::UTFTraits<CHAR_IN>::max_width;
+
+    public:
+        /**
+         * The minimum size of the output buffer, the carry can't be converted into smaller buffers.
+         */
+        static constexpr usize MIN_OUTPUT_LENGTH = get_max_converted_length<CHAR_OUT, CHAR_IN>(2 * MAX_INPUT_WIDTH);
+
+    private:
+        std::array<CHAR_IN, MAX_INPUT_WIDTH> _carry;
+        usize _carry_length;
+
+    public:
+        constexpr Transcoder() noexcept
+            : _carry {}
+            , _carry_length {0} {
+        }
+
+        /**
+         * This function converts the chunk into the output buffer. The incomplete sequence at the end of the chunk is
+         * carried over and counted as read. If the output buffer is too small for the chunk, less than the whole chunk
+         * is read and the unread rest must be passed again.
+         *
+         * @param chunk The input units of the chunk
+         * @param out   The output buffer, must hold at least the minimum output length
+         * @return      The count of read input units and written output units
+         * @author      Cedric Hammes
+         * @since       18/10/2026
+         */
+        [[nodiscard]] constexpr auto convert(const std::span<const CHAR_IN> chunk, const std::span<CHAR_OUT> out) noexcept
+            -> ConvertResult {
+            if(out.size() < MIN_OUTPUT_LENGTH) {
+                return {0, 0};
+            }
+
+            usize read = 0;
+            usize written = 0;
+            if(_carry_length > 0) {
+                // The carry is completed with enough units of the chunk to decode every sequence starting in the carry
+                std::array<CHAR_IN, 2 * MAX_INPUT_WIDTH> units {};
+                std::copy_n(_carry.data(), _carry_length, units.data());
+                const auto chunk_length = std::min(chunk.size(), MAX_INPUT_WIDTH);
+                std::copy_n(chunk.data(), chunk_length, units.data() + _carry_length);
+
+                const auto* current = units.data();
+                const auto* carry_end = units.data() + _carry_length;
+                const auto* end = carry_end + chunk_length;
+                auto* out_current = out.data();
+                while(current < carry_end) {
+                    auto* next = current;
+                    auto code_point = detail::UTFTraits<CHAR_IN>::decode(next, end);
+                    if(code_point == detail::incomplete) {
+                        // The whole chunk is part of the incomplete sequence
+                        _carry_length = static_cast<usize>(end - current);
+                        std::copy_n(current, _carry_length, _carry.data());
+                        return {chunk.size(), static_cast<usize>(out_current - out.data())};
+                    }
+                    if(code_point == detail::illegal) {
+                        code_point = detail::replacement;
+                    }
+                    detail::UTFTraits<CHAR_OUT>::encode(code_point, out_current);
+                    current = next;
+                }
+
+                read = static_cast<usize>(current - carry_end);
+                written = static_cast<usize>(out_current - out.data());
+                _carry_length = 0;
+            }
+
+            const auto rest = chunk.subspan(read);
+            const auto complete_length = detail::get_complete_length(rest.data(), rest.size());
+            const auto result = convert_into<CHAR_OUT, CHAR_IN>(rest.first(complete_length), out.subspan(written));
+            if(result.read == complete_length) {
+                _carry_length = rest.size() - complete_length;
+                std::copy_n(rest.data() + complete_length, _carry_length, _carry.data());
+                return {chunk.size(), written + result.written};
+            }
+            return {read + result.read, written + result.written};
+        }
+
+        /**
+         * This function converts the carried over sequence at the end of the input into replacement characters and
+         * resets the transcoder for the next input.
+         *
+         * @param out The output buffer, must hold at least the minimum output length
+         * @return    The count of written output units
+         * @author    Cedric Hammes
+         * @since     18/10/2026
+         */
+        [[nodiscard]] constexpr auto finish(const std::span<CHAR_OUT> out) noexcept -> usize {
+            if(out.size() < MIN_OUTPUT_LENGTH) {
+                return 0;
+            }
+            const auto written = detail::convert_buffer_scalar(_carry.data(), _carry_length, out.data());
+            _carry_length = 0;
+            return written;
+        }
+
+        [[nodiscard]] constexpr auto get_carry_length() const noexcept -> usize {
+            return _carry_length;
+        }
+    };
+
+    /**
+     * This function checks whether the input is valid UTF-8. Overlong encodings, surrogates, code points above U+10FFFF
+     * and an incomplete sequence at the end of the input are invalid. The input is validated in blocks with the SIMD
+     * kernel selected for the CPU.
+     *
+     * @param value The input bytes
+     * @return      Whether the input is valid UTF-8
+     * @author      Cedric Hammes
+     * @since       18/10/2026
+     */
+    [[nodiscard]] auto validate_utf8(std::span<const u8> value) noexcept -> bool;
+
+    /**
+     * This function returns the offset of the first invalid sequence in the input. The blocks before the first invalid
+     * block are validated with the SIMD kernel, the invalid block is searched with the scalar decoder.
+     *
+     * @param value The input bytes
+     * @return      The offset of the first byte of the invalid sequence or nothing if the input is valid UTF-8
+     * @author      Cedric Hammes
+     * @since       18/10/2026
+     */
+    [[nodiscard]] auto find_invalid(std::span<const u8> value) noexcept -> std::optional<usize>;
+
+    /**
+     * This function counts the code points of the UTF-8 input by counting all bytes, which aren't continuation bytes.
+     * The input isn't validated, so the count is only the count of decoded code points if the input is valid UTF-8.
+     *
+     * @param value The input bytes
+     * @return      The count of code points
+     * @author      Cedric Hammes
+     * @since       18/10/2026
+     */
+    [[nodiscard]] auto count_code_points(std::span<const u8> value) noexcept -> usize;
+
+    [[nodiscard]] inline auto validate_utf8(const std::string_view value) noexcept -> bool {
+        return validate_utf8({reinterpret_cast<const u8*>(value.data()), value.size()});
+    }
+
+    [[nodiscard]] inline auto find_invalid(const std::string_view value) noexcept -> std::optional<usize> {
+        return find_invalid({reinterpret_cast<const u8*>(value.data()), value.size()});
+    }
+
+    [[nodiscard]] inline auto count_code_points(const std::string_view value) noexcept -> usize {
+        return count_code_points({reinterpret_cast<const u8*>(value.data()), value.size()});
+    }
+
+    /**
+     * This function converts the string literal at compile time. The converted literal is stored in static storage and
+     * NUL-terminated.
+     *
+     * @tparam CHAR_OUT The type of the output units
+     * @tparam VALUE    The string literal to convert
+     * @return          A view of the converted literal
+     * @author          Cedric Hammes
+     * @since           18/10/2026
+     */
+    template<typename CHAR_OUT, detail::StringLiteral VALUE>
+    [[nodiscard]] consteval auto convert_literal() noexcept -> std::basic_string_view<CHAR_OUT> {
+        const auto& units = detail::converted_literal<CHAR_OUT, VALUE>;
+        return {units.data(), units.size() - 1};
+    }
+
+    namespace literals {
+        template<detail::StringLiteral VALUE>
+        [[nodiscard]] consteval auto operator""_wcs() noexcept -> std::wstring_view {
+            return convert_literal<wchar_t, VALUE>();
+        }
+
+        template<detail::StringLiteral VALUE>
+        [[nodiscard]] consteval auto operator""_mbs() noexcept -> std::string_view {
+            return convert_literal<char, VALUE>();
+        }
+    }// namespace literals
 
     /**
      * Converts the given std::string into an std::wstring using the kstd::unicode API.
@@ -344,7 +722,7 @@ namespace erebos::unicode {
      */
     template<typename TRAITS = std::char_traits<wchar_t>, typename ALLOCATOR = std::allocator<wchar_t>>
     [[nodiscard]] inline auto to_wcs(const std::string& value) noexcept -> std::basic_string<wchar_t, TRAITS, ALLOCATOR> {
-        return convert<wchar_t, TRAITS, ALLOCATOR>(value);
+        return detail::convert<wchar_t, TRAITS, ALLOCATOR>(value);
     }
 
     /**
@@ -356,6 +734,6 @@ namespace erebos::unicode {
      */
     template<typename TRAITS = std::char_traits<char>, typename ALLOCATOR = std::allocator<char>>
     [[nodiscard]] inline auto to_mbs(const std::wstring& value) noexcept -> std::basic_string<char, TRAITS, ALLOCATOR> {
-        return convert<char, TRAITS, ALLOCATOR>(value);
+        return detail::convert<char, TRAITS, ALLOCATOR>(value);
     }
 }// namespace erebos::unicode
\ No newline at end of file
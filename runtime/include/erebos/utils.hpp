@@ -51,6 +51,7 @@ namespace erebos {
     using u8 = std::uint8_t;
     using u16 = std::uint16_t;
     using u32 = std::uint32_t;
+    using u64 = std::uint64_t;
     using usize = std::size_t;
 
     using atomic_bool = std::atomic_bool;
@@ -18,10 +18,14 @@
  */
 
 #pragma once
+#include "erebos/callback_registry.hpp"
+#include "erebos/frame_scheduler.hpp"
 #include "erebos/result.hpp"
 #include "erebos/utils.hpp"
 #include <SDL2/SDL.h>
+#include <atomic>
 #include <fmt/format.h>
+#include <mutex>
 #include <spdlog/spdlog.h>
 #include <stdexcept>
 #include <string>
@@ -31,13 +35,31 @@
 #endif
 
 namespace erebos {
-    using EventCallbackFunction = std::function<erebos::Result<void>(SDL_Event& event, void* data)>;
-    using RenderCallbackFunction = std::function<erebos::Result<void>(void* data)>;
+    using EventCallbackRegistry = CallbackRegistry<SDL_Event&>;
+    using RenderCallbackRegistry = CallbackRegistry<>;
+    using EventCallbackFunction = EventCallbackRegistry::CallbackFunction;
+    using RenderCallbackFunction = RenderCallbackRegistry::CallbackFunction;
+
+    /**
+     * The threading mode of the window loop. In the single-threaded mode, the events are polled and the render callbacks
+     * are called on the same thread. In the threaded mode, the events are pumped on the calling thread and passed to a
+     * dedicated render thread, which calls the event and render callbacks. So all callbacks are called on the same
+     * thread in both modes.
+     */
+    enum class LoopMode : u8 {
+        SINGLE_THREADED,
+        THREADED
+    };
 
     class Window final {
         SDL_Window* _window_handle;
-        std::vector<std::pair<EventCallbackFunction, void*>> _event_callback_list;
-        std::vector<std::pair<RenderCallbackFunction, void*>> _render_callback_list;
+        EventCallbackRegistry _event_callbacks;
+        RenderCallbackRegistry _render_callbacks;
+        mutable std::atomic<u64> _drawable_size;
+        FrameSchedulerConfig _frame_scheduler_config;
+        mutable std::mutex _title_mutex;
+        mutable std::string _pending_title;
+        mutable std::atomic_bool _is_title_pending;
 
     public:
         /**
@@ -63,23 +85,63 @@ namespace erebos {
          */
         ~Window() noexcept;
 
-        inline auto add_event_callback(const EventCallbackFunction& callback_function, void* data_ptr) noexcept -> void {
-            _event_callback_list.emplace_back(callback_function, data_ptr);
+        /**
+         * This method adds a callback, which is called for the SDL events of the specified type or for all events if no
+         * type is specified. Callbacks with a higher priority are called first.
+         *
+         * @param callback_function The callback to add
+         * @param data_ptr          The data passed to the callback
+         * @param priority          The priority of the callback
+         * @param event_type        The only event type the callback is called for
+         * @author                  Cedric Hammes
+         * @since                   14/03/2024
+         */
+        inline auto add_event_callback(EventCallbackFunction callback_function,
+                                       void* data_ptr,
+                                       const i32 priority = 0,
+                                       const std::optional<u32> event_type = {}) noexcept -> void {
+            _event_callbacks.add(std::move(callback_function), data_ptr, priority, event_type);
         }
 
-        inline auto add_render_callback(const RenderCallbackFunction& callback_function, void* data_ptr) noexcept -> void {
-            _render_callback_list.emplace_back(callback_function, data_ptr);
+        inline auto add_render_callback(RenderCallbackFunction callback_function, void* data_ptr, const i32 priority = 0) noexcept -> void {
+            _render_callbacks.add(std::move(callback_function), data_ptr, priority);
+        }
+
+        inline auto set_frame_scheduler_config(const FrameSchedulerConfig& config) noexcept -> void {
+            _frame_scheduler_config = config;
         }
 
+        /**
+         * This method sets the title of the window. SDL only allows to set the title on the thread which pumps the
+         * events, so the title is stored and set by the next iteration of the window loop. This can be called
+         * safely from the render thread and the callbacks.
+         *
+         * @param title The new title of the window
+         * @author      Cedric Hammes
+         * @since       18/10/2026
+         */
+        auto set_title(std::string title) noexcept -> void;
+
         /**
          * This method runs a window loop which polls window events while the window doesn't requested to be
          * closed. When an error occurs, this method cancels the loop and returns the error.
          *
-         * @return Void or an error
+         * @param mode The threading mode of the loop
+         * @return     Void or an error
+         * @author     Cedric Hammes
+         * @since      14/03/2024
+         */
+        [[nodiscard]] auto run_loop(LoopMode mode = LoopMode::SINGLE_THREADED) const noexcept -> erebos::Result<void>;
+
+        /**
+         * This method returns the size of the window's drawable in pixels. The size is updated by the event loop before
+         * the resize event is passed to the callbacks, so this can be called safely from the render thread.
+         *
+         * @return The width and height of the drawable
          * @author Cedric Hammes
-         * @since  14/03/2024
+         * @since  18/10/2026
          */
-        [[nodiscard]] auto run_loop() const noexcept -> erebos::Result<void>;
+        [[nodiscard]] auto get_drawable_size() const noexcept -> std::pair<u32, u32>;
 
         /**
          * This method returns the raw handle to the internal usd SDL
@@ -94,5 +156,12 @@ namespace erebos {
         }
 
         auto operator=(Window&& other) noexcept -> Window&;
+
+    private:
+        [[nodiscard]] auto run_threaded_loop() const noexcept -> erebos::Result<void>;
+        auto dispatch_event(SDL_Event& event) const noexcept -> void;
+        auto dispatch_render() const noexcept -> void;
+        auto update_drawable_size() const noexcept -> void;
+        auto apply_pending_title() const noexcept -> void;
     };
 }// namespace erebos
\ No newline at end of file
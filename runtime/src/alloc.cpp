@@ -13,14 +13,79 @@
 //   limitations under the License.
 
 #include <mimalloc.h>
+#include <new>
 
+#ifdef EREBOS_ALLOCATION_TRACKING
+#include "erebos/memory/tracking.hpp"
+#define EREBOS_ON_ALLOCATE(pointer) ::erebos::memory::detail::on_allocate(pointer)
+#define EREBOS_ON_DEALLOCATE(pointer) ::erebos::memory::detail::on_deallocate(pointer)
+#else
+#define EREBOS_ON_ALLOCATE(pointer)
+#define EREBOS_ON_DEALLOCATE(pointer)
+#endif
 
 // NOLINTBEGIN
 void* operator new(const size_t size) {
-    return mi_malloc(size);
+    void* memory = mi_new(size);
+    EREBOS_ON_ALLOCATE(memory);
+    return memory;
 }
 
-void operator delete(void* memory) {
+void* operator new[](const size_t size) {
+    void* memory = mi_new(size);
+    EREBOS_ON_ALLOCATE(memory);
+    return memory;
+}
+
+void* operator new(const size_t size, const std::align_val_t alignment) {
+    void* memory = mi_new_aligned(size, static_cast<size_t>(alignment));
+    EREBOS_ON_ALLOCATE(memory);
+    return memory;
+}
+
+void* operator new[](const size_t size, const std::align_val_t alignment) {
+    void* memory = mi_new_aligned(size, static_cast<size_t>(alignment));
+    EREBOS_ON_ALLOCATE(memory);
+    return memory;
+}
+
+void operator delete(void* memory) noexcept {
+    EREBOS_ON_DEALLOCATE(memory);
     mi_free(memory);
 }
+
+void operator delete[](void* memory) noexcept {
+    EREBOS_ON_DEALLOCATE(memory);
+    mi_free(memory);
+}
+
+void operator delete(void* memory, const size_t size) noexcept {
+    EREBOS_ON_DEALLOCATE(memory);
+    mi_free_size(memory, size);
+}
+
+void operator delete[](void* memory, const size_t size) noexcept {
+    EREBOS_ON_DEALLOCATE(memory);
+    mi_free_size(memory, size);
+}
+
+void operator delete(void* memory, const std::align_val_t alignment) noexcept {
+    EREBOS_ON_DEALLOCATE(memory);
+    mi_free_aligned(memory, static_cast<size_t>(alignment));
+}
+
+void operator delete[](void* memory, const std::align_val_t alignment) noexcept {
+    EREBOS_ON_DEALLOCATE(memory);
+    mi_free_aligned(memory, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* memory, const size_t size, const std::align_val_t alignment) noexcept {
+    EREBOS_ON_DEALLOCATE(memory);
+    mi_free_size_aligned(memory, size, static_cast<size_t>(alignment));
+}
+
+void operator delete[](void* memory, const size_t size, const std::align_val_t alignment) noexcept {
+    EREBOS_ON_DEALLOCATE(memory);
+    mi_free_size_aligned(memory, size, static_cast<size_t>(alignment));
+}
 // NOLINTEND
@@ -0,0 +1,197 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include "erebos/frame_scheduler.hpp"
+#include <algorithm>
+#include <thread>
+
+namespace erebos {
+    namespace {
+        // The initial estimate matches the default timer resolution of Windows, the estimate adapts after the first sleep
+        constexpr std::chrono::milliseconds INITIAL_SLEEP_OVERSHOOT {1};
+
+        [[nodiscard]] constexpr auto to_frame_interval(const u32 frame_rate) noexcept -> FrameScheduler::Clock::duration {
+            if(frame_rate == 0) {
+                return FrameScheduler::Clock::duration::zero();
+            }
+            return std::chrono::duration_cast<FrameScheduler::Clock::duration>(std::chrono::nanoseconds {1'000'000'000 / frame_rate});
+        }
+    }// namespace
+
+    /**
+     * This constructor creates a frame scheduler for a focused window, which schedules the first frame immediately.
+     *
+     * @param config The frame rates of the scheduler
+     * @author       Cedric Hammes
+     * @since        18/10/2026
+     */
+    FrameScheduler::FrameScheduler(FrameSchedulerConfig config) noexcept
+        : _config {config}
+        , _is_focused {true}
+        , _is_minimized {false}
+        , _next_frame_time {Clock::now()}
+        , _sleep_overshoot {INITIAL_SLEEP_OVERSHOOT} {
+    }
+
+    /**
+     * This function updates the activity of the window, if the specified event is a focus, minimize or restore event
+     * of the window.
+     *
+     * @param event The event to handle
+     * @author      Cedric Hammes
+     * @since       18/10/2026
+     */
+    auto FrameScheduler::handle_event(const SDL_Event& event) noexcept -> void {
+        if(event.type != SDL_WINDOWEVENT) {
+            return;
+        }
+
+        switch(event.window.event) {
+            case SDL_WINDOWEVENT_FOCUS_GAINED:
+                _is_focused = true;
+                break;
+            case SDL_WINDOWEVENT_FOCUS_LOST:
+                _is_focused = false;
+                break;
+            case SDL_WINDOWEVENT_MINIMIZED:
+            case SDL_WINDOWEVENT_HIDDEN:
+                _is_minimized = true;
+                break;
+            case SDL_WINDOWEVENT_RESTORED:
+            case SDL_WINDOWEVENT_SHOWN:
+                // Render the first frame after the restore immediately instead of waiting for the old schedule
+                if(_is_minimized) {
+                    _next_frame_time = Clock::now();
+                }
+                _is_minimized = false;
+                break;
+            default:
+                break;
+        }
+    }
+
+    /**
+     * This function returns the interval between two frames for the current activity of the window.
+     *
+     * @return The frame interval, zero if the frame rate is uncapped or nothing if no frames are rendered
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    auto FrameScheduler::get_frame_interval() const noexcept -> std::optional<Clock::duration> {
+        switch(get_activity()) {
+            case WindowActivity::MINIMIZED:
+                if(!_config.minimized_frame_rate.has_value()) {
+                    return std::nullopt;
+                }
+                return to_frame_interval(*_config.minimized_frame_rate);
+            case WindowActivity::UNFOCUSED:
+                // The unfocused frame rate never raises the frame rate above the target frame rate
+                if(_config.target_frame_rate != 0 && _config.target_frame_rate < _config.unfocused_frame_rate) {
+                    return to_frame_interval(_config.target_frame_rate);
+                }
+                return to_frame_interval(_config.unfocused_frame_rate);
+            default:
+                return to_frame_interval(_config.target_frame_rate);
+        }
+    }
+
+    /**
+     * This function returns how long the loop can block on events before the next frame must be prepared. The precise
+     * wait at the end of the interval isn't included, so zero means that the loop must begin the next frame.
+     *
+     * @param now The current time
+     * @return    The timeout for the event wait in milliseconds
+     * @author    Cedric Hammes
+     * @since     18/10/2026
+     */
+    auto FrameScheduler::get_event_wait_timeout(const Clock::time_point now) const noexcept -> std::chrono::milliseconds {
+        if(!get_frame_interval().has_value()) {
+            return MAX_IDLE_TIMEOUT;
+        }
+
+        const auto idle_time = _next_frame_time - now - _sleep_overshoot - SPIN_THRESHOLD;
+        if(idle_time <= Clock::duration::zero()) {
+            return std::chrono::milliseconds::zero();
+        }
+        return std::min(std::chrono::duration_cast<std::chrono::milliseconds>(idle_time), MAX_IDLE_TIMEOUT);
+    }
+
+    /**
+     * This function waits precisely until the next frame is due and schedules the frame after it. This should only be
+     * called when the event wait timeout is zero.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    auto FrameScheduler::begin_frame() noexcept -> void {
+        wait_until(_next_frame_time);
+        schedule_next_frame(Clock::now());
+    }
+
+    /**
+     * This function schedules the next frame one interval after the previous scheduled frame. If the loop fell behind
+     * the schedule, the next frame is scheduled relative to the current time instead, so missed frames are not rendered
+     * in a burst.
+     *
+     * @param now The time at which the current frame begins
+     * @author    Cedric Hammes
+     * @since     18/10/2026
+     */
+    auto FrameScheduler::schedule_next_frame(const Clock::time_point now) noexcept -> void {
+        const auto frame_interval = get_frame_interval().value_or(Clock::duration::zero());
+        _next_frame_time += frame_interval;
+        if(_next_frame_time < now) {
+            _next_frame_time = now + frame_interval;
+        }
+    }
+
+    /**
+     * This function waits until the specified deadline. The system sleep is used until shortly before the deadline, the
+     * rest is spun. The oversleeping of each sleep is measured to adapt when the spinning starts.
+     *
+     * @param deadline The time to wait for
+     * @author         Cedric Hammes
+     * @since          18/10/2026
+     */
+    auto FrameScheduler::wait_until(const Clock::time_point deadline) noexcept -> void {
+        while(true) {
+            const auto sleep_start = Clock::now();
+            const auto sleep_duration = deadline - sleep_start - _sleep_overshoot - SPIN_THRESHOLD;
+            if(sleep_duration <= Clock::duration::zero()) {
+                break;
+            }
+
+            // Track the oversleeping as exponential moving average, so single outliers don't disable the sleep
+            std::this_thread::sleep_for(sleep_duration);
+            const auto overshoot = std::max(Clock::now() - sleep_start - sleep_duration, Clock::duration::zero());
+            _sleep_overshoot = (_sleep_overshoot * 7 + overshoot) / 8;
+        }
+
+        while(Clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+    }
+
+    auto FrameScheduler::get_activity() const noexcept -> WindowActivity {
+        if(_is_minimized) {
+            return WindowActivity::MINIMIZED;
+        }
+        return _is_focused ? WindowActivity::FOCUSED : WindowActivity::UNFOCUSED;
+    }
+}// namespace erebos
@@ -0,0 +1,173 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include "erebos/log.hpp"
+#include "erebos/mpsc_queue.hpp"
+#include "erebos/profiler.hpp"
+#include <thread>
+
+namespace erebos::log {
+    namespace {
+        constexpr usize RECORD_QUEUE_CAPACITY = 2048;
+        constexpr auto IDLE_SLEEP_DURATION = std::chrono::milliseconds {1};
+
+        class Backend final {
+            MPSCQueue<LogRecord, RECORD_QUEUE_CAPACITY> _records;
+            std::atomic<usize> _pushed_record_count;
+            std::atomic<usize> _written_record_count;
+            std::atomic<usize> _dropped_record_count;
+            std::atomic_bool _is_stop_requested;
+            std::thread _thread;
+
+        public:
+            // The default logger is created before the backend, so it's destroyed after the backend thread was joined
+            Backend() noexcept
+                : _records {}
+                , _pushed_record_count {0}
+                , _written_record_count {0}
+                , _dropped_record_count {0}
+                , _is_stop_requested {false}
+                , _thread {} {
+                static_cast<void>(spdlog::default_logger_raw());
+                _thread = std::thread {[this]() {
+                    run();
+                }};
+            }
+
+            ~Backend() noexcept {
+                _is_stop_requested.store(true, std::memory_order_release);
+                _thread.join();
+            }
+
+            Backend(Backend&& other) noexcept = delete;
+            EREBOS_DELETE_COPY(Backend);
+
+            auto push(const LogRecord& record) noexcept -> void {
+                if(!_records.try_push(record)) [[unlikely]] {
+                    delete record.message;
+                    _dropped_record_count.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+                _pushed_record_count.fetch_add(1, std::memory_order_release);
+            }
+
+            auto flush() noexcept -> void {
+                const auto pushed_record_count = _pushed_record_count.load(std::memory_order_acquire);
+                while(_written_record_count.load(std::memory_order_acquire) < pushed_record_count) {
+                    std::this_thread::yield();
+                }
+                spdlog::default_logger_raw()->flush();
+            }
+
+            [[nodiscard]] auto get_dropped_record_count() const noexcept -> usize {
+                return _dropped_record_count.load(std::memory_order_relaxed);
+            }
+
+        private:
+            auto run() noexcept -> void {
+                EREBOS_PROFILE_THREAD_NAME("Log Thread");
+                fmt::memory_buffer buffer {};
+                usize reported_dropped_record_count = 0;
+                while(true) {
+                    // The queue is drained before stopping, so no record pushed before the destruction is lost
+                    const auto is_stop_requested = _is_stop_requested.load(std::memory_order_acquire);
+                    usize written_record_count = 0;
+                    while(const auto record = _records.try_pop()) {
+                        write(buffer, *record);
+                        written_record_count++;
+                    }
+
+                    const auto dropped_record_count = _dropped_record_count.load(std::memory_order_relaxed);
+                    if(dropped_record_count != reported_dropped_record_count) {
+                        spdlog::default_logger_raw()->warn("Dropped {} log records, the log queue was full",
+                                                           dropped_record_count - reported_dropped_record_count);
+                        reported_dropped_record_count = dropped_record_count;
+                    }
+
+                    if(written_record_count > 0) {
+                        _written_record_count.fetch_add(written_record_count, std::memory_order_release);
+                    }
+                    else if(is_stop_requested) {
+                        break;
+                    }
+                    else {
+                        std::this_thread::sleep_for(IDLE_SLEEP_DURATION);
+                    }
+                }
+            }
+
+            static auto write(fmt::memory_buffer& buffer, const LogRecord& record) noexcept -> void {
+                EREBOS_PROFILE_SCOPE("log::Backend::write");
+                if(record.message != nullptr) {
+                    spdlog::default_logger_raw()->log(record.time, record.location, record.level, *record.message);
+                    delete record.message;
+                    return;
+                }
+
+                const std::string_view format {record.format_data, record.format_size};
+                buffer.clear();
+                try {
+                    record.format_function(buffer, format, record.payload.data());
+                }
+                catch(const fmt::format_error& error) {
+                    buffer.clear();
+                    fmt::format_to(std::back_inserter(buffer), "Unable to format log message '{}': {}", format, error.what());
+                }
+                spdlog::default_logger_raw()->log(record.time,
+                                                  record.location,
+                                                  record.level,
+                                                  spdlog::string_view_t {buffer.data(), buffer.size()});
+            }
+        };
+
+        [[nodiscard]] auto get_backend() noexcept -> Backend& {
+            static Backend backend {};
+            return backend;
+        }
+    }// namespace
+
+    namespace detail {
+        auto push_record(const LogRecord& record) noexcept -> void {
+            get_backend().push(record);
+        }
+    }// namespace detail
+
+    /**
+     * This function blocks until all log records, which were pushed before the call, are passed to the logger and
+     * flushes the default logger.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    auto flush() noexcept -> void {
+        get_backend().flush();
+    }
+
+    /**
+     * This function returns the count of log records, which were dropped because the queue of the backend thread was
+     * full.
+     *
+     * @return The count of dropped log records
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    auto get_dropped_record_count() noexcept -> usize {
+        return get_backend().get_dropped_record_count();
+    }
+}// namespace erebos::log
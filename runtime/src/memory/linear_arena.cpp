@@ -0,0 +1,189 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include "erebos/memory/linear_arena.hpp"
+
+namespace erebos::memory {
+    namespace {
+        constexpr usize chunk_header_size = alignof(std::max_align_t) > 16 ? alignof(std::max_align_t) : 16;
+
+        [[nodiscard]] inline auto align_up(u8* pointer, usize alignment) noexcept -> u8* {
+            const auto address = reinterpret_cast<std::uintptr_t>(pointer);// NOLINT
+            return reinterpret_cast<u8*>((address + alignment - 1) & ~(alignment - 1));// NOLINT
+        }
+    }// namespace
+
+    /**
+     * This constructor creates an empty arena. The first chunk gets allocated with the first allocation.
+     *
+     * @param chunk_size The minimum size of the chunks allocated from the upstream resource
+     * @param upstream   The resource to allocate the chunks from
+     * @author           Cedric Hammes
+     * @since            18/10/2026
+     */
+    LinearArena::LinearArena(usize chunk_size, std::pmr::memory_resource* upstream) noexcept
+        : _upstream {upstream}
+        , _chunk_size {chunk_size}
+        , _first_chunk {nullptr}
+        , _current_chunk {nullptr}
+        , _position {nullptr}
+        , _end {nullptr}
+        , _statistics {} {
+    }
+
+    LinearArena::LinearArena(LinearArena&& other) noexcept
+        : _upstream {other._upstream}
+        , _chunk_size {other._chunk_size}
+        , _first_chunk {other._first_chunk}
+        , _current_chunk {other._current_chunk}
+        , _position {other._position}
+        , _end {other._end}
+        , _statistics {other._statistics} {
+        other._first_chunk = nullptr;
+        other._current_chunk = nullptr;
+        other._position = nullptr;
+        other._end = nullptr;
+        other._statistics = {};
+    }
+
+    LinearArena::~LinearArena() noexcept {
+        release_chunks();
+    }
+
+    /**
+     * This function releases all allocations of this arena at once. The chunks stay allocated and get reused by
+     * the following allocations. The allocation count and peak are reset too, so the statistics only cover the
+     * allocations since the last reset.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    auto LinearArena::reset() noexcept -> void {
+        if(_first_chunk != nullptr) {
+            rewind({_first_chunk, reinterpret_cast<u8*>(_first_chunk) + chunk_header_size, 0});// NOLINT
+        }
+        _statistics.allocation_count = 0;
+        _statistics.peak_bytes = 0;
+    }
+
+    /**
+     * This function releases all allocations, which were done after the specified marker was acquired.
+     *
+     * @param marker The marker to rewind to
+     * @author       Cedric Hammes
+     * @since        18/10/2026
+     */
+    auto LinearArena::rewind(const Marker& marker) noexcept -> void {
+        if(marker.chunk == nullptr) {
+            if(_first_chunk != nullptr) {
+                reset();
+            }
+            return;
+        }
+
+        _current_chunk = marker.chunk;
+        _position = marker.position;
+        _end = reinterpret_cast<u8*>(marker.chunk) + marker.chunk->size;// NOLINT
+        _statistics.allocated_bytes = marker.allocated_bytes;
+    }
+
+    auto LinearArena::do_allocate(usize bytes, usize alignment) -> void* {
+        auto* pointer = align_up(_position, alignment);
+        if(_position == nullptr || pointer + bytes > _end) {
+            // Reuse the following chunks (if available) or insert a new chunk after the current chunk
+            const auto required_size = chunk_header_size + bytes + alignment;
+            auto* next_chunk = _current_chunk != nullptr ? _current_chunk->next : _first_chunk;
+            while(next_chunk != nullptr && next_chunk->size < required_size) {
+                next_chunk = next_chunk->next;
+            }
+
+            if(next_chunk == nullptr) {
+                const auto chunk_size = std::max(_chunk_size, required_size);
+                next_chunk = static_cast<Chunk*>(_upstream->allocate(chunk_size, alignof(std::max_align_t)));
+                next_chunk->size = chunk_size;
+                next_chunk->next = nullptr;
+                if(_current_chunk != nullptr) {
+                    next_chunk->next = _current_chunk->next;
+                    _current_chunk->next = next_chunk;
+                }
+                else {
+                    next_chunk->next = _first_chunk;
+                    _first_chunk = next_chunk;
+                }
+                _statistics.capacity += chunk_size;
+            }
+
+            _current_chunk = next_chunk;
+            _position = reinterpret_cast<u8*>(next_chunk) + chunk_header_size;// NOLINT
+            _end = reinterpret_cast<u8*>(next_chunk) + next_chunk->size;      // NOLINT
+            pointer = align_up(_position, alignment);
+        }
+
+        _statistics.allocation_count += 1;
+        _statistics.allocated_bytes += (pointer + bytes) - _position;
+        _statistics.peak_bytes = std::max(_statistics.peak_bytes, _statistics.allocated_bytes);
+        _position = pointer + bytes;
+        return pointer;
+    }
+
+    auto LinearArena::do_deallocate([[maybe_unused]] void* pointer,
+                                    [[maybe_unused]] usize bytes,
+                                    [[maybe_unused]] usize alignment) -> void {
+    }
+
+    auto LinearArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool {
+        return this == &other;
+    }
+
+    auto LinearArena::release_chunks() noexcept -> void {
+        auto* chunk = _first_chunk;
+        while(chunk != nullptr) {
+            auto* next_chunk = chunk->next;
+            _upstream->deallocate(chunk, chunk->size, alignof(std::max_align_t));
+            chunk = next_chunk;
+        }
+        _first_chunk = nullptr;
+        _current_chunk = nullptr;
+        _position = nullptr;
+        _end = nullptr;
+        _statistics = {};
+    }
+
+    auto LinearArena::operator=(LinearArena&& other) noexcept -> LinearArena& {
+        release_chunks();
+        _upstream = other._upstream;
+        _chunk_size = other._chunk_size;
+        _first_chunk = other._first_chunk;
+        _current_chunk = other._current_chunk;
+        _position = other._position;
+        _end = other._end;
+        _statistics = other._statistics;
+        other._first_chunk = nullptr;
+        other._current_chunk = nullptr;
+        other._position = nullptr;
+        other._end = nullptr;
+        other._statistics = {};
+        return *this;
+    }
+
+    auto get_frame_arena() noexcept -> LinearArena& {
+        thread_local LinearArena frame_arena {};
+        return frame_arena;
+    }
+}// namespace erebos::memory
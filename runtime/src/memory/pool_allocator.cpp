@@ -0,0 +1,141 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include "erebos/memory/pool_allocator.hpp"
+
+namespace erebos::memory {
+    namespace {
+        constexpr usize page_header_size = alignof(std::max_align_t);
+
+        [[nodiscard]] constexpr auto to_block_size(usize size) noexcept -> usize {
+            constexpr auto alignment = alignof(std::max_align_t);
+            return (std::max(size, sizeof(void*)) + alignment - 1) & ~(alignment - 1);
+        }
+    }// namespace
+
+    /**
+     * This constructor creates an empty pool. The first page gets allocated with the first allocation.
+     *
+     * @param block_size      The size of a single block in the pool
+     * @param blocks_per_page The count of blocks allocated at once from the upstream resource
+     * @param upstream        The resource to allocate the pages and oversized allocations from
+     * @author                Cedric Hammes
+     * @since                 18/10/2026
+     */
+    PoolAllocator::PoolAllocator(usize block_size, usize blocks_per_page, std::pmr::memory_resource* upstream) noexcept
+        : _upstream {upstream}
+        , _block_size {to_block_size(block_size)}
+        , _blocks_per_page {std::max<usize>(blocks_per_page, 1)}
+        , _free_list {nullptr}
+        , _pages {nullptr}
+        , _statistics {} {
+    }
+
+    PoolAllocator::PoolAllocator(PoolAllocator&& other) noexcept
+        : _upstream {other._upstream}
+        , _block_size {other._block_size}
+        , _blocks_per_page {other._blocks_per_page}
+        , _free_list {other._free_list}
+        , _pages {other._pages}
+        , _statistics {other._statistics} {
+        other._free_list = nullptr;
+        other._pages = nullptr;
+        other._statistics = {};
+    }
+
+    PoolAllocator::~PoolAllocator() noexcept {
+        release_pages();
+    }
+
+    auto PoolAllocator::do_allocate(usize bytes, usize alignment) -> void* {
+        if(!fits_into_block(bytes, alignment)) {
+            return _upstream->allocate(bytes, alignment);
+        }
+
+        if(_free_list == nullptr) {
+            allocate_page();
+        }
+
+        auto* block = _free_list;
+        _free_list = block->next;
+        _statistics.allocation_count += 1;
+        _statistics.allocated_bytes += _block_size;
+        _statistics.peak_bytes = std::max(_statistics.peak_bytes, _statistics.allocated_bytes);
+        return block;
+    }
+
+    auto PoolAllocator::do_deallocate(void* pointer, usize bytes, usize alignment) -> void {
+        if(!fits_into_block(bytes, alignment)) {
+            _upstream->deallocate(pointer, bytes, alignment);
+            return;
+        }
+
+        auto* block = static_cast<FreeBlock*>(pointer);
+        block->next = _free_list;
+        _free_list = block;
+        _statistics.allocated_bytes -= _block_size;
+    }
+
+    auto PoolAllocator::do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool {
+        return this == &other;
+    }
+
+    auto PoolAllocator::allocate_page() -> void {
+        const auto page_size = page_header_size + _block_size * _blocks_per_page;
+        auto* page = static_cast<Page*>(_upstream->allocate(page_size, alignof(std::max_align_t)));
+        page->next = _pages;
+        _pages = page;
+        _statistics.capacity += _block_size * _blocks_per_page;
+
+        // Push all blocks of the page in reverse order, so the blocks are handed out in address order
+        auto* blocks = reinterpret_cast<u8*>(page) + page_header_size;// NOLINT
+        for(auto i = _blocks_per_page; i > 0; i--) {
+            auto* block = reinterpret_cast<FreeBlock*>(blocks + (i - 1) * _block_size);// NOLINT
+            block->next = _free_list;
+            _free_list = block;
+        }
+    }
+
+    auto PoolAllocator::release_pages() noexcept -> void {
+        const auto page_size = page_header_size + _block_size * _blocks_per_page;
+        auto* page = _pages;
+        while(page != nullptr) {
+            auto* next_page = page->next;
+            _upstream->deallocate(page, page_size, alignof(std::max_align_t));
+            page = next_page;
+        }
+        _pages = nullptr;
+        _free_list = nullptr;
+        _statistics = {};
+    }
+
+    auto PoolAllocator::operator=(PoolAllocator&& other) noexcept -> PoolAllocator& {
+        release_pages();
+        _upstream = other._upstream;
+        _block_size = other._block_size;
+        _blocks_per_page = other._blocks_per_page;
+        _free_list = other._free_list;
+        _pages = other._pages;
+        _statistics = other._statistics;
+        other._free_list = nullptr;
+        other._pages = nullptr;
+        other._statistics = {};
+        return *this;
+    }
+}// namespace erebos::memory
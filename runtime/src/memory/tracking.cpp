@@ -0,0 +1,279 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include "erebos/memory/tracking.hpp"
+#include "erebos/platform/platform.hpp"
+#include <algorithm>
+#include <mimalloc.h>
+#include <string>
+
+#ifdef EREBOS_ALLOCATION_TRACKING
+#ifdef PLATFORM_UNIX
+#include <execinfo.h>
+#endif
+#endif
+
+namespace erebos::memory {
+    namespace {
+        auto mi_stats_output(const char* message, void* argument) noexcept -> void {
+            static_cast<std::string*>(argument)->append(message);
+        }
+
+#ifdef EREBOS_ALLOCATION_TRACKING
+        constexpr usize max_tag_count = 64;
+        constexpr usize max_sample_count = 256;
+
+        struct TagCounters final {
+            std::atomic<const char*> tag;
+            std::atomic<usize> allocation_count;
+            std::atomic<usize> allocated_bytes;
+        };
+
+        struct GlobalCounters final {
+            std::atomic<usize> allocation_count;
+            std::atomic<usize> deallocation_count;
+            std::atomic<usize> allocated_bytes;
+            std::atomic<usize> live_bytes;
+            std::atomic<usize> peak_live_bytes;
+        };
+
+        // All thread-local state is trivially constructible, so accessing it from operator new doesn't allocate
+        thread_local AllocationCounters thread_counters {};
+        thread_local const char* thread_tag = nullptr;
+        thread_local usize thread_sample_countdown = 0;
+        thread_local bool thread_is_in_hook = false;
+
+        GlobalCounters global_counters {};
+        std::array<TagCounters, max_tag_count> tag_counters {};
+        std::atomic<usize> sample_rate {0};
+
+        std::atomic_flag samples_lock {};
+        std::array<AllocationSample, max_sample_count> samples {};
+        usize sample_write_index = 0;
+        usize sample_count = 0;
+
+        [[nodiscard]] auto find_tag_counters(const char* tag) noexcept -> TagCounters* {
+            const auto start_index = (reinterpret_cast<std::uintptr_t>(tag) >> 4) % max_tag_count;// NOLINT
+            for(usize i = 0; i < max_tag_count; i++) {
+                auto& counters = tag_counters[(start_index + i) % max_tag_count];
+                const char* expected = nullptr;
+                if(counters.tag.compare_exchange_strong(expected, tag, std::memory_order_acq_rel) || expected == tag) {
+                    return &counters;
+                }
+            }
+            return nullptr;
+        }
+
+        auto capture_sample(const usize size) noexcept -> void {
+            AllocationSample sample {thread_tag, size, 0, {}};
+#ifdef PLATFORM_WINDOWS
+            sample.frame_count = ::RtlCaptureStackBackTrace(2, static_cast<DWORD>(sample.frames.size()), sample.frames.data(), nullptr);
+#elif defined(PLATFORM_UNIX)
+            sample.frame_count = static_cast<usize>(::backtrace(sample.frames.data(), static_cast<int>(sample.frames.size())));
+#endif
+
+            while(samples_lock.test_and_set(std::memory_order_acquire)) {
+            }
+            samples[sample_write_index] = sample;
+            sample_write_index = (sample_write_index + 1) % max_sample_count;
+            sample_count = std::min(sample_count + 1, max_sample_count);
+            samples_lock.clear(std::memory_order_release);
+        }
+
+        auto update_peak(std::atomic<usize>& peak, const usize value) noexcept -> void {
+            auto current_peak = peak.load(std::memory_order_relaxed);
+            while(value > current_peak && !peak.compare_exchange_weak(current_peak, value, std::memory_order_relaxed)) {
+            }
+        }
+#endif
+    }// namespace
+
+#ifdef EREBOS_ALLOCATION_TRACKING
+    AllocationScope::AllocationScope(const char* tag) noexcept
+        : _previous_tag {thread_tag}
+        , _begin_counters {thread_counters} {
+        thread_tag = tag;
+        thread_counters.peak_live_bytes = thread_counters.live_bytes;
+    }
+
+    AllocationScope::~AllocationScope() noexcept {
+        thread_tag = _previous_tag;
+        thread_counters.peak_live_bytes = std::max(thread_counters.peak_live_bytes, _begin_counters.peak_live_bytes);
+    }
+
+    auto AllocationScope::get_counters() const noexcept -> AllocationCounters {
+        return {thread_counters.allocation_count - _begin_counters.allocation_count,
+                thread_counters.deallocation_count - _begin_counters.deallocation_count,
+                thread_counters.allocated_bytes - _begin_counters.allocated_bytes,
+                thread_counters.live_bytes - std::min(thread_counters.live_bytes, _begin_counters.live_bytes),
+                thread_counters.peak_live_bytes - std::min(thread_counters.peak_live_bytes, _begin_counters.live_bytes)};
+    }
+
+    auto get_thread_allocation_counters() noexcept -> AllocationCounters {
+        return thread_counters;
+    }
+
+    auto get_global_allocation_counters() noexcept -> AllocationCounters {
+        return {global_counters.allocation_count.load(std::memory_order_relaxed),
+                global_counters.deallocation_count.load(std::memory_order_relaxed),
+                global_counters.allocated_bytes.load(std::memory_order_relaxed),
+                global_counters.live_bytes.load(std::memory_order_relaxed),
+                global_counters.peak_live_bytes.load(std::memory_order_relaxed)};
+    }
+
+    auto set_allocation_sample_rate(usize every_nth_allocation) noexcept -> void {
+        sample_rate.store(every_nth_allocation, std::memory_order_relaxed);
+    }
+
+    auto get_allocation_samples() -> std::vector<AllocationSample> {
+        while(samples_lock.test_and_set(std::memory_order_acquire)) {
+        }
+        std::vector<AllocationSample> result {samples.cbegin(), samples.cbegin() + static_cast<std::ptrdiff_t>(sample_count)};
+        samples_lock.clear(std::memory_order_release);
+        return result;
+    }
+
+    namespace detail {
+        auto on_allocate(void* pointer) noexcept -> void {
+            if(pointer == nullptr || thread_is_in_hook) {
+                return;
+            }
+            thread_is_in_hook = true;
+
+            const auto size = ::mi_usable_size(pointer);
+            thread_counters.allocation_count += 1;
+            thread_counters.allocated_bytes += size;
+            thread_counters.live_bytes += size;
+            thread_counters.peak_live_bytes = std::max(thread_counters.peak_live_bytes, thread_counters.live_bytes);
+
+            global_counters.allocation_count.fetch_add(1, std::memory_order_relaxed);
+            global_counters.allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+            update_peak(global_counters.peak_live_bytes, global_counters.live_bytes.fetch_add(size, std::memory_order_relaxed) + size);
+
+            if(thread_tag != nullptr) {
+                if(auto* counters = find_tag_counters(thread_tag); counters != nullptr) {
+                    counters->allocation_count.fetch_add(1, std::memory_order_relaxed);
+                    counters->allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+                }
+            }
+
+            if(const auto rate = sample_rate.load(std::memory_order_relaxed); rate != 0) {
+                if(thread_sample_countdown == 0) {
+                    thread_sample_countdown = rate;
+                    capture_sample(size);
+                }
+                thread_sample_countdown -= 1;
+            }
+            thread_is_in_hook = false;
+        }
+
+        auto on_deallocate(void* pointer) noexcept -> void {
+            if(pointer == nullptr || thread_is_in_hook) {
+                return;
+            }
+
+            // Memory can be freed by another thread than the allocating thread, so the thread's live bytes are clamped
+            const auto size = ::mi_usable_size(pointer);
+            thread_counters.deallocation_count += 1;
+            thread_counters.live_bytes -= std::min(thread_counters.live_bytes, size);
+            global_counters.deallocation_count.fetch_add(1, std::memory_order_relaxed);
+            global_counters.live_bytes.fetch_sub(size, std::memory_order_relaxed);
+        }
+    }// namespace detail
+#else
+    AllocationScope::AllocationScope([[maybe_unused]] const char* tag) noexcept {
+    }
+
+    AllocationScope::~AllocationScope() noexcept = default;
+
+    auto AllocationScope::get_counters() const noexcept -> AllocationCounters {
+        return {};
+    }
+
+    auto get_thread_allocation_counters() noexcept -> AllocationCounters {
+        return {};
+    }
+
+    auto get_global_allocation_counters() noexcept -> AllocationCounters {
+        return {};
+    }
+
+    auto set_allocation_sample_rate([[maybe_unused]] usize every_nth_allocation) noexcept -> void {
+    }
+
+    auto get_allocation_samples() -> std::vector<AllocationSample> {
+        return {};
+    }
+
+    namespace detail {
+        auto on_allocate([[maybe_unused]] void* pointer) noexcept -> void {
+        }
+
+        auto on_deallocate([[maybe_unused]] void* pointer) noexcept -> void {
+        }
+    }// namespace detail
+#endif
+
+    /**
+     * This function logs the global allocation counters, the counters of all tags, the sampled call stacks and the
+     * statistics of mimalloc. This is intended to be called periodically, not in every frame.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    auto dump_allocation_statistics() noexcept -> void {
+#ifdef EREBOS_ALLOCATION_TRACKING
+        const auto counters = get_global_allocation_counters();
+        SPDLOG_INFO("Allocations -> {} allocations, {} deallocations, {} bytes allocated, {} bytes live (peak {} bytes)",
+                    counters.allocation_count,
+                    counters.deallocation_count,
+                    counters.allocated_bytes,
+                    counters.live_bytes,
+                    counters.peak_live_bytes);
+
+        for(const auto& tag_counter : tag_counters) {
+            if(const auto* tag = tag_counter.tag.load(std::memory_order_acquire); tag != nullptr) {
+                SPDLOG_INFO("Allocations of '{}' -> {} allocations, {} bytes allocated",
+                            tag,
+                            tag_counter.allocation_count.load(std::memory_order_relaxed),
+                            tag_counter.allocated_bytes.load(std::memory_order_relaxed));
+            }
+        }
+
+        for(const auto& sample : get_allocation_samples()) {
+            SPDLOG_INFO("Sampled allocation of {} bytes in '{}':", sample.size, sample.tag != nullptr ? sample.tag : "untagged");
+#ifdef PLATFORM_UNIX
+            auto* symbols = ::backtrace_symbols(sample.frames.data(), static_cast<int>(sample.frame_count));
+            for(usize i = 0; i < sample.frame_count; i++) {
+                SPDLOG_INFO("  #{} {}", i, symbols != nullptr ? symbols[i] : "??");
+            }
+            ::free(symbols);// NOLINT
+#else
+            for(usize i = 0; i < sample.frame_count; i++) {
+                SPDLOG_INFO("  #{} {}", i, fmt::ptr(sample.frames[i]));
+            }
+#endif
+        }
+#endif
+
+        std::string mi_statistics {};
+        ::mi_stats_print_out(mi_stats_output, &mi_statistics);
+        SPDLOG_INFO("mimalloc statistics:\n{}", mi_statistics);
+    }
+}// namespace erebos::memory
@@ -0,0 +1,366 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include "erebos/metrics.hpp"
+#include "erebos/platform/platform.hpp"
+#include <algorithm>
+#include <bit>
+#include <cctype>
+#include <cmath>
+#include <iterator>
+#include <limits>
+
+namespace erebos::metrics {
+    namespace {
+        constexpr std::string_view CSV_HEADER = "frame_index,frame_time_ms,cpu_time_ms,gpu_time_ms,command_buffer_count,submit_count,"
+                                                "frame_arena_bytes,live_heap_bytes,device_memory_usage,device_memory_budget,uploaded_bytes\n";
+
+        [[nodiscard]] constexpr auto to_milliseconds(const int64_t nanoseconds) noexcept -> double {
+            return static_cast<double>(nanoseconds) / 1'000'000.0;
+        }
+
+        [[nodiscard]] constexpr auto to_milliseconds(const std::chrono::nanoseconds duration) noexcept -> double {
+            return to_milliseconds(static_cast<int64_t>(duration.count()));
+        }
+
+        [[nodiscard]] auto get_format_of(const std::filesystem::path& path) noexcept -> MetricsFormat {
+            auto extension = path.extension().string();
+            std::transform(extension.begin(), extension.end(), extension.begin(), [](const char character) {
+                return static_cast<char>(std::tolower(static_cast<u8>(character)));
+            });
+            return extension == ".json" ? MetricsFormat::JSON : MetricsFormat::CSV;
+        }
+
+        // Summarizes everything except the frame time percentiles, they are computed by the caller
+        [[nodiscard]] auto summarize_averages(const detail::MetricsTotals& totals) noexcept -> MetricsSummary {
+            MetricsSummary summary {};
+            summary.sample_count = totals.sample_count;
+            if(totals.sample_count == 0) {
+                return summary;
+            }
+
+            const auto count = static_cast<double>(totals.sample_count);
+            summary.average_cpu_time = to_milliseconds(totals.cpu_time) / count;
+            summary.average_gpu_time = to_milliseconds(totals.gpu_time) / count;
+            summary.average_command_buffer_count = static_cast<double>(totals.command_buffer_count) / count;
+            summary.average_submit_count = static_cast<double>(totals.submit_count) / count;
+            summary.upload_bandwidth = totals.frame_time > 0
+                                               ? static_cast<double>(totals.uploaded_bytes) * 1'000'000'000.0 / static_cast<double>(totals.frame_time)
+                                               : 0.0;
+            return summary;
+        }
+    }// namespace
+
+    namespace detail {
+        auto MetricsTotals::add(const FrameSample& sample) noexcept -> void {
+            sample_count++;
+            frame_time += static_cast<int64_t>(sample.frame_time.count());
+            cpu_time += static_cast<int64_t>(sample.cpu_time.count());
+            gpu_time += static_cast<int64_t>(sample.gpu_time.count());
+            command_buffer_count += sample.command_buffer_count;
+            submit_count += sample.submit_count;
+            uploaded_bytes += sample.uploaded_bytes;
+        }
+
+        auto MetricsTotals::summarize(const std::span<int64_t> frame_times) const noexcept -> MetricsSummary {
+            auto summary = summarize_averages(*this);
+            if(sample_count == 0) {
+                return summary;
+            }
+
+            summary.frame_time_p50 = to_milliseconds(compute_percentile(frame_times, 50.0));
+            summary.frame_time_p95 = to_milliseconds(compute_percentile(frame_times, 95.0));
+            summary.frame_time_p99 = to_milliseconds(compute_percentile(frame_times, 99.0));
+            return summary;
+        }
+
+        auto MetricsTotals::summarize(const PercentileHistogram& frame_times) const noexcept -> MetricsSummary {
+            auto summary = summarize_averages(*this);
+            summary.frame_time_p50 = to_milliseconds(frame_times.compute_percentile(50.0));
+            summary.frame_time_p95 = to_milliseconds(frame_times.compute_percentile(95.0));
+            summary.frame_time_p99 = to_milliseconds(frame_times.compute_percentile(99.0));
+            return summary;
+        }
+
+        PercentileHistogram::PercentileHistogram()
+            : _counts(BUCKET_COUNT, 0)
+            , _count {0}
+            , _min {std::numeric_limits<int64_t>::max()}
+            , _max {0} {
+        }
+
+        /**
+         * This function counts the value in its bucket. Negative values are counted as zero.
+         *
+         * @param value The value to count
+         * @author      Cedric Hammes
+         * @since       18/10/2026
+         */
+        auto PercentileHistogram::add(const int64_t value) noexcept -> void {
+            // Values below two sub-bucket counts are their own bucket, all other values are bucketed by their highest
+            // bits. The bucket of a value is continuous with the buckets of the smaller values.
+            const auto clamped_value = static_cast<u64>(std::max<int64_t>(value, 0));
+            const auto bit_width = static_cast<u32>(std::bit_width(clamped_value));
+            auto bucket = static_cast<usize>(clamped_value);
+            if(bit_width > SUB_BUCKET_BITS + 1) {
+                const auto shift = bit_width - SUB_BUCKET_BITS - 1;
+                bucket = (shift + 1) * SUB_BUCKET_COUNT + static_cast<usize>((clamped_value >> shift) - SUB_BUCKET_COUNT);
+            }
+
+            _counts[bucket]++;
+            _count++;
+            _min = std::min(_min, static_cast<int64_t>(clamped_value));
+            _max = std::max(_max, static_cast<int64_t>(clamped_value));
+        }
+
+        /**
+         * This function returns the percentile of the counted values with the nearest-rank method.
+         *
+         * @param percentile The percentile between 0 and 100
+         * @return           The value at the percentile or zero if no value was counted
+         * @author           Cedric Hammes
+         * @since            18/10/2026
+         */
+        auto PercentileHistogram::compute_percentile(const double percentile) const noexcept -> int64_t {
+            if(_count == 0) {
+                return 0;
+            }
+
+            const auto rank = std::clamp<u64>(static_cast<u64>(std::ceil(percentile / 100.0 * static_cast<double>(_count))), 1, _count);
+            u64 counted_values = 0;
+            usize bucket = 0;
+            for(; bucket < _counts.size(); bucket++) {
+                counted_values += _counts[bucket];
+                if(counted_values >= rank) {
+                    break;
+                }
+            }
+
+            // The first two sub-bucket counts of buckets contain a single value, all other buckets a power of two
+            if(bucket < 2 * SUB_BUCKET_COUNT) {
+                return std::clamp(static_cast<int64_t>(bucket), _min, _max);
+            }
+            const auto shift = bucket / SUB_BUCKET_COUNT - 1;
+            const auto lower_bound = (SUB_BUCKET_COUNT + bucket % SUB_BUCKET_COUNT) << shift;
+            const auto middle = static_cast<int64_t>(lower_bound + (usize {1} << shift) / 2);
+            return std::clamp(middle, _min, _max);
+        }
+    }// namespace detail
+
+    /**
+     * This function returns the percentile of the values with the nearest-rank method. The values are reordered.
+     *
+     * @param values     The values, must not be empty
+     * @param percentile The percentile between 0 and 100
+     * @return           The value at the percentile
+     * @author           Cedric Hammes
+     * @since            18/10/2026
+     */
+    auto compute_percentile(const std::span<int64_t> values, const double percentile) noexcept -> int64_t {
+        const auto rank = static_cast<usize>(std::ceil(percentile / 100.0 * static_cast<double>(values.size())));
+        const auto index = std::clamp<usize>(rank, 1, values.size()) - 1;
+        std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(index), values.end());
+        return values[index];
+    }
+
+    FrameMetrics::FrameMetrics(const usize window_size) noexcept
+        : _samples {}
+        , _window_size {std::max<usize>(window_size, 1)}
+        , _next_sample {0}
+        , _frame_times {} {
+        _samples.reserve(_window_size);
+        _frame_times.reserve(_window_size);
+    }
+
+    /**
+     * This function adds the sample into the window. If the window is full, the oldest sample is replaced.
+     *
+     * @param sample The sample of the last frame
+     * @author       Cedric Hammes
+     * @since        18/10/2026
+     */
+    auto FrameMetrics::add_sample(const FrameSample& sample) noexcept -> void {
+        if(_samples.size() < _window_size) {
+            _samples.push_back(sample);
+        }
+        else {
+            _samples[_next_sample] = sample;
+        }
+        _next_sample = (_next_sample + 1) % _window_size;
+    }
+
+    /**
+     * This function summarizes the samples in the window.
+     *
+     * @return The summary of the window
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    auto FrameMetrics::get_summary() const noexcept -> MetricsSummary {
+        detail::MetricsTotals totals {};
+        _frame_times.clear();
+        for(const auto& sample : _samples) {
+            totals.add(sample);
+            _frame_times.push_back(static_cast<int64_t>(sample.frame_time.count()));
+        }
+        return totals.summarize(_frame_times);
+    }
+
+    /**
+     * This function returns the last added sample. The window must not be empty.
+     *
+     * @return The last sample
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    auto FrameMetrics::get_last_sample() const noexcept -> const FrameSample& {
+        return _samples[(_next_sample + _window_size - 1) % _window_size];
+    }
+
+    /**
+     * This constructor opens the file and writes the header. Files with the extension .json are written as JSON, all
+     * other files as CSV.
+     *
+     * @param path The path of the metrics file
+     * @author     Cedric Hammes
+     * @since      18/10/2026
+     */
+    MetricsWriter::MetricsWriter(const std::filesystem::path& path)
+        : _file {std::fopen(path.string().c_str(), "wb")}
+        , _format {get_format_of(path)}
+        , _frame_times {}
+        , _totals {} {
+        if(_file == nullptr) {
+            throw std::runtime_error {fmt::format("Unable to open metrics file '{}': {}", path.string(), platform::get_last_error())};
+        }
+
+        if(_format == MetricsFormat::JSON) {
+            std::fputs("{\"samples\":[\n", _file);
+        }
+        else {
+            std::fwrite(CSV_HEADER.data(), 1, CSV_HEADER.size(), _file);
+        }
+    }
+
+    MetricsWriter::MetricsWriter(MetricsWriter&& other) noexcept
+        : _file {other._file}
+        , _format {other._format}
+        , _frame_times {std::move(other._frame_times)}
+        , _totals {other._totals} {
+        other._file = nullptr;
+    }
+
+    /**
+     * This destructor writes the footer of the file and closes it.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    MetricsWriter::~MetricsWriter() noexcept {
+        if(_file == nullptr) {
+            return;
+        }
+
+        if(_format == MetricsFormat::JSON) {
+            const auto summary = get_summary();
+            fmt::print(_file,
+                       "\n],\"summary\":{{\"sample_count\":{},\"frame_time_p50_ms\":{:.4f},\"frame_time_p95_ms\":{:.4f},"
+                       "\"frame_time_p99_ms\":{:.4f},\"average_cpu_time_ms\":{:.4f},\"average_gpu_time_ms\":{:.4f},"
+                       "\"average_command_buffer_count\":{:.2f},\"average_submit_count\":{:.2f},\"upload_bandwidth\":{:.1f}}}}}\n",
+                       summary.sample_count,
+                       summary.frame_time_p50,
+                       summary.frame_time_p95,
+                       summary.frame_time_p99,
+                       summary.average_cpu_time,
+                       summary.average_gpu_time,
+                       summary.average_command_buffer_count,
+                       summary.average_submit_count,
+                       summary.upload_bandwidth);
+        }
+        std::fclose(_file);
+        _file = nullptr;
+    }
+
+    /**
+     * This function appends the sample to the file.
+     *
+     * @param sample The sample to write
+     * @author       Cedric Hammes
+     * @since        18/10/2026
+     */
+    auto MetricsWriter::write_sample(const FrameSample& sample) noexcept -> void {
+        fmt::memory_buffer buffer {};
+        if(_format == MetricsFormat::JSON) {
+            fmt::format_to(std::back_inserter(buffer),
+                           R"({}{{"frame_index":{},"frame_time_ms":{:.4f},"cpu_time_ms":{:.4f},"gpu_time_ms":{:.4f},)"
+                           R"("command_buffer_count":{},"submit_count":{},"frame_arena_bytes":{},"live_heap_bytes":{},)"
+                           R"("device_memory_usage":{},"device_memory_budget":{},"uploaded_bytes":{}}})",
+                           _totals.sample_count == 0 ? "" : ",\n",
+                           sample.frame_index,
+                           to_milliseconds(sample.frame_time),
+                           to_milliseconds(sample.cpu_time),
+                           to_milliseconds(sample.gpu_time),
+                           sample.command_buffer_count,
+                           sample.submit_count,
+                           sample.frame_arena_bytes,
+                           sample.live_heap_bytes,
+                           sample.device_memory_usage,
+                           sample.device_memory_budget,
+                           sample.uploaded_bytes);
+        }
+        else {
+            fmt::format_to(std::back_inserter(buffer),
+                           "{},{:.4f},{:.4f},{:.4f},{},{},{},{},{},{},{}\n",
+                           sample.frame_index,
+                           to_milliseconds(sample.frame_time),
+                           to_milliseconds(sample.cpu_time),
+                           to_milliseconds(sample.gpu_time),
+                           sample.command_buffer_count,
+                           sample.submit_count,
+                           sample.frame_arena_bytes,
+                           sample.live_heap_bytes,
+                           sample.device_memory_usage,
+                           sample.device_memory_budget,
+                           sample.uploaded_bytes);
+        }
+        std::fwrite(buffer.data(), 1, buffer.size(), _file);
+        _totals.add(sample);
+        _frame_times.add(static_cast<int64_t>(sample.frame_time.count()));
+    }
+
+    /**
+     * This function returns the summary of all written samples.
+     *
+     * @return The summary of the written samples
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    auto MetricsWriter::get_summary() noexcept -> MetricsSummary {
+        return _totals.summarize(_frame_times);
+    }
+
+    auto MetricsWriter::operator=(MetricsWriter&& other) noexcept -> MetricsWriter& {
+        _file = other._file;
+        _format = other._format;
+        _frame_times = std::move(other._frame_times);
+        _totals = other._totals;
+        other._file = nullptr;
+        return *this;
+    }
+}// namespace erebos::metrics
@@ -0,0 +1,68 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include "erebos/platform/cpu.hpp"
+
+#if defined(ARCH_X86) && defined(COMPILER_MSVC)
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace erebos::platform {
+    namespace {
+        [[nodiscard]] auto detect_cpu_features() noexcept -> CPUFeatures {
+            CPUFeatures features {};
+#if defined(ARCH_X86) && defined(COMPILER_MSVC)
+            i32 registers[4] {};
+            ::__cpuid(registers, 0);
+            const auto max_leaf = registers[0];
+
+            ::__cpuid(registers, 1);
+            features.has_sse4_1 = (registers[2] & (1 << 19)) != 0;
+
+            // AVX2 requires the OS to save the YMM registers (OSXSAVE and XCR0 bits 1 and 2)
+            const auto has_os_avx_support = (registers[2] & (1 << 27)) != 0 && (::_xgetbv(0) & 0x6) == 0x6;
+            if(max_leaf >= 7 && has_os_avx_support) {
+                ::__cpuidex(registers, 7, 0);
+                features.has_avx2 = (registers[1] & (1 << 5)) != 0;
+            }
+#elif defined(ARCH_X86)
+            __builtin_cpu_init();
+            features.has_sse4_1 = __builtin_cpu_supports("sse4.1") != 0;
+            features.has_avx2 = __builtin_cpu_supports("avx2") != 0;
+#elif defined(ARCH_ARM64)
+            features.has_neon = true;
+#endif
+            return features;
+        }
+    }// namespace
+
+    /**
+     * This function detects the features of the CPU once and returns the cached features on subsequent calls. On x86,
+     * AVX2 is only reported if the operating system saves the AVX registers.
+     *
+     * @return The features of the CPU
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    auto get_cpu_features() noexcept -> const CPUFeatures& {
+        static const auto features = detect_cpu_features();
+        return features;
+    }
+}// namespace erebos::platform
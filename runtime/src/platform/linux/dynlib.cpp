@@ -24,7 +24,7 @@
 namespace erebos::platform {
     LibraryLoader::LibraryLoader(std::string name)
         : _name {std::move(name)} {
-        _handle = ::dlopen(_name.c_str(), RTLD_LAZY);
+        _handle = ::dlopen(_name.c_str(), RTLD_NOW | RTLD_LOCAL);
         if(_handle == invalid_module_handle) {
             throw std::runtime_error {fmt::format("Unable to open library '{}': {}", _name, get_last_error())};
         }
@@ -44,19 +44,25 @@ namespace erebos::platform {
     }
 
     auto LibraryLoader::operator=(LibraryLoader&& other) noexcept -> LibraryLoader& {
+        if(_handle != invalid_module_handle) {
+            ::dlclose(_handle);
+        }
         _name = std::move(other._name);
         _handle = other._handle;
         other._handle = invalid_module_handle;
         return *this;
     }
 
-    auto LibraryLoader::get_function_address(const std::string& name) noexcept -> erebos::Result<void*> {
-        auto* address = ::dlsym(_handle, name.data());
+    auto LibraryLoader::find_symbol(const char* name) const noexcept -> void* {
+        return ::dlsym(_handle, name);
+    }
+
+    auto LibraryLoader::get_function_address(const char* name) const noexcept -> erebos::Result<void*> {
+        auto* address = find_symbol(name);
         if(address == nullptr) {
             return erebos::Error {fmt::format("Could not resolve function {} in {}: {}", name, _name, get_last_error())};
         }
-
-        return reinterpret_cast<void*>(address);
+        return address;
     }
 }// namespace erebos::platform
 #endif
\ No newline at end of file
@@ -19,13 +19,16 @@
 
 #ifdef PLATFORM_LINUX
 #include "erebos/platform/file.hpp"
+#include <sys/stat.h>
 
 #ifdef CPU_64_BIT
 #define OPEN ::open64
 #define MMAP ::mmap64
+#define PREAD ::pread64
 #else
 #define OPEN ::open
 #define MMAP ::mmap
+#define PREAD ::pread
 #endif
 
 namespace erebos::platform {
@@ -80,6 +83,18 @@ namespace erebos::platform {
 
             return O_CREAT;
         }
+
+        // statx only fills the requested fields, the block size is always filled
+        constexpr auto STATX_METADATA_MASK = STATX_SIZE | STATX_MTIME | STATX_INO;
+
+        [[nodiscard]] auto to_metadata(const struct statx& status) noexcept -> FileMetadata {
+            FileMetadata metadata {};
+            metadata.size = static_cast<erebos::usize>(status.stx_size);
+            metadata.last_write_time = std::chrono::seconds {status.stx_mtime.tv_sec} + std::chrono::nanoseconds {status.stx_mtime.tv_nsec};
+            metadata.file_id = status.stx_ino;
+            metadata.block_size = status.stx_blksize;
+            return metadata;
+        }
     }// namespace
 
     /**
@@ -139,7 +154,12 @@ namespace erebos::platform {
             }
         }
 
-        _handle = OPEN(_path.c_str(), to_access(access_mode), to_permissions(access_mode));
+        auto access = to_access(access_mode);
+        if(are_flags_set<AccessMode, AccessMode::DIRECT>(access_mode)) {
+            access |= O_DIRECT;
+        }
+
+        _handle = OPEN(_path.c_str(), access, to_permissions(access_mode));
         if(_handle == invalid_file_handle) {
             throw std::runtime_error {fmt::format("Unable to open file '{}': {}", _path.string(), get_last_error())};
         }
@@ -148,7 +168,8 @@ namespace erebos::platform {
     File::File(File&& other) noexcept
         : _path {std::move(other._path)}
         , _access {other._access}
-        , _handle {other._handle} {
+        , _handle {other._handle}
+        , _metadata {other._metadata} {
         other._handle = invalid_file_handle;
     }
 
@@ -188,21 +209,54 @@ namespace erebos::platform {
         return {{static_cast<erebos::u8*>(ptr), *file_size}};
     }
 
-    auto File::get_file_size() const noexcept -> erebos::Result<erebos::usize> {
-        const auto temp_file_handle = ::fdopen(_handle, "r");
-        if(temp_file_handle == nullptr) {
-            return erebos::Error(fmt::format("Unable to acquire size of file: {}", platform::get_last_error()));
+    auto File::read_at(const std::span<erebos::u8> buffer, const erebos::usize offset) const noexcept -> erebos::Result<erebos::usize> {
+        while(true) {
+            const auto read_size = PREAD(_handle, buffer.data(), buffer.size(), static_cast<off64_t>(offset));
+            if(read_size >= 0) {
+                return static_cast<erebos::usize>(read_size);
+            }
+
+            if(errno != EINTR) {
+                return erebos::Error(fmt::format("Unable to read from file '{}': {}", _path.string(), platform::get_last_error()));
+            }
         }
+    }
 
-        fseek(temp_file_handle, EOF, SEEK_END);
-        return ftell(temp_file_handle);
+    auto File::discard_cached_pages(const erebos::usize offset, const erebos::usize size) const noexcept -> void {
+        ::posix_fadvise64(_handle, static_cast<off64_t>(offset), static_cast<off64_t>(size), POSIX_FADV_DONTNEED);
+    }
+
+    auto File::read_handle_metadata() const noexcept -> erebos::Result<FileMetadata> {
+        struct statx status {};
+        if(::statx(_handle, "", AT_EMPTY_PATH | AT_STATX_SYNC_AS_STAT, STATX_METADATA_MASK, &status) != 0) {
+            return erebos::Error(fmt::format("Unable to acquire metadata of file '{}': {}", _path.string(), platform::get_last_error()));
+        }
+        return to_metadata(status);
     }
 
     auto File::operator=(File&& other) noexcept -> File& {
         _path = std::move(other._path);
         _access = other._access;
         _handle = other._handle;
+        _metadata = other._metadata;
         return *this;
     }
+
+    auto read_metadata(const std::filesystem::path& path) noexcept -> erebos::Result<FileMetadata> {
+        struct statx status {};
+        if(::statx(AT_FDCWD, path.c_str(), AT_STATX_SYNC_AS_STAT, STATX_METADATA_MASK, &status) != 0) {
+            return erebos::Error(fmt::format("Unable to acquire metadata of file '{}': {}", path.string(), platform::get_last_error()));
+        }
+        return to_metadata(status);
+    }
+
+    auto read_metadata(const std::span<const std::filesystem::path> paths) noexcept -> std::vector<erebos::Result<FileMetadata>> {
+        std::vector<erebos::Result<FileMetadata>> metadata {};
+        metadata.reserve(paths.size());
+        for(const auto& path : paths) {
+            metadata.push_back(read_metadata(path));
+        }
+        return metadata;
+    }
 }// namespace erebos::platform
 #endif
\ No newline at end of file
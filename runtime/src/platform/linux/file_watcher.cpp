@@ -19,6 +19,8 @@
 
 #ifdef PLATFORM_LINUX
 #include "erebos/platform/file_watcher.hpp"
+#include "erebos/log.hpp"
+#include "erebos/profiler.hpp"
 
 namespace erebos::platform {
     namespace {
@@ -75,17 +77,25 @@ namespace erebos::platform {
             throw std::runtime_error {fmt::format("Unable to make inotify non-blocking: {}", get_last_error())};
         }
 
-        // Add all files and directories recursively to the file watcher
+        // Add the base path itself and all files and directories recursively to the file watcher
+        if(const auto watch_fd = ::inotify_add_watch(_handle, _base_path.c_str(), watch_mask); watch_fd != invalid_file_watcher_handle) {
+            _handle_to_path_map[watch_fd] = _base_path;
+        }
+        else {
+            EREBOS_LOG_ERROR("Unable to add path '{}' to watcher: {}", _base_path.c_str(), get_last_error());
+        }
+
         for(const auto& path : std::filesystem::recursive_directory_iterator {_base_path}) {
             const auto watch_fd = ::inotify_add_watch(_handle, path.path().c_str(), watch_mask);
             if(watch_fd == invalid_file_watcher_handle) {
-                SPDLOG_ERROR("Unable to add path '{}' to watcher: {}", path.path().c_str(), get_last_error());
+                EREBOS_LOG_ERROR("Unable to add path '{}' to watcher: {}", path.path().c_str(), get_last_error());
                 continue;
             }
             _handle_to_path_map[watch_fd] = path;
         }
 
         _file_watcher_thread = std::thread {[&]() {
+            EREBOS_PROFILE_THREAD_NAME("File Watcher");
             while(_is_running) {
                 std::array<erebos::u8, event_buffer_size> buffer {};
                 const auto buffer_size = ::read(_handle, buffer.data(), event_buffer_size);
@@ -93,6 +103,8 @@ namespace erebos::platform {
                     continue;
                 }
 
+                EREBOS_PROFILE_SCOPE("FileWatcher::process_events");
+
                 erebos::u8* current_address = buffer.data();
                 while(current_address < buffer.data() + buffer_size) {
                     const auto* event = reinterpret_cast<const inotify_event*>(current_address);
@@ -103,7 +115,7 @@ namespace erebos::platform {
 
                     const auto flags = event->mask;
                     const auto path = _handle_to_path_map[event->wd] / event->name;
-                    SPDLOG_TRACE("Received {} file event about '{}'", mask_to_action_string(flags), path.string());
+                    EREBOS_LOG_TRACE("Received {} file event about '{}'", mask_to_action_string(flags), path.string());
                     if(are_flags_set<erebos::u32, IN_MOVED_FROM>(flags)) {
                         ::inotify_rm_watch(_handle, event->wd);
                         _handle_to_path_map.erase(event->wd);
@@ -118,7 +130,7 @@ namespace erebos::platform {
                     if(are_flags_set<erebos::u32, IN_CREATE, IN_MOVED_TO>(flags)) {
                         const auto watch_fd = ::inotify_add_watch(_handle, path.c_str(), watch_mask);
                         if(watch_fd == invalid_file_watcher_handle) {
-                            SPDLOG_ERROR("Unable to add path '{}' of path: {}", path.c_str(), get_last_error());
+                            EREBOS_LOG_ERROR("Unable to add path '{}' of path: {}", path.c_str(), get_last_error());
                             continue;
                         }
                         _handle_to_path_map[watch_fd] = path;
@@ -19,6 +19,7 @@
 
 #ifdef PLATFORM_MACOS
 #include "erebos/platform/file.hpp"
+#include <sys/stat.h>
 
 namespace erebos::platform {
     namespace {
@@ -72,6 +73,15 @@ namespace erebos::platform {
 
             return O_CREAT;
         }
+
+        [[nodiscard]] auto to_metadata(const struct stat& status) noexcept -> FileMetadata {
+            FileMetadata metadata {};
+            metadata.size = static_cast<erebos::usize>(status.st_size);
+            metadata.last_write_time = std::chrono::seconds {status.st_mtimespec.tv_sec} + std::chrono::nanoseconds {status.st_mtimespec.tv_nsec};
+            metadata.file_id = static_cast<erebos::u64>(status.st_ino);
+            metadata.block_size = static_cast<erebos::u32>(status.st_blksize);
+            return metadata;
+        }
     }// namespace
 
     /**
@@ -131,12 +141,20 @@ namespace erebos::platform {
         if(_handle == invalid_file_handle) {
             throw std::runtime_error {fmt::format("Unable to open file '{}': {}", _path.string(), get_last_error())};
         }
+
+        // macOS has no O_DIRECT, the page cache is disabled for the handle instead
+        if(are_flags_set<AccessMode, AccessMode::DIRECT>(access_mode) && ::fcntl(_handle, F_NOCACHE, 1) == -1) {
+            const auto error = get_last_error();
+            ::close(_handle);
+            throw std::runtime_error {fmt::format("Unable to disable caching of file '{}': {}", _path.string(), error)};
+        }
     }
 
     File::File(File&& other) noexcept
         : _path {std::move(other._path)}
         , _access {other._access}
-        , _handle {other._handle} {
+        , _handle {other._handle}
+        , _metadata {other._metadata} {
         other._handle = invalid_file_handle;
     }
 
@@ -176,21 +194,54 @@ namespace erebos::platform {
         return {{static_cast<erebos::u8*>(ptr), *file_size}};
     }
 
-    auto File::get_file_size() const noexcept -> erebos::Result<erebos::usize> {
-        const auto temp_file_handle = ::fdopen(_handle, "r");
-        if(temp_file_handle == nullptr) {
-            return erebos::Error {fmt::format("Unable to acquire size of file: {}", platform::get_last_error())};
+    auto File::read_at(const std::span<erebos::u8> buffer, const erebos::usize offset) const noexcept -> erebos::Result<erebos::usize> {
+        while(true) {
+            const auto read_size = ::pread(_handle, buffer.data(), buffer.size(), static_cast<off_t>(offset));
+            if(read_size >= 0) {
+                return static_cast<erebos::usize>(read_size);
+            }
+
+            if(errno != EINTR) {
+                return erebos::Error {fmt::format("Unable to read from file '{}': {}", _path.string(), platform::get_last_error())};
+            }
         }
+    }
 
-        fseek(temp_file_handle, EOF, SEEK_END);
-        return ftell(temp_file_handle);
+    auto File::discard_cached_pages([[maybe_unused]] const erebos::usize offset, [[maybe_unused]] const erebos::usize size) const noexcept -> void {
+        // macOS has no advice to drop pages of a range, handles opened with DIRECT don't fill the cache at all
+    }
+
+    auto File::read_handle_metadata() const noexcept -> erebos::Result<FileMetadata> {
+        struct stat status {};
+        if(::fstat(_handle, &status) != 0) {
+            return erebos::Error {fmt::format("Unable to acquire metadata of file '{}': {}", _path.string(), platform::get_last_error())};
+        }
+        return to_metadata(status);
     }
 
     auto File::operator=(File&& other) noexcept -> File& {
         _path = std::move(other._path);
         _access = other._access;
         _handle = other._handle;
+        _metadata = other._metadata;
         return *this;
     }
+
+    auto read_metadata(const std::filesystem::path& path) noexcept -> erebos::Result<FileMetadata> {
+        struct stat status {};
+        if(::stat(path.c_str(), &status) != 0) {
+            return erebos::Error {fmt::format("Unable to acquire metadata of file '{}': {}", path.string(), platform::get_last_error())};
+        }
+        return to_metadata(status);
+    }
+
+    auto read_metadata(const std::span<const std::filesystem::path> paths) noexcept -> std::vector<erebos::Result<FileMetadata>> {
+        std::vector<erebos::Result<FileMetadata>> metadata {};
+        metadata.reserve(paths.size());
+        for(const auto& path : paths) {
+            metadata.push_back(read_metadata(path));
+        }
+        return metadata;
+    }
 }// namespace erebos::platform
 #endif
\ No newline at end of file
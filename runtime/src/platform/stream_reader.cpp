@@ -0,0 +1,201 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include "erebos/platform/stream_reader.hpp"
+#include <algorithm>
+
+namespace erebos::platform {
+    namespace {
+        constexpr auto DIRECT_READ_ACCESS = static_cast<AccessMode>(AccessMode::READ | AccessMode::DIRECT);
+
+        /**
+         * This function opens the specified file for streaming. Some file systems like tmpfs or network file systems
+         * reject direct I/O, so the file is opened with the page cache if the direct open fails.
+         *
+         * @param path      The path of the file
+         * @param is_direct Whether the file was opened with direct I/O
+         * @return          The opened file
+         * @author          Cedric Hammes
+         * @since           18/10/2026
+         */
+        [[nodiscard]] auto open_stream_file(const std::filesystem::path& path, bool& is_direct) -> File {
+            // The file is created by the constructor of the file, so a missing file has to be rejected before
+            if(!std::filesystem::is_regular_file(path)) {
+                throw std::runtime_error {fmt::format("Unable to stream file '{}': No such file", path.string())};
+            }
+
+            if(auto file = try_construct<File>(path, DIRECT_READ_ACCESS); file.is_ok()) {
+                is_direct = true;
+                return std::move(*file);
+            }
+
+            is_direct = false;
+            return File {path, AccessMode::READ};
+        }
+
+        [[nodiscard]] constexpr auto align_up(const usize value, const usize alignment) noexcept -> usize {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+    }// namespace
+
+    /**
+     * This constructor opens the file and starts the reader thread. The buffer size is rounded up to the alignment
+     * of direct I/O. If the file doesn't exist or the readahead depth isn't between two and the maximum depth,
+     * this constructor throws a runtime error.
+     *
+     * @param path            The path of the file to stream
+     * @param buffer_size     The size of a single chunk
+     * @param readahead_depth The count of buffers which are read ahead of the consumer
+     * @author                Cedric Hammes
+     * @since                 18/10/2026
+     */
+    StreamReader::StreamReader(const std::filesystem::path& path, const usize buffer_size, const usize readahead_depth)
+        : _is_direct {false}
+        , _file {open_stream_file(path, _is_direct)}
+        , _file_size {}
+        , _buffer_size {}
+        , _readahead_depth {readahead_depth}
+        , _buffers {nullptr, AlignedDeleter {DIRECT_IO_ALIGNMENT}}
+        , _chunks {}
+        , _free_chunks {0}
+        , _filled_chunks {0}
+        , _chunk_index {0}
+        , _is_holding_chunk {false}
+        , _is_finished {false}
+        , _is_running {true} {
+        if(readahead_depth < 2 || readahead_depth > MAX_STREAM_READAHEAD_DEPTH) {
+            throw std::runtime_error {fmt::format("Unable to stream file '{}': Readahead depth {} is out of range [2, {}]",
+                                                  path.string(),
+                                                  readahead_depth,
+                                                  MAX_STREAM_READAHEAD_DEPTH)};
+        }
+
+        const auto metadata = _file.get_metadata();
+        if(metadata.is_error()) {
+            throw std::runtime_error {metadata.get_error()};
+        }
+
+        // The preferred I/O size is a multiple of the logical block size, which is the alignment needed by direct I/O
+        const auto alignment = std::max<usize>(metadata->block_size, DIRECT_IO_ALIGNMENT);
+        _file_size = metadata->size;
+        _buffer_size = align_up(std::max<usize>(buffer_size, 1), alignment);
+        _buffers = {static_cast<u8*>(::operator new[](_buffer_size * _readahead_depth, std::align_val_t {alignment})),
+                    AlignedDeleter {alignment}};
+        _chunks.resize(_readahead_depth);
+
+        _free_chunks.release(static_cast<std::ptrdiff_t>(_readahead_depth));
+        _reader_thread = std::thread {[this] {
+            read_chunks();
+        }};
+    }
+
+    /**
+     * This destructor stops the reader thread and waits until the chunk in flight is read.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    StreamReader::~StreamReader() noexcept {
+        // The additional free chunk wakes up the reader thread if it's waiting for the consumer
+        _is_running = false;
+        _free_chunks.release();
+        if(_reader_thread.joinable()) {
+            _reader_thread.join();
+        }
+    }
+
+    /**
+     * This function returns the next chunk of the file and hands the previous chunk back to the reader thread, so
+     * the returned data is only valid until the next call. The data is meant to be copied directly into mapped
+     * staging memory without an intermediate copy.
+     *
+     * @return The next chunk, nothing at the end of the file or an error if the read failed
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    auto StreamReader::next() noexcept -> Result<std::optional<std::span<const u8>>> {
+        if(_is_finished) {
+            return std::optional<std::span<const u8>> {};
+        }
+
+        if(_is_holding_chunk) {
+            _is_holding_chunk = false;
+            _chunk_index = (_chunk_index + 1) % _readahead_depth;
+            _free_chunks.release();
+        }
+
+        _filled_chunks.acquire();
+        _is_holding_chunk = true;
+        const auto& chunk = _chunks[_chunk_index];
+        if(chunk.error.has_value()) {
+            _is_finished = true;
+            return Error {*chunk.error};
+        }
+
+        if(chunk.size == 0) {
+            _is_finished = true;
+            return std::optional<std::span<const u8>> {};
+        }
+        return std::optional {std::span<const u8> {_buffers.get() + _chunk_index * _buffer_size, chunk.size}};
+    }
+
+    auto StreamReader::read_chunks() noexcept -> void {
+        usize offset = 0;
+        usize chunk_index = 0;
+        while(true) {
+            _free_chunks.acquire();
+            if(!_is_running) {
+                return;
+            }
+
+            // Direct reads have to start at aligned offsets, so the last chunk is only read until the end of the file
+            // instead of retrying the read after a short read
+            auto& chunk = _chunks[chunk_index];
+            const auto buffer = std::span<u8> {_buffers.get() + chunk_index * _buffer_size, _buffer_size};
+            chunk.size = 0;
+            chunk.error.reset();
+            while(chunk.size < buffer.size() && offset + chunk.size < _file_size) {
+                auto read_size = _file.read_at(buffer.subspan(chunk.size), offset + chunk.size);
+                if(read_size.is_error()) {
+                    chunk.error = read_size.get_error();
+                    break;
+                }
+
+                // The file was truncated while it was streamed
+                if(*read_size == 0) {
+                    break;
+                }
+                chunk.size += *read_size;
+            }
+
+            if(!_is_direct && chunk.size > 0) {
+                _file.discard_cached_pages(offset, chunk.size);
+            }
+
+            const auto is_last_chunk = chunk.size == 0 || chunk.error.has_value();
+            _filled_chunks.release();
+            if(is_last_chunk) {
+                return;
+            }
+
+            offset += chunk.size;
+            chunk_index = (chunk_index + 1) % _readahead_depth;
+        }
+    }
+}// namespace erebos::platform
@@ -44,18 +44,25 @@ namespace erebos::platform {
     }
 
     auto LibraryLoader::operator=(LibraryLoader&& other) noexcept -> LibraryLoader& {
+        if(_handle != invalid_module_handle) {
+            ::FreeLibrary(_handle);
+        }
         _name = std::move(other._name);
         _handle = other._handle;
         other._handle = invalid_module_handle;
         return *this;
     }
 
-    auto LibraryLoader::get_function_address(const std::string& name) noexcept -> erebos::Result<void*> {
-        auto* address = ::GetProcAddress(_handle, name.data());
+    auto LibraryLoader::find_symbol(const char* name) const noexcept -> void* {
+        return reinterpret_cast<void*>(::GetProcAddress(_handle, name));
+    }
+
+    auto LibraryLoader::get_function_address(const char* name) const noexcept -> erebos::Result<void*> {
+        auto* address = find_symbol(name);
         if(address == nullptr) {
             return erebos::Error {fmt::format("Could not resolve function {} in {}: {}", name, _name, get_last_error())};
         }
-        return reinterpret_cast<void*>(address);
+        return address;
     }
 }// namespace erebos::platform
 #endif
\ No newline at end of file
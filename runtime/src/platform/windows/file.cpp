@@ -47,6 +47,31 @@ namespace erebos::platform {
 
             return flags;
         }
+
+        // The last write time of Windows is in 100 nanosecond intervals since 01/01/1601
+        constexpr erebos::u64 WINDOWS_TO_UNIX_EPOCH_INTERVALS = 116444736000000000;
+
+        [[nodiscard]] auto read_metadata_of_handle(const HANDLE handle, const std::filesystem::path& path) noexcept
+                -> erebos::Result<FileMetadata> {
+            BY_HANDLE_FILE_INFORMATION information {};
+            if(!::GetFileInformationByHandle(handle, &information)) {
+                return erebos::Error {fmt::format("Unable to acquire metadata of file '{}': {}", path.string(), platform::get_last_error())};
+            }
+
+            const auto last_write_time = (static_cast<erebos::u64>(information.ftLastWriteTime.dwHighDateTime) << 32) |
+                                         information.ftLastWriteTime.dwLowDateTime;
+            FileMetadata metadata {};
+            metadata.size = static_cast<erebos::usize>((static_cast<erebos::u64>(information.nFileSizeHigh) << 32) | information.nFileSizeLow);
+            metadata.last_write_time = std::chrono::nanoseconds {(last_write_time - WINDOWS_TO_UNIX_EPOCH_INTERVALS) * 100};
+            metadata.file_id = (static_cast<erebos::u64>(information.nFileIndexHigh) << 32) | information.nFileIndexLow;
+
+            // The storage information is optional, the block size falls back to the page size
+            FILE_STORAGE_INFO storage_information {};
+            metadata.block_size = ::GetFileInformationByHandleEx(handle, FileStorageInfo, &storage_information, sizeof(FILE_STORAGE_INFO))
+                                          ? storage_information.PhysicalBytesPerSectorForPerformance
+                                          : 4096;
+            return metadata;
+        }
     }// namespace
 
     /**
@@ -113,7 +138,7 @@ namespace erebos::platform {
                                 0,
                                 nullptr,
                                 exists ? OPEN_EXISTING : CREATE_NEW,
-                                FILE_ATTRIBUTE_NORMAL,
+                                are_flags_set<AccessMode, AccessMode::DIRECT>(access_mode) ? FILE_FLAG_NO_BUFFERING : FILE_ATTRIBUTE_NORMAL,
                                 nullptr);
         if(_handle == invalid_file_handle) {
             throw std::runtime_error {fmt::format("Unable to open file '{}': {}", _path.string(), get_last_error())};
@@ -123,7 +148,8 @@ namespace erebos::platform {
     File::File(File&& other) noexcept
         : _path {std::move(other._path)}
         , _access {other._access}
-        , _handle {other._handle} {
+        , _handle {other._handle}
+        , _metadata {other._metadata} {
         other._handle = invalid_file_handle;
     }
 
@@ -192,19 +218,61 @@ namespace erebos::platform {
         return {{static_cast<erebos::u8*>(base_ptr), file_mapping_handle, *file_size}};
     }
 
-    auto File::get_file_size() const noexcept -> erebos::Result<erebos::usize> {
-        LARGE_INTEGER file_size {};
-        if(!::GetFileSizeEx(_handle, &file_size)) {
-            return erebos::Error {fmt::format("Unable to acquire size of file: {}", platform::get_last_error())};
+    auto File::read_at(const std::span<erebos::u8> buffer, const erebos::usize offset) const noexcept -> erebos::Result<erebos::usize> {
+        // The offset of the overlapped structure is used by synchronous handles too
+        ::OVERLAPPED overlapped {};
+        overlapped.Offset = static_cast<DWORD>(offset);
+        overlapped.OffsetHigh = static_cast<DWORD>(static_cast<erebos::u64>(offset) >> 32);
+
+        DWORD read_size = 0;
+        const auto size = static_cast<DWORD>(std::min<erebos::usize>(buffer.size(), std::numeric_limits<DWORD>::max()));
+        if(::ReadFile(_handle, buffer.data(), size, &read_size, &overlapped) == FALSE && ::GetLastError() != ERROR_HANDLE_EOF) {
+            return erebos::Error {fmt::format("Unable to read from file '{}': {}", _path.string(), platform::get_last_error())};
         }
-        return static_cast<erebos::usize>(file_size.QuadPart);
+        return static_cast<erebos::usize>(read_size);
+    }
+
+    auto File::discard_cached_pages([[maybe_unused]] const erebos::usize offset, [[maybe_unused]] const erebos::usize size) const noexcept -> void {
+        // Windows has no advice to drop pages of a range, handles opened with DIRECT don't fill the cache at all
+    }
+
+    auto File::read_handle_metadata() const noexcept -> erebos::Result<FileMetadata> {
+        return read_metadata_of_handle(_handle, _path);
     }
 
     auto File::operator=(File&& other) noexcept -> File& {
         _path = std::move(other._path);
         _access = other._access;
         _handle = other._handle;
+        _metadata = other._metadata;
         return *this;
     }
+
+    auto read_metadata(const std::filesystem::path& path) noexcept -> erebos::Result<FileMetadata> {
+        // Only the attributes are read, so the file can be opened while other processes are writing it
+        const auto handle = ::CreateFileW(path.c_str(),
+                                          FILE_READ_ATTRIBUTES,
+                                          FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                          nullptr,
+                                          OPEN_EXISTING,
+                                          FILE_FLAG_BACKUP_SEMANTICS,
+                                          nullptr);
+        if(handle == invalid_file_handle) {
+            return erebos::Error {fmt::format("Unable to open file '{}': {}", path.string(), platform::get_last_error())};
+        }
+
+        auto metadata = read_metadata_of_handle(handle, path);
+        ::CloseHandle(handle);
+        return metadata;
+    }
+
+    auto read_metadata(const std::span<const std::filesystem::path> paths) noexcept -> std::vector<erebos::Result<FileMetadata>> {
+        std::vector<erebos::Result<FileMetadata>> metadata {};
+        metadata.reserve(paths.size());
+        for(const auto& path : paths) {
+            metadata.push_back(read_metadata(path));
+        }
+        return metadata;
+    }
 }// namespace erebos::platform
 #endif
\ No newline at end of file
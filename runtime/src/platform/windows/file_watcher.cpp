@@ -19,7 +19,10 @@
 
 #ifdef PLATFORM_WINDOWS
 #include "erebos/platform/file_watcher.hpp"
+#include "erebos/log.hpp"
+#include "erebos/profiler.hpp"
 #include <algorithm>
+#include <string_view>
 
 namespace erebos::platform {
     namespace {
@@ -76,6 +79,7 @@ namespace erebos::platform {
         }
 
         _file_watcher_thread = std::thread {[&]() {
+            EREBOS_PROFILE_THREAD_NAME("File Watcher");
             while(_is_running) {
                 if(!::ReadDirectoryChangesW(_handle,
                                             _event_buffer.data(),
@@ -86,7 +90,7 @@ namespace erebos::platform {
                                             nullptr,
                                             &_overlapped,
                                             nullptr)) {
-                    SPDLOG_INFO("Failed to handle file event in folder {}: {}", _base_path.string(), get_last_error());
+                    EREBOS_LOG_INFO("Failed to handle file event in folder {}: {}", _base_path.string(), get_last_error());
                     continue;
                 }
 
@@ -96,18 +100,18 @@ namespace erebos::platform {
                 }
 
                 if(status != WAIT_OBJECT_0) {
-                    SPDLOG_ERROR("Failed to handle file event in folder {} {}: {}", status, _base_path.string(), get_last_error());
+                    EREBOS_LOG_ERROR("Failed to handle file event in folder {} {}: {}", status, _base_path.string(), get_last_error());
                     continue;
                 }
 
+                EREBOS_PROFILE_SCOPE("FileWatcher::process_events");
                 size_t offset = 0;
                 FILE_NOTIFY_INFORMATION* notify;
 
                 do {
                     notify = reinterpret_cast<FILE_NOTIFY_INFORMATION*>(_event_buffer.data() + offset);
-                    std::wstring file_name;
-                    file_name.assign(notify->FileName, notify->FileNameLength / sizeof(WCHAR));
-                    const auto path = _base_path / erebos::unicode::to_mbs(file_name);
+                    // Paths are UTF-16 on Windows, so the file name is appended without converting it
+                    const auto path = _base_path / std::wstring_view {notify->FileName, notify->FileNameLength / sizeof(WCHAR)};
 
                     {
                         const auto lock = std::lock_guard {_event_queue_mutex};
@@ -0,0 +1,306 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include "erebos/plugin/plugin_module.hpp"
+#include "erebos/log.hpp"
+#include "erebos/platform/symbol_table.hpp"
+#include "erebos/profiler.hpp"
+
+namespace erebos::plugin {
+    namespace {
+        using PluginSymbols = platform::SymbolTable<platform::Symbol<"erebos_get_plugin_api", const PluginApi*()>>;
+
+        struct LoadedLibrary final {
+            platform::LibraryLoader library;
+            const PluginApi* api;
+        };
+
+        [[nodiscard]] auto get_process_id() noexcept -> u32 {
+#ifdef PLATFORM_WINDOWS
+            return static_cast<u32>(::GetCurrentProcessId());
+#else
+            return static_cast<u32>(::getpid());
+#endif
+        }
+
+        // The shadow path contains the process and a counter of all loads in the process, so multiple processes, modules
+        // and the old and new library of a reload never share the same path
+        [[nodiscard]] auto get_shadow_path(const std::filesystem::path& path) noexcept -> std::filesystem::path {
+            static std::atomic<u32> load_count {0};
+            return std::filesystem::temp_directory_path() / "erebos-plugins" /
+                   fmt::format("{}-{}-{}{}", path.stem().string(), get_process_id(), load_count++, path.extension().string());
+        }
+
+        [[nodiscard]] auto load_library(const std::filesystem::path& path, const std::filesystem::path& shadow_path) noexcept
+                -> Result<LoadedLibrary> {
+            std::error_code error_code {};
+            std::filesystem::create_directories(shadow_path.parent_path(), error_code);
+            if(!std::filesystem::copy_file(path, shadow_path, std::filesystem::copy_options::overwrite_existing, error_code)) {
+                return Error(fmt::format("Unable to copy plugin '{}' to shadow path: {}", path.string(), error_code.message()));
+            }
+
+            auto library = try_construct<platform::LibraryLoader>(shadow_path.string());
+            if(!library) {
+                std::filesystem::remove(shadow_path, error_code);
+                return Error(library.get_error());
+            }
+
+            // Resolve the plugin API once, all calls into the plugin go through the function table
+            const auto symbols = try_construct<PluginSymbols>(*library);
+            const auto* api = symbols ? symbols->get<"erebos_get_plugin_api">()() : nullptr;
+            if(api == nullptr || api->api_version != PLUGIN_API_VERSION) {
+                *library = {};// Unload the library before the shadow copy is removed
+                std::filesystem::remove(shadow_path, error_code);
+                if(!symbols) {
+                    return Error(symbols.get_error());
+                }
+                return Error(fmt::format("Unable to load plugin '{}': Plugin API version {} is not supported (Expected {})",
+                                         path.string(),
+                                         api != nullptr ? api->api_version : 0,
+                                         PLUGIN_API_VERSION));
+            }
+            return LoadedLibrary {std::move(*library), api};
+        }
+    }// namespace
+
+    /**
+     * This constructor loads the specified plugin library and creates the instance of the plugin. If the library is
+     * watched, the directory of the library is watched for changes, so the library is reloaded after it was rebuilt. If
+     * the library can't be loaded, this constructor throws a runtime error.
+     *
+     * @param path       The path of the plugin library
+     * @param is_watched Whether the library is reloaded on changes or not
+     * @author           Cedric Hammes
+     * @since            18/10/2026
+     */
+    PluginModule::PluginModule(const std::filesystem::path& path, const bool is_watched)
+        : _path {std::filesystem::absolute(path).lexically_normal()}
+        , _shadow_path {get_shadow_path(_path)}
+        , _generation {0}
+        , _library {}
+        , _api {nullptr}
+        , _instance {nullptr}
+        , _watcher {}
+        , _last_reload_time {} {
+        auto loaded_library = load_library(_path, _shadow_path);
+        if(!loaded_library) {
+            throw std::runtime_error {loaded_library.get_error()};
+        }
+        _library = std::move(loaded_library->library);
+        _api = loaded_library->api;
+
+        // The destructor isn't called when the constructor throws, so the library is unloaded and the shadow copy is
+        // removed before. The name of the plugin is copied first, because it's owned by the library.
+        const auto unload = [this]() noexcept {
+            _api = nullptr;
+            _library = {};
+            std::error_code error_code {};
+            std::filesystem::remove(_shadow_path, error_code);
+        };
+
+        _instance = _api->create();
+        if(_instance == nullptr) {
+            auto message = fmt::format("Unable to create instance of plugin '{}'", _api->name);
+            unload();
+            throw std::runtime_error {std::move(message)};
+        }
+
+        if(is_watched) {
+            try {
+                _watcher = std::make_unique<platform::FileWatcher>(_path.parent_path());
+            }
+            catch(const std::runtime_error&) {
+                _api->destroy(_instance);
+                _instance = nullptr;
+                unload();
+                throw;
+            }
+        }
+        EREBOS_LOG_INFO("Loaded plugin '{}' from '{}'", _api->name, _path.string());
+    }
+
+    PluginModule::PluginModule(PluginModule&& other) noexcept
+        : _path {std::move(other._path)}
+        , _shadow_path {std::move(other._shadow_path)}
+        , _generation {other._generation}
+        , _library {std::move(other._library)}
+        , _api {other._api}
+        , _instance {other._instance}
+        , _watcher {std::move(other._watcher)}
+        , _last_reload_time {other._last_reload_time} {
+        other._api = nullptr;
+        other._instance = nullptr;
+    }
+
+    /**
+     * This destructor destroys the instance of the plugin before the library is unloaded and removes the shadow copy of
+     * the library.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    PluginModule::~PluginModule() noexcept {
+        if(_instance != nullptr) {
+            _api->destroy(_instance);
+            _instance = nullptr;
+        }
+
+        if(_library.is_loaded()) {
+            _library = {};
+            std::error_code error_code {};
+            std::filesystem::remove(_shadow_path, error_code);
+        }
+    }
+
+    /**
+     * This function updates the instance of the plugin.
+     *
+     * @param delta_time The time since the last update in seconds
+     * @author           Cedric Hammes
+     * @since            18/10/2026
+     */
+    auto PluginModule::update(const double delta_time) noexcept -> void {
+        _api->update(_instance, delta_time);
+    }
+
+    /**
+     * This function loads the current library from the path of the module and hands the state of the old instance
+     * over to the new instance. The old instance and library are only released after the new instance restored the
+     * state, so the old library stays loaded if the reload fails. Reloads exceeding the reload time budget are reported
+     * as warning.
+     *
+     * @return Void or an error
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    auto PluginModule::reload() noexcept -> Result<void> {
+        EREBOS_PROFILE_SCOPE("PluginModule::reload");
+        const auto reload_begin = std::chrono::steady_clock::now();
+        const auto shadow_path = get_shadow_path(_path);
+        EREBOS_TRY_ASSIGN(auto loaded_library, load_library(_path, shadow_path));
+
+        // Save the state of the old instance, the size is queried with an empty buffer first
+        std::vector<u8> state(_api->save_state(_instance, nullptr, 0));
+        if(!state.empty()) {
+            static_cast<void>(_api->save_state(_instance, state.data(), state.size()));
+        }
+
+        // The error message is formatted before the new library is unloaded, because the name is owned by the library
+        const auto unload = [&]() noexcept {
+            loaded_library.api = nullptr;
+            loaded_library.library = {};
+            std::error_code error_code {};
+            std::filesystem::remove(shadow_path, error_code);
+        };
+
+        auto* instance = loaded_library.api->create();
+        if(instance == nullptr) {
+            auto message = fmt::format("Unable to create instance of reloaded plugin '{}'", loaded_library.api->name);
+            unload();
+            return Error(std::move(message));
+        }
+
+        if(!loaded_library.api->load_state(instance, state.data(), state.size())) {
+            auto message = fmt::format("Unable to hand {} bytes of state over to reloaded plugin '{}'", state.size(), loaded_library.api->name);
+            loaded_library.api->destroy(instance);
+            unload();
+            return Error(std::move(message));
+        }
+
+        // Release the old instance before its library is unloaded
+        _api->destroy(_instance);
+        _library = std::move(loaded_library.library);
+        std::error_code error_code {};
+        std::filesystem::remove(_shadow_path, error_code);
+
+        _api = loaded_library.api;
+        _instance = instance;
+        _shadow_path = shadow_path;
+        _generation++;
+        _last_reload_time = std::chrono::steady_clock::now() - reload_begin;
+
+        const auto reload_time = std::chrono::duration<double, std::milli> {_last_reload_time}.count();
+        if(_last_reload_time > RELOAD_TIME_BUDGET) {
+            EREBOS_LOG_WARN("Reloaded plugin '{}' in {:.2f} ms, which exceeds the budget of {} ms",
+                            _api->name,
+                            reload_time,
+                            RELOAD_TIME_BUDGET.count());
+        }
+        else {
+            EREBOS_LOG_INFO("Reloaded plugin '{}' in {:.2f} ms ({} bytes of state)", _api->name, reload_time, state.size());
+        }
+        return {};
+    }
+
+    /**
+     * This function handles the file events of the library's directory and reloads the library, if it was written or
+     * replaced. A failed reload is reported as warning and the old library stays loaded, because the build may still
+     * be writing the library. The next event of the library retries the reload.
+     *
+     * @return Whether the library was reloaded or an error
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    auto PluginModule::handle_file_events() noexcept -> Result<bool> {
+        if(_watcher == nullptr) {
+            return false;
+        }
+
+        bool is_library_changed = false;
+        EREBOS_TRY(_watcher->handle_event_queue([&](const platform::FileEvent& event) -> Result<void> {
+            if(event.type != platform::FileEventType::DELETED && event.file.lexically_normal() == _path) {
+                is_library_changed = true;
+            }
+            return {};
+        }));
+
+        if(!is_library_changed) {
+            return false;
+        }
+
+        if(auto reload_result = reload(); reload_result.is_error()) {
+            EREBOS_LOG_WARN("Unable to reload plugin '{}': {}", _path.string(), reload_result.get_error());
+            return false;
+        }
+        return true;
+    }
+
+    auto PluginModule::operator=(PluginModule&& other) noexcept -> PluginModule& {
+        if(_instance != nullptr) {
+            _api->destroy(_instance);
+        }
+        if(_library.is_loaded()) {
+            _library = {};
+            std::error_code error_code {};
+            std::filesystem::remove(_shadow_path, error_code);
+        }
+
+        _path = std::move(other._path);
+        _shadow_path = std::move(other._shadow_path);
+        _generation = other._generation;
+        _library = std::move(other._library);
+        _api = other._api;
+        _instance = other._instance;
+        _watcher = std::move(other._watcher);
+        _last_reload_time = other._last_reload_time;
+        other._api = nullptr;
+        other._instance = nullptr;
+        return *this;
+    }
+}// namespace erebos::plugin
@@ -0,0 +1,338 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include "erebos/profiler.hpp"
+#include "erebos/platform/platform.hpp"
+#include "erebos/spsc_queue.hpp"
+#include <condition_variable>
+#include <cstdio>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace erebos::profiler {
+    namespace detail {
+        std::atomic_bool is_capturing {false};
+    }// namespace detail
+
+    namespace {
+        constexpr usize ZONE_QUEUE_CAPACITY = 8192;
+
+        struct ThreadBuffer final {
+            SPSCQueue<ZoneEvent, ZONE_QUEUE_CAPACITY> zones;
+            std::atomic<usize> dropped_zone_count;
+            u32 thread_id;
+            std::string name;
+            bool is_exited;
+        };
+
+        // The buffers of exited threads are kept until their zones were drained into the trace, after that they are
+        // freed. The zones dropped by the freed buffers are counted until the capture stops.
+        struct ThreadRegistry final {
+            std::mutex mutex;
+            std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+            u32 next_thread_id;
+            usize exited_dropped_zone_count;
+        };
+
+        struct Capture final {
+            std::mutex mutex;
+            std::condition_variable condition;
+            std::thread flush_thread;
+            std::FILE* file;
+            bool is_stop_requested;
+            bool is_first_event;
+            u64 begin_ticks;
+            std::chrono::steady_clock::time_point begin_time;
+        };
+
+        [[nodiscard]] auto get_thread_registry() noexcept -> ThreadRegistry& {
+            static ThreadRegistry registry {};
+            return registry;
+        }
+
+        // Marks the buffer of the thread as exited when the thread exits, the buffer is freed by the registry later
+        struct ThreadBufferOwner final {
+            ThreadBuffer* buffer {nullptr};
+
+            ~ThreadBufferOwner() noexcept;
+        };
+
+        thread_local ThreadBufferOwner thread_buffer_owner {};
+        thread_local bool is_thread_exited = false;
+
+        ThreadBufferOwner::~ThreadBufferOwner() noexcept {
+            is_thread_exited = true;
+            if(buffer != nullptr) {
+                auto& registry = get_thread_registry();
+                const auto guard = std::lock_guard {registry.mutex};
+                buffer->is_exited = true;
+            }
+        }
+
+        // Frees the buffers of exited threads, which have no zones left to write. This is only done without a running
+        // capture, while capturing the flush frees the buffers after the final drain.
+        auto free_exited_buffers(ThreadRegistry& registry) noexcept -> void {
+            std::erase_if(registry.buffers, [&](const auto& buffer) noexcept -> bool {
+                if(!buffer->is_exited || buffer->zones.get_size() > 0) {
+                    return false;
+                }
+                registry.exited_dropped_zone_count += buffer->dropped_zone_count.load(std::memory_order_relaxed);
+                return true;
+            });
+        }
+
+        [[nodiscard]] auto get_capture() noexcept -> Capture& {
+            static Capture capture {};
+            return capture;
+        }
+
+        // Returns the buffer of the calling thread or null, if the thread is exiting and its buffer was released
+        [[nodiscard]] auto get_thread_buffer() noexcept -> ThreadBuffer* {
+            if(thread_buffer_owner.buffer == nullptr) [[unlikely]] {
+                if(is_thread_exited) {
+                    return nullptr;
+                }
+
+                auto& registry = get_thread_registry();
+                const auto guard = std::lock_guard {registry.mutex};
+                if(!detail::is_capturing.load(std::memory_order_relaxed)) {
+                    free_exited_buffers(registry);
+                }
+                auto& buffer = registry.buffers.emplace_back(std::make_unique<ThreadBuffer>());
+                buffer->thread_id = registry.next_thread_id++;
+                thread_buffer_owner.buffer = buffer.get();
+            }
+            return thread_buffer_owner.buffer;
+        }
+
+        auto append_json_string(fmt::memory_buffer& buffer, const std::string_view value) noexcept -> void {
+            buffer.push_back('"');
+            for(const auto character : value) {
+                if(character == '"' || character == '\\') {
+                    buffer.push_back('\\');
+                }
+                buffer.push_back(static_cast<u8>(character) < 0x20 ? ' ' : character);
+            }
+            buffer.push_back('"');
+        }
+
+        auto begin_event(Capture& capture, fmt::memory_buffer& buffer) noexcept -> void {
+            if(!capture.is_first_event) {
+                buffer.append(std::string_view {",\n"});
+            }
+            capture.is_first_event = false;
+        }
+
+        auto append_thread_name(Capture& capture, fmt::memory_buffer& buffer, const ThreadBuffer& thread_buffer) noexcept -> void {
+            if(thread_buffer.name.empty()) {
+                return;
+            }
+
+            begin_event(capture, buffer);
+            fmt::format_to(std::back_inserter(buffer), R"({{"name":"thread_name","ph":"M","pid":1,"tid":{},"args":{{"name":)", thread_buffer.thread_id);
+            append_json_string(buffer, thread_buffer.name);
+            buffer.append(std::string_view {"}}"});
+        }
+
+        // Drains the zones of all threads into the trace file. The ticks are converted with the tick rate measured
+        // since the begin of the capture, so the conversion gets more precise with every flush.
+        auto flush_zones(Capture& capture) noexcept -> void {
+            const auto elapsed_ticks = get_ticks() - capture.begin_ticks;
+            const auto elapsed_time = std::chrono::steady_clock::now() - capture.begin_time;
+            const auto elapsed_nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed_time).count();
+            const auto nanoseconds_per_tick = elapsed_ticks == 0 ? 1.0 : static_cast<double>(elapsed_nanoseconds) / static_cast<double>(elapsed_ticks);
+            const auto to_microseconds = [&](const u64 ticks) noexcept -> double {
+                return static_cast<double>(static_cast<int64_t>(ticks - capture.begin_ticks)) * nanoseconds_per_tick / 1000.0;
+            };
+
+            fmt::memory_buffer buffer {};
+            auto& registry = get_thread_registry();
+            const auto guard = std::lock_guard {registry.mutex};
+            for(const auto& thread_buffer : registry.buffers) {
+                while(const auto zone = thread_buffer->zones.try_pop()) {
+                    begin_event(capture, buffer);
+                    buffer.append(std::string_view {R"({"name":)"});
+                    append_json_string(buffer, zone->name);
+                    fmt::format_to(std::back_inserter(buffer),
+                                   R"(,"ph":"X","ts":{:.3f},"dur":{:.3f},"pid":1,"tid":{}}})",
+                                   to_microseconds(zone->begin),
+                                   static_cast<double>(zone->end - zone->begin) * nanoseconds_per_tick / 1000.0,
+                                   thread_buffer->thread_id);
+                }
+            }
+
+            // The buffers of exited threads are drained now, so they are freed after their name was written
+            std::erase_if(registry.buffers, [&](const auto& thread_buffer) noexcept -> bool {
+                if(!thread_buffer->is_exited) {
+                    return false;
+                }
+                append_thread_name(capture, buffer, *thread_buffer);
+                registry.exited_dropped_zone_count += thread_buffer->dropped_zone_count.load(std::memory_order_relaxed);
+                return true;
+            });
+            std::fwrite(buffer.data(), 1, buffer.size(), capture.file);
+        }
+
+        auto discard_zones() noexcept -> void {
+            auto& registry = get_thread_registry();
+            const auto guard = std::lock_guard {registry.mutex};
+            for(const auto& buffer : registry.buffers) {
+                while(buffer->zones.try_pop()) {
+                }
+                buffer->dropped_zone_count.store(0, std::memory_order_relaxed);
+            }
+            std::erase_if(registry.buffers, [](const auto& buffer) noexcept -> bool {
+                return buffer->is_exited;
+            });
+            registry.exited_dropped_zone_count = 0;
+        }
+    }// namespace
+
+    namespace detail {
+        auto push_zone(const ZoneEvent& event) noexcept -> void {
+            const auto buffer = get_thread_buffer();
+            if(buffer == nullptr) [[unlikely]] {
+                return;
+            }
+
+            if(!buffer->zones.try_push(event)) [[unlikely]] {
+                buffer->dropped_zone_count.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        auto get_thread_buffer_count() noexcept -> usize {
+            auto& registry = get_thread_registry();
+            const auto guard = std::lock_guard {registry.mutex};
+            return registry.buffers.size();
+        }
+    }// namespace detail
+
+    /**
+     * This function sets the name of the calling thread in the trace.
+     *
+     * @param name The name of the thread
+     * @author     Cedric Hammes
+     * @since      18/10/2026
+     */
+    auto set_thread_name(const std::string_view name) noexcept -> void {
+        const auto buffer = get_thread_buffer();
+        if(buffer == nullptr) {
+            return;
+        }
+
+        const auto guard = std::lock_guard {get_thread_registry().mutex};
+        buffer->name = name;
+    }
+
+    /**
+     * This function starts the capture of zones into the specified file. A background thread drains the ring buffers of
+     * all threads in the specified interval and writes the zones as Chrome trace JSON, which can be opened with
+     * chrome://tracing or the Perfetto UI.
+     *
+     * @param path           The path of the trace file
+     * @param flush_interval The interval the ring buffers are drained in
+     * @return               Void or an error
+     * @author               Cedric Hammes
+     * @since                18/10/2026
+     */
+    auto start_capture(const std::filesystem::path& path, const std::chrono::milliseconds flush_interval) noexcept -> Result<void> {
+        auto& capture = get_capture();
+        if(capture.flush_thread.joinable()) {
+            return Error(std::string {"Unable to start capture: Capture is already running"});
+        }
+
+        capture.file = std::fopen(path.string().c_str(), "wb");
+        if(capture.file == nullptr) {
+            return Error(fmt::format("Unable to open trace file '{}': {}", path.string(), platform::get_last_error()));
+        }
+        std::fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n", capture.file);
+
+        // Zones of an earlier capture, which ended after it was stopped, don't belong into this trace
+        discard_zones();
+        capture.is_stop_requested = false;
+        capture.is_first_event = true;
+        capture.begin_ticks = get_ticks();
+        capture.begin_time = std::chrono::steady_clock::now();
+        detail::is_capturing.store(true, std::memory_order_release);
+
+        try {
+            capture.flush_thread = std::thread {[&capture, flush_interval]() {
+                auto lock = std::unique_lock {capture.mutex};
+                while(!capture.is_stop_requested) {
+                    capture.condition.wait_for(lock, flush_interval, [&]() {
+                        return capture.is_stop_requested;
+                    });
+                    flush_zones(capture);
+                }
+            }};
+        }
+        catch(const std::system_error& error) {
+            detail::is_capturing.store(false, std::memory_order_release);
+            std::fclose(capture.file);
+            capture.file = nullptr;
+            return Error(fmt::format("Unable to start trace flush thread: {}", error.what()));
+        }
+        return {};
+    }
+
+    /**
+     * This function stops the capture, writes the remaining zones and closes the trace file.
+     *
+     * @return The count of zones, which were dropped because a ring buffer was full
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    auto stop_capture() noexcept -> usize {
+        auto& capture = get_capture();
+        if(!capture.flush_thread.joinable()) {
+            return 0;
+        }
+
+        // The flush thread drains the ring buffers a last time before it exits
+        detail::is_capturing.store(false, std::memory_order_release);
+        {
+            const auto guard = std::lock_guard {capture.mutex};
+            capture.is_stop_requested = true;
+        }
+        capture.condition.notify_all();
+        capture.flush_thread.join();
+
+        usize dropped_zone_count = 0;
+        fmt::memory_buffer buffer {};
+        {
+            auto& registry = get_thread_registry();
+            const auto guard = std::lock_guard {registry.mutex};
+            dropped_zone_count = std::exchange(registry.exited_dropped_zone_count, 0);
+            for(const auto& thread_buffer : registry.buffers) {
+                dropped_zone_count += thread_buffer->dropped_zone_count.exchange(0, std::memory_order_relaxed);
+                append_thread_name(capture, buffer, *thread_buffer);
+            }
+        }
+
+        buffer.append(std::string_view {"\n]}\n"});
+        std::fwrite(buffer.data(), 1, buffer.size(), capture.file);
+        std::fclose(capture.file);
+        capture.file = nullptr;
+        return dropped_zone_count;
+    }
+}// namespace erebos::profiler
@@ -0,0 +1,268 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include "erebos/render/capture.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace erebos::render {
+    namespace {
+        constexpr usize HEADER_SIZE = 32;
+        constexpr usize COMMAND_HEADER_SIZE = sizeof(u16) * 2;
+
+        template<typename T>
+        auto write_value(u8* buffer, const usize offset, const T value) noexcept -> void {
+            std::memcpy(buffer + offset, &value, sizeof(T));
+        }
+
+        template<typename T>
+        [[nodiscard]] auto read_value(const u8* buffer, const usize offset) noexcept -> T {
+            T value;
+            std::memcpy(&value, buffer + offset, sizeof(T));
+            return value;
+        }
+
+        // The payload size of every command type or nothing if the size is variable
+        [[nodiscard]] constexpr auto get_payload_size(const CaptureCommandType type) noexcept -> std::optional<usize> {
+            switch(type) {
+                case CaptureCommandType::ACQUIRE_COMMAND_BUFFER:
+                case CaptureCommandType::BEGIN_COMMAND_BUFFER: return sizeof(u32);
+                case CaptureCommandType::CLEAR_IMAGE: return sizeof(float) * 4;
+                case CaptureCommandType::UPLOAD: return sizeof(u64);
+                case CaptureCommandType::BEGIN_LABEL: return std::nullopt;
+                default: return 0;
+            }
+        }
+
+        [[nodiscard]] auto map_capture(const std::filesystem::path& path) -> platform::FileMapping {
+            const platform::File file {path, platform::AccessMode::READ};
+            auto mapping = file.map_into_memory();
+            if(!mapping) {
+                throw std::runtime_error {fmt::format("Unable to map capture '{}': {}", path.string(), mapping.get_error())};
+            }
+            return std::move(*mapping);
+        }
+    }// namespace
+
+    /**
+     * This constructor creates the capture file and writes the header.
+     *
+     * @param path         The path of the capture file
+     * @param image_width  The width of the image the frames are rendered into
+     * @param image_height The height of the image the frames are rendered into
+     * @author             Cedric Hammes
+     * @since              18/10/2026
+     */
+    CaptureWriter::CaptureWriter(const std::filesystem::path& path, const u32 image_width, const u32 image_height)
+        : _file {std::fopen(path.string().c_str(), "wb")}
+        , _frame_count {0}
+        , _image_width {image_width}
+        , _image_height {image_height}
+        , _max_upload_size {0} {
+        if(_file == nullptr) {
+            throw std::runtime_error {fmt::format("Unable to open capture '{}': {}", path.string(), platform::get_last_error())};
+        }
+        write_header();
+    }
+
+    CaptureWriter::CaptureWriter(CaptureWriter&& other) noexcept
+        : _file {other._file}
+        , _frame_count {other._frame_count}
+        , _image_width {other._image_width}
+        , _image_height {other._image_height}
+        , _max_upload_size {other._max_upload_size} {
+        other._file = nullptr;
+    }
+
+    /**
+     * This destructor rewrites the header and closes the capture file.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    CaptureWriter::~CaptureWriter() noexcept {
+        if(_file != nullptr) {
+            std::fseek(_file, 0, SEEK_SET);
+            write_header();
+            std::fclose(_file);
+            _file = nullptr;
+        }
+    }
+
+    auto CaptureWriter::begin_frame() noexcept -> void {
+        write_command(CaptureCommandType::BEGIN_FRAME);
+    }
+
+    auto CaptureWriter::end_frame() noexcept -> void {
+        write_command(CaptureCommandType::END_FRAME);
+        _frame_count++;
+    }
+
+    auto CaptureWriter::acquire_command_buffer(const u32 queue_index) noexcept -> void {
+        write_command(CaptureCommandType::ACQUIRE_COMMAND_BUFFER, &queue_index, sizeof(u32));
+    }
+
+    auto CaptureWriter::begin_command_buffer(const u32 usage_flags) noexcept -> void {
+        write_command(CaptureCommandType::BEGIN_COMMAND_BUFFER, &usage_flags, sizeof(u32));
+    }
+
+    auto CaptureWriter::end_command_buffer() noexcept -> void {
+        write_command(CaptureCommandType::END_COMMAND_BUFFER);
+    }
+
+    auto CaptureWriter::begin_label(const std::string_view name) noexcept -> void {
+        const auto name_size = std::min<usize>(name.size(), std::numeric_limits<u16>::max());
+        write_command(CaptureCommandType::BEGIN_LABEL, name.data(), static_cast<u16>(name_size));
+    }
+
+    auto CaptureWriter::end_label() noexcept -> void {
+        write_command(CaptureCommandType::END_LABEL);
+    }
+
+    auto CaptureWriter::clear_image(const std::array<float, 4>& color) noexcept -> void {
+        write_command(CaptureCommandType::CLEAR_IMAGE, color.data(), sizeof(float) * 4);
+    }
+
+    auto CaptureWriter::upload(const u64 size) noexcept -> void {
+        write_command(CaptureCommandType::UPLOAD, &size, sizeof(u64));
+        _max_upload_size = std::max(_max_upload_size, size);
+    }
+
+    auto CaptureWriter::submit() noexcept -> void {
+        write_command(CaptureCommandType::SUBMIT);
+    }
+
+    auto CaptureWriter::operator=(CaptureWriter&& other) noexcept -> CaptureWriter& {
+        _file = other._file;
+        _frame_count = other._frame_count;
+        _image_width = other._image_width;
+        _image_height = other._image_height;
+        _max_upload_size = other._max_upload_size;
+        other._file = nullptr;
+        return *this;
+    }
+
+    auto CaptureWriter::write_command(const CaptureCommandType type, const void* payload, const u16 payload_size) noexcept -> void {
+        std::array<u8, COMMAND_HEADER_SIZE> command_header {};
+        write_value(command_header.data(), 0, static_cast<u16>(type));
+        write_value(command_header.data(), sizeof(u16), payload_size);
+        std::fwrite(command_header.data(), 1, command_header.size(), _file);
+        if(payload_size > 0) {
+            std::fwrite(payload, 1, payload_size, _file);
+        }
+    }
+
+    auto CaptureWriter::write_header() noexcept -> void {
+        std::array<u8, HEADER_SIZE> header {};
+        write_value(header.data(), 0, CAPTURE_MAGIC);
+        write_value(header.data(), 4, CAPTURE_VERSION);
+        write_value(header.data(), 8, _frame_count);
+        write_value(header.data(), 12, _image_width);
+        write_value(header.data(), 16, _image_height);
+        write_value(header.data(), 24, _max_upload_size);
+        std::fwrite(header.data(), 1, header.size(), _file);
+    }
+
+    /**
+     * This constructor maps the capture file into the memory and validates the header. If the file isn't a capture or
+     * was written by another version, this constructor throws a runtime error.
+     *
+     * @param path The path of the capture file
+     * @author     Cedric Hammes
+     * @since      18/10/2026
+     */
+    CaptureReader::CaptureReader(const std::filesystem::path& path)
+        : _mapping {map_capture(path)}
+        , _offset {HEADER_SIZE}
+        , _frame_count {0}
+        , _image_width {0}
+        , _image_height {0}
+        , _max_upload_size {0} {
+        const auto* data = *_mapping;
+        if(_mapping.get_size() < HEADER_SIZE || read_value<u32>(data, 0) != CAPTURE_MAGIC) {
+            throw std::runtime_error {fmt::format("Unable to read capture '{}': Not a capture", path.string())};
+        }
+
+        if(const auto version = read_value<u16>(data, 4); version != CAPTURE_VERSION) {
+            throw std::runtime_error {fmt::format("Unable to read capture '{}': Unsupported version {}", path.string(), version)};
+        }
+
+        _frame_count = read_value<u32>(data, 8);
+        _image_width = read_value<u32>(data, 12);
+        _image_height = read_value<u32>(data, 16);
+        _max_upload_size = read_value<u64>(data, 24);
+    }
+
+    /**
+     * This function reads the next command of the capture.
+     *
+     * @return The next command, nothing at the end of the capture or an error if the capture is corrupted
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    auto CaptureReader::next() noexcept -> Result<std::optional<CaptureCommand>> {
+        const auto* data = *_mapping;
+        const auto size = _mapping.get_size();
+        if(_offset == size) {
+            return std::optional<CaptureCommand> {};
+        }
+
+        if(size - _offset < COMMAND_HEADER_SIZE) {
+            return Error(fmt::format("Unable to read capture command at offset {}: Command header is truncated", _offset));
+        }
+
+        const auto raw_type = read_value<u16>(data, _offset);
+        const auto payload_size = read_value<u16>(data, _offset + sizeof(u16));
+        const auto type = static_cast<CaptureCommandType>(raw_type);
+        if(raw_type > static_cast<u16>(CaptureCommandType::SUBMIT)) {
+            return Error(fmt::format("Unable to read capture command at offset {}: Unknown command type {}", _offset, raw_type));
+        }
+
+        const auto expected_payload_size = get_payload_size(type);
+        if(size - _offset - COMMAND_HEADER_SIZE < payload_size || (expected_payload_size.has_value() && *expected_payload_size != payload_size)) {
+            return Error(fmt::format("Unable to read capture command at offset {}: Invalid payload size {}", _offset, payload_size));
+        }
+
+        const auto payload_offset = _offset + COMMAND_HEADER_SIZE;
+        CaptureCommand command {};
+        command.type = type;
+        switch(type) {
+            case CaptureCommandType::ACQUIRE_COMMAND_BUFFER:
+            case CaptureCommandType::BEGIN_COMMAND_BUFFER: command.value = read_value<u32>(data, payload_offset); break;
+            case CaptureCommandType::CLEAR_IMAGE: command.color = read_value<std::array<float, 4>>(data, payload_offset); break;
+            case CaptureCommandType::UPLOAD: command.size = read_value<u64>(data, payload_offset); break;
+            case CaptureCommandType::BEGIN_LABEL:
+                command.name = std::string_view {reinterpret_cast<const char*>(data + payload_offset), payload_size};
+                break;
+            default: break;
+        }
+        _offset = payload_offset + payload_size;
+        return std::optional {command};
+    }
+
+    /**
+     * This function moves the reader back to the first command, so the capture can be replayed again.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    auto CaptureReader::rewind() noexcept -> void {
+        _offset = HEADER_SIZE;
+    }
+}// namespace erebos::render
@@ -18,6 +18,8 @@
  */
 
 #include "erebos/render/vulkan/command.hpp"
+#include "erebos/memory/linear_arena.hpp"
+#include "erebos/profiler.hpp"
 
 namespace erebos::render::vulkan {
     /**
@@ -54,19 +56,21 @@ namespace erebos::render::vulkan {
         }
     }
 
-    auto CommandBuffer::begin(VkCommandBufferUsageFlags usage) const noexcept -> Result<void> {
+    auto CommandBuffer::begin(VkCommandBufferUsageFlags usage) const noexcept -> Result<void, ErrorCode> {
+        EREBOS_PROFILE_SCOPE("CommandBuffer::begin");
         VkCommandBufferBeginInfo command_buffer_begin_info {};
         command_buffer_begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
         command_buffer_begin_info.flags = usage;
         if(const auto err = ::vkBeginCommandBuffer(_command_buffer, &command_buffer_begin_info); err != VK_SUCCESS) {
-            return Error {fmt::format("Unable to begin command buffer: {}", vk_strerror(err))};
+            return Error {ErrorCode {ErrorKind::BEGIN_COMMAND_BUFFER, err}};
         }
         return {};
     }
 
-    auto CommandBuffer::end() const noexcept -> Result<void> {
+    auto CommandBuffer::end() const noexcept -> Result<void, ErrorCode> {
+        EREBOS_PROFILE_SCOPE("CommandBuffer::end");
         if(const auto err = ::vkEndCommandBuffer(_command_buffer); err != VK_SUCCESS) {
-            return Error {fmt::format("Unable to begin command buffer: {}", vk_strerror(err))};
+            return Error {ErrorCode {ErrorKind::END_COMMAND_BUFFER, err}};
         }
         return {};
     }
@@ -80,11 +84,13 @@ namespace erebos::render::vulkan {
     }
 
     /**
-     * This constructor creates a command pool on the specified device
+     * This constructor creates a command pool on the specified device. In debug builds the command pool is named
+     * after the queue family.
      *
-     * @param device The device for create the pool
-     * @author       Cedric Hammes
-     * @since        14/03/2024
+     * @param device             The device for create the pool
+     * @param queue_family_index The queue family of the command buffers
+     * @author                   Cedric Hammes
+     * @since                    14/03/2024
      */
     CommandPool::CommandPool(const Device& device, uint32_t queue_family_index)
         : _device {&device}
@@ -96,6 +102,7 @@ namespace erebos::render::vulkan {
         if(const auto err = ::vkCreateCommandPool(*device, &create_info, nullptr, &_command_pool); err != VK_SUCCESS) {
             throw std::runtime_error {fmt::format("Unable to create command pool: {}", vk_strerror(err))};
         }
+        set_object_name(*device, _command_pool, "Command Pool (Queue Family {})", queue_family_index);
     }
 
     CommandPool::CommandPool(CommandPool&& other) noexcept
@@ -113,15 +120,17 @@ namespace erebos::render::vulkan {
      * @author      Cedric Hammes
      * @since       14/03/2024
      */
-    auto CommandPool::allocate(uint32_t count) const noexcept -> Result<std::vector<CommandBuffer>> {
+    auto CommandPool::allocate(uint32_t count) const noexcept -> Result<std::vector<CommandBuffer>, ErrorCode> {
+        EREBOS_PROFILE_SCOPE("CommandPool::allocate");
         VkCommandBufferAllocateInfo allocate_info {};
         allocate_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
         allocate_info.commandBufferCount = count;
         allocate_info.commandPool = _command_pool;
 
-        std::vector<VkCommandBuffer> raw_command_buffers {count};
+        memory::ScopedArena scoped_arena {memory::get_frame_arena()};
+        std::pmr::vector<VkCommandBuffer> raw_command_buffers {count, &scoped_arena};
         if(const auto err = ::vkAllocateCommandBuffers(**_device, &allocate_info, raw_command_buffers.data()); err != VK_SUCCESS) {
-            return Error {fmt::format("Unable to allocate {} command buffer: {}", count, vk_strerror(err))};
+            return Error {ErrorCode {ErrorKind::ALLOCATE_COMMAND_BUFFERS, err}};
         }
 
         std::vector<CommandBuffer> command_buffers {};
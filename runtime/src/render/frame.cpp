@@ -18,40 +18,133 @@
  */
 
 #include "erebos/render/vulkan/frame.hpp"
+#include "erebos/log.hpp"
+#include "erebos/profiler.hpp"
 
 namespace erebos::render::vulkan {
-    auto QueueFrame::acquire_command_buffer() noexcept -> Result<CommandBuffer*> {
-        if (!_cached_command_buffers.empty()) {
-            _recording_command_buffers.push_back(std::move(_cached_command_buffers.back()));
-            _cached_command_buffers.pop_back();
-            return &_recording_command_buffers.back();
+    auto QueueFrame::acquire_command_buffer() noexcept -> Result<CommandBuffer*, ErrorCode> {
+        EREBOS_PROFILE_SCOPE("QueueFrame::acquire_command_buffer");
+        auto& command_buffer_lists = (*_command_buffer_lists)[_command_buffer_list_index];
+        auto& recording_command_buffers = command_buffer_lists.recording_command_buffers;
+        auto& cached_command_buffers = command_buffer_lists.cached_command_buffers;
+        if (!cached_command_buffers.empty()) {
+            recording_command_buffers.push_back(std::move(cached_command_buffers.back()));
+            cached_command_buffers.pop_back();
+            return &recording_command_buffers.back();
         }
 
-        auto command_buffers = _command_pool.allocate(1);
-        if (!command_buffers) {
-            return Error(command_buffers.get_error());
-        }
+        EREBOS_TRY_ASSIGN(auto command_buffers, _command_pool.allocate(1));
+        recording_command_buffers.push_back(std::move(command_buffers[0]));
+        return &recording_command_buffers.back();
+    }
+
+    /**
+     * This function moves all recorded command buffers into the cache of the next frame and releases the arena of the
+     * last frame. The command pool must be reset before, so the cached command buffers can be recorded again.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    auto QueueFrame::recycle_command_buffers() noexcept -> void {
+        auto& current_lists = (*_command_buffer_lists)[_command_buffer_list_index];
+        auto& next_lists = (*_command_buffer_lists)[_command_buffer_list_index ^ 1];
+
+        // The lists of the next arena only contain moved-from command buffers of the last frame. They're replaced by
+        // empty lists before the arena is reset, so no list keeps storage of the released arena.
+        next_lists.recording_command_buffers = std::pmr::vector<CommandBuffer> {&next_lists.arena};
+        next_lists.cached_command_buffers = std::pmr::vector<CommandBuffer> {&next_lists.arena};
+        next_lists.arena.reset();
 
-        _recording_command_buffers.push_back(std::move(command_buffers.get()[0]));
-        return &_recording_command_buffers.back();
+        auto& cached_command_buffers = next_lists.cached_command_buffers;
+        cached_command_buffers.reserve(current_lists.cached_command_buffers.size() + current_lists.recording_command_buffers.size());
+        cached_command_buffers.insert(cached_command_buffers.end(),
+                                      std::make_move_iterator(current_lists.cached_command_buffers.begin()),
+                                      std::make_move_iterator(current_lists.cached_command_buffers.end()));
+        cached_command_buffers.insert(cached_command_buffers.end(),
+                                      std::make_move_iterator(current_lists.recording_command_buffers.begin()),
+                                      std::make_move_iterator(current_lists.recording_command_buffers.end()));
+        _command_buffer_list_index ^= 1;
     }
 
-    auto Frame::begin_frame() noexcept -> Result<void> {
+    /**
+     * This function begins the frame by waiting for the last submission of this frame and resetting the command
+     * pools of all queues and the frame arena of the calling thread. All memory allocated from the frame arena is
+     * invalid after this call. The GPU timings of the last submission are read back after the wait, so the read back
+     * never stalls. A failed read back is logged and doesn't fail the frame.
+     *
+     * @return Void or an error
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    auto Frame::begin_frame() noexcept -> Result<void, ErrorCode> {
+        EREBOS_PROFILE_SCOPE("Frame::begin_frame");
+        // Wait for the last submission of this frame, the command buffers can't be reset before it's done
+        EREBOS_TRY(_queue_submit_fence.wait());
+
+        // Release all temporary allocations of the last frame
+        auto& frame_arena = memory::get_frame_arena();
+        _allocation_statistics = frame_arena.get_statistics();
+        frame_arena.reset();
+
         for(auto& queue_frame : _queue_frames) {
+            // Read the timestamps of the last submission back before the command buffers writing them are reset. The
+            // profiling is optional, so a failed read back only loses the timings of the last submission
+            if(const auto read_back_result = queue_frame.get_profiler().read_back(); read_back_result.is_error()) [[unlikely]] {
+                EREBOS_LOG_WARN("Unable to read GPU timings back: {}", read_back_result.get_error());
+            }
+
             // Reset command pool's resources
+            EREBOS_PROFILE_SCOPE("vkResetCommandPool");
             const auto err = ::vkResetCommandPool(**_device, *queue_frame.get_command_pool(), VK_COMMAND_POOL_RESET_RELEASE_RESOURCES_BIT);
             if(err != VK_SUCCESS) {
-                return Error(fmt::format("Unable to reset command pool: {}", vk_strerror(err)));
+                return Error(ErrorCode {ErrorKind::RESET_COMMAND_POOL, err});
             }
 
-            // Move all recording command buffers into the cached command buffers list and erase recording command buffers
-            auto& recording_command_buffers = queue_frame.get_recording_command_buffers();
-            auto& cached_command_buffers = queue_frame.get_cached_command_buffers();
-            cached_command_buffers.insert(cached_command_buffers.end(),
-                                          std::make_move_iterator(recording_command_buffers.begin()),
-                                          std::make_move_iterator(recording_command_buffers.end()));
-            recording_command_buffers.erase(recording_command_buffers.begin(), recording_command_buffers.end());
+            queue_frame.recycle_command_buffers();
+        }
+        return {};
+    }
+
+    /**
+     * This function submits the recorded command buffers of the direct queue. The submission waits for the image
+     * acquired semaphore, signals the rendering done semaphore and the queue submit fence of this frame. Headless
+     * frames (like the replay of a capture) aren't presented, so they only signal the queue submit fence.
+     *
+     * @param is_presented Whether the frame is presented to the swapchain or not
+     * @return             Void or an error
+     * @author             Cedric Hammes
+     * @since              18/10/2026
+     */
+    auto Frame::submit(const bool is_presented) noexcept -> Result<void, ErrorCode> {
+        EREBOS_PROFILE_SCOPE("Frame::submit");
+        auto& direct_queue_frame = _queue_frames[0];
+        memory::ScopedArena scoped_arena {memory::get_frame_arena()};
+        std::pmr::vector<VkCommandBuffer> raw_command_buffers {&scoped_arena};
+        raw_command_buffers.reserve(direct_queue_frame.get_recording_command_buffers().size());
+        for(const auto& command_buffer : direct_queue_frame.get_recording_command_buffers()) {
+            raw_command_buffers.push_back(*command_buffer);
+        }
+
+        const auto wait_semaphore = *_image_acquired_semaphore;
+        const auto signal_semaphore = *_rendering_done_semaphore;
+        constexpr VkPipelineStageFlags wait_stage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT;
+        VkSubmitInfo submit_info {};
+        submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submit_info.waitSemaphoreCount = is_presented ? 1 : 0;
+        submit_info.pWaitSemaphores = &wait_semaphore;
+        submit_info.pWaitDstStageMask = &wait_stage;
+        submit_info.commandBufferCount = static_cast<uint32_t>(raw_command_buffers.size());
+        submit_info.pCommandBuffers = raw_command_buffers.data();
+        submit_info.signalSemaphoreCount = is_presented ? 1 : 0;
+        submit_info.pSignalSemaphores = &signal_semaphore;
+
+        // The fence is reset right before the submission, so frames without submission don't block the next begin
+        EREBOS_TRY(_queue_submit_fence.reset());
+
+        EREBOS_PROFILE_SCOPE("vkQueueSubmit");
+        if(const auto err = ::vkQueueSubmit(*_device->get_queues()[0], 1, &submit_info, *_queue_submit_fence); err != VK_SUCCESS) {
+            return Error(ErrorCode {ErrorKind::SUBMIT_QUEUE, err});
         }
         return {};
     }
-}
\ No newline at end of file
+}
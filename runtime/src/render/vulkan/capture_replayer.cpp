@@ -0,0 +1,287 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include "erebos/render/vulkan/capture_replayer.hpp"
+#include "erebos/profiler.hpp"
+
+namespace erebos::render::vulkan {
+    namespace {
+        constexpr usize FRAMES_IN_FLIGHT = 2;
+
+        auto record_clear(const CommandBuffer& command_buffer, VkImage image, const std::array<float, 4>& color) noexcept -> void {
+            VkImageMemoryBarrier image_barrier {};
+            image_barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            image_barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            image_barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            image_barrier.image = image;
+            image_barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+            image_barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            image_barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            image_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            image_barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            ::vkCmdPipelineBarrier(*command_buffer,
+                                   VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                   VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                   0,
+                                   0,
+                                   nullptr,
+                                   0,
+                                   nullptr,
+                                   1,
+                                   &image_barrier);
+
+            const VkClearColorValue clear_color {{color[0], color[1], color[2], color[3]}};
+            ::vkCmdClearColorImage(*command_buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &clear_color, 1, &image_barrier.subresourceRange);
+        }
+
+        auto record_upload(const CommandBuffer& command_buffer, VkBuffer staging_buffer, VkBuffer upload_buffer, const VkDeviceSize size) noexcept
+                -> void {
+            // All uploads target the same buffer, so the copies have to be ordered after the previous copies
+            VkMemoryBarrier memory_barrier {};
+            memory_barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            memory_barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            memory_barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            ::vkCmdPipelineBarrier(*command_buffer,
+                                   VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                   VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                   0,
+                                   1,
+                                   &memory_barrier,
+                                   0,
+                                   nullptr,
+                                   0,
+                                   nullptr);
+
+            VkBufferCopy copy_region {};
+            copy_region.size = size;
+            ::vkCmdCopyBuffer(*command_buffer, staging_buffer, upload_buffer, 1, &copy_region);
+        }
+    }// namespace
+
+    /**
+     * This constructor creates the offscreen image with the extent of the capture and the buffers for the uploads of the
+     * capture. The buffers are sized for the largest upload of the capture, so the replay doesn't allocate. If the
+     * creation of a resource fails, this constructor throws a runtime error.
+     *
+     * @param device The device to replay the capture on
+     * @param reader The reader of the capture
+     * @author       Cedric Hammes
+     * @since        18/10/2026
+     */
+    CaptureReplayer::CaptureReplayer(const Device& device, const CaptureReader& reader)
+        : _device {&device}
+        , _extent {std::max(reader.get_image_width(), 1U), std::max(reader.get_image_height(), 1U)}
+        , _image {}
+        , _image_allocation {}
+        , _upload_size {reader.get_max_upload_size()}
+        , _staging_buffer {}
+        , _staging_allocation {}
+        , _upload_buffer {}
+        , _upload_allocation {} {
+        VkImageCreateInfo image_create_info {};
+        image_create_info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+        image_create_info.imageType = VK_IMAGE_TYPE_2D;
+        image_create_info.format = VK_FORMAT_R8G8B8A8_UNORM;
+        image_create_info.extent = {_extent.width, _extent.height, 1};
+        image_create_info.mipLevels = 1;
+        image_create_info.arrayLayers = 1;
+        image_create_info.samples = VK_SAMPLE_COUNT_1_BIT;
+        image_create_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+        image_create_info.usage = VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+        image_create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        image_create_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+        VmaAllocationCreateInfo allocation_create_info {};
+        allocation_create_info.usage = VMA_MEMORY_USAGE_AUTO;
+        if(const auto err = ::vmaCreateImage(device.get_allocator(), &image_create_info, &allocation_create_info, &_image, &_image_allocation, nullptr);
+           err != VK_SUCCESS) {
+            throw std::runtime_error {fmt::format("Unable to create replay image: {}", vk_strerror(err))};
+        }
+        set_object_name(*device, _image, "Replay Image ({}x{})", _extent.width, _extent.height);
+
+        if(_upload_size == 0) {
+            return;
+        }
+
+        VkBufferCreateInfo buffer_create_info {};
+        buffer_create_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        buffer_create_info.size = _upload_size;
+        buffer_create_info.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+        buffer_create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        allocation_create_info.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT;
+        if(const auto err = ::vmaCreateBuffer(device.get_allocator(),
+                                              &buffer_create_info,
+                                              &allocation_create_info,
+                                              &_staging_buffer,
+                                              &_staging_allocation,
+                                              nullptr);
+           err != VK_SUCCESS) {
+            ::vmaDestroyImage(device.get_allocator(), _image, _image_allocation);
+            throw std::runtime_error {fmt::format("Unable to create replay staging buffer: {}", vk_strerror(err))};
+        }
+        set_object_name(*device, _staging_buffer, "Replay Staging Buffer");
+
+        buffer_create_info.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+        allocation_create_info.flags = 0;
+        if(const auto err = ::vmaCreateBuffer(device.get_allocator(),
+                                              &buffer_create_info,
+                                              &allocation_create_info,
+                                              &_upload_buffer,
+                                              &_upload_allocation,
+                                              nullptr);
+           err != VK_SUCCESS) {
+            ::vmaDestroyBuffer(device.get_allocator(), _staging_buffer, _staging_allocation);
+            ::vmaDestroyImage(device.get_allocator(), _image, _image_allocation);
+            throw std::runtime_error {fmt::format("Unable to create replay upload buffer: {}", vk_strerror(err))};
+        }
+        set_object_name(*device, _upload_buffer, "Replay Upload Buffer");
+    }
+
+    /**
+     * This destructor destroys the offscreen image and the upload buffers. The caller must ensure that the device
+     * doesn't use them anymore, the replay already waits for the device before it returns.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    CaptureReplayer::~CaptureReplayer() noexcept {
+        if(_upload_buffer != nullptr) {
+            ::vmaDestroyBuffer(_device->get_allocator(), _upload_buffer, _upload_allocation);
+            _upload_buffer = nullptr;
+        }
+        if(_staging_buffer != nullptr) {
+            ::vmaDestroyBuffer(_device->get_allocator(), _staging_buffer, _staging_allocation);
+            _staging_buffer = nullptr;
+        }
+        if(_image != nullptr) {
+            ::vmaDestroyImage(_device->get_allocator(), _image, _image_allocation);
+            _image = nullptr;
+        }
+    }
+
+    /**
+     * This function replays all commands of the capture from the beginning. The recording time of a frame is measured
+     * from the end of begin_frame (after the wait for the last submission) to the end of the submission, so it only
+     * contains the CPU cost of recording and submitting. The function waits for the device before it returns, also if
+     * the capture is truncated or corrupt, because the frames are destroyed on return.
+     *
+     * @param reader The reader of the capture
+     * @return       The statistics of the replay or an error
+     * @author       Cedric Hammes
+     * @since        18/10/2026
+     */
+    auto CaptureReplayer::replay(CaptureReader& reader) noexcept -> Result<ReplayStatistics> {
+        EREBOS_PROFILE_SCOPE("CaptureReplayer::replay");
+        std::vector<Frame> frames {};
+        frames.reserve(FRAMES_IN_FLIGHT);
+        for(usize i = 0; i < FRAMES_IN_FLIGHT; i++) {
+            EREBOS_TRY_ASSIGN(auto frame, try_construct<Frame>(*_device));
+            frames.push_back(std::move(frame));
+        }
+
+        ReplayStatistics statistics {};
+        const auto replay_begin = std::chrono::steady_clock::now();
+        auto replay_result = replay_commands(reader, frames, statistics);
+        if(const auto err = ::vkDeviceWaitIdle(**_device); err != VK_SUCCESS) {
+            return Error(fmt::format("Unable to wait for replay: {}", vk_strerror(err)));
+        }
+        EREBOS_TRY(std::move(replay_result));
+        statistics.total_time = std::chrono::steady_clock::now() - replay_begin;
+        return statistics;
+    }
+
+    /**
+     * This function replays the commands of the capture into the specified frames. The submissions of the frames may
+     * still be in use when this function returns, so the caller must wait for the device before the frames are
+     * destroyed.
+     *
+     * @param reader     The reader of the capture
+     * @param frames     The frames to record the commands into
+     * @param statistics The statistics to update
+     * @return           Void or an error
+     * @author           Cedric Hammes
+     * @since            18/10/2026
+     */
+    auto CaptureReplayer::replay_commands(CaptureReader& reader, std::vector<Frame>& frames, ReplayStatistics& statistics) noexcept
+            -> Result<void> {
+        Frame* frame = nullptr;
+        CommandBuffer* command_buffer = nullptr;
+        auto frame_begin = std::chrono::steady_clock::now();
+
+        reader.rewind();
+        while(true) {
+            EREBOS_TRY_ASSIGN(const auto command, reader.next());
+            if(!command.has_value()) {
+                break;
+            }
+            statistics.command_count++;
+
+            // All commands except the begin of a frame must be in a frame, all recording commands need a command buffer
+            const auto type = command->type;
+            if(type != CaptureCommandType::BEGIN_FRAME && frame == nullptr) {
+                return Error(fmt::format("Unable to replay capture: Command {} outside of frame", static_cast<u16>(type)));
+            }
+            if(type >= CaptureCommandType::BEGIN_COMMAND_BUFFER && type <= CaptureCommandType::UPLOAD && command_buffer == nullptr) {
+                return Error(fmt::format("Unable to replay capture: Command {} without command buffer", static_cast<u16>(type)));
+            }
+
+            switch(type) {
+                case CaptureCommandType::BEGIN_FRAME: {
+                    frame = &frames[statistics.frame_count % frames.size()];
+                    EREBOS_TRY(frame->begin_frame());
+                    frame_begin = std::chrono::steady_clock::now();
+                    break;
+                }
+                case CaptureCommandType::END_FRAME: {
+                    const auto recording_time = std::chrono::steady_clock::now() - frame_begin;
+                    statistics.recording_time += recording_time;
+                    statistics.max_frame_recording_time = std::max(statistics.max_frame_recording_time, recording_time);
+                    statistics.frame_count++;
+                    frame = nullptr;
+                    command_buffer = nullptr;
+                    break;
+                }
+                case CaptureCommandType::ACQUIRE_COMMAND_BUFFER: {
+                    // Only the direct queue is submitted by the frame, so all command buffers are recorded for it
+                    EREBOS_TRY_ASSIGN(command_buffer, frame->get_queue_frames()[0].acquire_command_buffer());
+                    statistics.command_buffer_count++;
+                    break;
+                }
+                case CaptureCommandType::BEGIN_COMMAND_BUFFER: EREBOS_TRY(command_buffer->begin(command->value)); break;
+                case CaptureCommandType::END_COMMAND_BUFFER: EREBOS_TRY(command_buffer->end()); break;
+                case CaptureCommandType::BEGIN_LABEL: command_buffer->begin_label(command->name); break;
+                case CaptureCommandType::END_LABEL: command_buffer->end_label(); break;
+                case CaptureCommandType::CLEAR_IMAGE: record_clear(*command_buffer, _image, command->color); break;
+                case CaptureCommandType::UPLOAD: {
+                    if(command->size > 0) {
+                        record_upload(*command_buffer, _staging_buffer, _upload_buffer, std::min<VkDeviceSize>(command->size, _upload_size));
+                    }
+                    break;
+                }
+                case CaptureCommandType::SUBMIT: {
+                    EREBOS_TRY(frame->submit(false));
+                    statistics.submit_count++;
+                    break;
+                }
+            }
+        }
+
+        return {};
+    }
+}// namespace erebos::render::vulkan
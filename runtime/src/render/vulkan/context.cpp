@@ -18,14 +18,27 @@
  */
 
 #include "erebos/render/vulkan/context.hpp"
+#include "erebos/log.hpp"
 
 namespace erebos::render::vulkan {
     namespace {
-        auto VKAPI_PTR debug_messenger_callback([[maybe_unused]] VkDebugUtilsMessageSeverityFlagBitsEXT severity,
+        // The callback is called on the thread of the Vulkan call, so the messages are only queued for the log thread
+        auto VKAPI_PTR debug_messenger_callback(const VkDebugUtilsMessageSeverityFlagBitsEXT severity,
                                                 [[maybe_unused]] VkDebugUtilsMessageTypeFlagsEXT type,
                                                 const VkDebugUtilsMessengerCallbackDataEXT* callback_data,
                                                 [[maybe_unused]] void* user_data) -> VkBool32 {
-            SPDLOG_ERROR("Vulkan -> {}", callback_data->pMessage);
+            if((severity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT) != 0) {
+                EREBOS_LOG_ERROR("Vulkan -> {}", callback_data->pMessage);
+            }
+            else if((severity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT) != 0) {
+                EREBOS_LOG_WARN("Vulkan -> {}", callback_data->pMessage);
+            }
+            else if((severity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT) != 0) {
+                EREBOS_LOG_DEBUG("Vulkan -> {}", callback_data->pMessage);
+            }
+            else {
+                EREBOS_LOG_TRACE("Vulkan -> {}", callback_data->pMessage);
+            }
             return VK_TRUE;
         }
     }// namespace
@@ -35,25 +48,6 @@ namespace erebos::render::vulkan {
         , _instance_handle()
         , _surface_handle()
         , _debug_messenger(nullptr) {
-        const std::vector<const char*> layers = {
-#ifdef BUILD_DEBUG
-            "VK_LAYER_KHRONOS_validation"
-#endif
-        };
-
-        if(const auto error = volkInitialize(); error != VK_SUCCESS) {
-            throw std::runtime_error {fmt::format("Unable to initialize Volk: {}", vk_strerror(error))};
-        }
-
-        // Acquire API version of Vulkan
-        if(const auto error = vkEnumerateInstanceVersion(&_api_version); error != VK_SUCCESS) {
-            throw std::runtime_error {fmt::format("Unable to acquire Vulkan API version: {}", vk_strerror(error))};
-        }
-        SPDLOG_INFO("Detected Vulkan API Version {}.{}.{}",
-                    VK_API_VERSION_MAJOR(_api_version),
-                    VK_API_VERSION_MINOR(_api_version),
-                    VK_API_VERSION_PATCH(_api_version));
-
         // Get Vulkan extensions
         using namespace std::string_literals;
         uint32_t window_extension_count = 0;
@@ -67,44 +61,7 @@ namespace erebos::render::vulkan {
         }
 
         extensions.push_back(VK_KHR_GET_SURFACE_CAPABILITIES_2_EXTENSION_NAME);
-#ifdef BUILD_DEBUG
-        extensions.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
-#endif
-
-        // Create application info and instance
-        VkApplicationInfo application_info {};
-        application_info.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
-        application_info.pEngineName = "Erebos Engine";
-        application_info.engineVersion = VK_MAKE_VERSION(1, 0, 0);
-        application_info.apiVersion = _api_version;
-
-        VkInstanceCreateInfo instance_create_info {};
-        instance_create_info.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
-        instance_create_info.pApplicationInfo = &application_info;
-        instance_create_info.enabledExtensionCount = extensions.size();
-        instance_create_info.ppEnabledExtensionNames = extensions.data();
-        instance_create_info.enabledLayerCount = layers.size();
-        instance_create_info.ppEnabledLayerNames = layers.data();
-        if(const auto error = ::vkCreateInstance(&instance_create_info, nullptr, &_instance_handle); error != VK_SUCCESS) {
-            throw std::runtime_error {fmt::format("Unable to create Vulkan instance: {}", vk_strerror(error))};
-        }
-        SPDLOG_INFO("Successfully created instance for Vulkan Context (Extensions = {}, Layers = {})", extensions.size(), layers.size());
-        ::volkLoadInstance(_instance_handle);
-
-#ifdef BUILD_DEBUG
-        // Create debug utils messenger if debug build
-        VkDebugUtilsMessengerCreateInfoEXT debug_messenger_create_info {};
-        debug_messenger_create_info.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT;
-        debug_messenger_create_info.messageSeverity =
-            VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
-        debug_messenger_create_info.messageType =
-            VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
-        debug_messenger_create_info.pfnUserCallback = debug_messenger_callback;
-        if(const auto err = ::vkCreateDebugUtilsMessengerEXT(_instance_handle, &debug_messenger_create_info, nullptr, &_debug_messenger);
-           err != VK_SUCCESS) {
-            throw std::runtime_error {fmt::format("Unable to initialize debug messenger: {}", vk_strerror(err))};
-        }
-#endif
+        create_instance(std::move(extensions));
 
         // Create surface
         if(!::SDL_Vulkan_CreateSurface(*window, _instance_handle, &_surface_handle)) {
@@ -112,6 +69,22 @@ namespace erebos::render::vulkan {
         }
     }
 
+    /**
+     * This constructor creates a Vulkan context without window and surface. Devices created with this context don't
+     * enable the swapchain extensions, so it can be used for benchmarks and tools on drivers without presentation
+     * support like lavapipe.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    VulkanContext::VulkanContext()
+        : _window(nullptr)
+        , _instance_handle()
+        , _surface_handle()
+        , _debug_messenger(nullptr) {
+        create_instance({});
+    }
+
     VulkanContext::VulkanContext(VulkanContext&& other) noexcept
         : _window(other._window)
         , _api_version(other._api_version)
@@ -153,4 +126,72 @@ namespace erebos::render::vulkan {
         other._surface_handle = nullptr;
         return *this;
     }
+
+    /**
+     * This function initializes Volk and creates the instance with the specified extensions and the validation layer
+     * and debug messenger in debug builds.
+     *
+     * @param extensions The instance extensions required by the caller
+     * @author           Cedric Hammes
+     * @since            18/10/2026
+     */
+    auto VulkanContext::create_instance(std::vector<const char*> extensions) -> void {
+        const std::vector<const char*> layers = {
+#ifdef BUILD_DEBUG
+            "VK_LAYER_KHRONOS_validation"
+#endif
+        };
+
+        if(const auto error = volkInitialize(); error != VK_SUCCESS) {
+            throw std::runtime_error {fmt::format("Unable to initialize Volk: {}", vk_strerror(error))};
+        }
+
+        // Acquire API version of Vulkan
+        if(const auto error = vkEnumerateInstanceVersion(&_api_version); error != VK_SUCCESS) {
+            throw std::runtime_error {fmt::format("Unable to acquire Vulkan API version: {}", vk_strerror(error))};
+        }
+        EREBOS_LOG_INFO("Detected Vulkan API Version {}.{}.{}",
+                        VK_API_VERSION_MAJOR(_api_version),
+                        VK_API_VERSION_MINOR(_api_version),
+                        VK_API_VERSION_PATCH(_api_version));
+
+#ifdef BUILD_DEBUG
+        extensions.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+#endif
+
+        // Create application info and instance
+        VkApplicationInfo application_info {};
+        application_info.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+        application_info.pEngineName = "Erebos Engine";
+        application_info.engineVersion = VK_MAKE_VERSION(1, 0, 0);
+        application_info.apiVersion = _api_version;
+
+        VkInstanceCreateInfo instance_create_info {};
+        instance_create_info.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+        instance_create_info.pApplicationInfo = &application_info;
+        instance_create_info.enabledExtensionCount = extensions.size();
+        instance_create_info.ppEnabledExtensionNames = extensions.data();
+        instance_create_info.enabledLayerCount = layers.size();
+        instance_create_info.ppEnabledLayerNames = layers.data();
+        if(const auto error = ::vkCreateInstance(&instance_create_info, nullptr, &_instance_handle); error != VK_SUCCESS) {
+            throw std::runtime_error {fmt::format("Unable to create Vulkan instance: {}", vk_strerror(error))};
+        }
+        EREBOS_LOG_INFO("Successfully created instance for Vulkan Context (Extensions = {}, Layers = {})", extensions.size(), layers.size());
+        ::volkLoadInstance(_instance_handle);
+
+#ifdef BUILD_DEBUG
+        // Create debug utils messenger if debug build
+        VkDebugUtilsMessengerCreateInfoEXT debug_messenger_create_info {};
+        debug_messenger_create_info.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT;
+        debug_messenger_create_info.messageSeverity =
+            VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+        debug_messenger_create_info.messageType =
+            VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+        debug_messenger_create_info.pfnUserCallback = debug_messenger_callback;
+        if(const auto err = ::vkCreateDebugUtilsMessengerEXT(_instance_handle, &debug_messenger_create_info, nullptr, &_debug_messenger);
+           err != VK_SUCCESS) {
+            throw std::runtime_error {fmt::format("Unable to initialize debug messenger: {}", vk_strerror(err))};
+        }
+#endif
+    }
 }// namespace erebos::render::vulkan
\ No newline at end of file
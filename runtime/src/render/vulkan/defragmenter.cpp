@@ -0,0 +1,430 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include "erebos/render/vulkan/defragmenter.hpp"
+#include <algorithm>
+#include <span>
+
+namespace erebos::render::vulkan {
+    /**
+     * This constructor creates a defragmenter for the default pools of the device's allocator or the specified pool.
+     * The old buffers of a pass are destroyed after the specified count of frames, so run must be called once per frame
+     * after the frame waited for its last submission. With zero frames in flight, the old buffers are destroyed right
+     * after the copies and the caller must ensure that the device doesn't use them anymore.
+     *
+     * @param device             The device to defragment the memory of
+     * @param pool               The pool to defragment or null for the default pools
+     * @param max_bytes_per_pass The maximum count of bytes moved in a single pass
+     * @param frames_in_flight   The count of frames, which may reference a buffer after it was replaced
+     * @author                   Cedric Hammes
+     * @since                    18/10/2026
+     */
+    Defragmenter::Defragmenter(const Device& device, VmaPool pool, VkDeviceSize max_bytes_per_pass, u32 frames_in_flight)
+        : _device {&device}
+        , _pool {pool}
+        , _max_bytes_per_pass {max_bytes_per_pass}
+        , _frames_in_flight {frames_in_flight}
+        , _transfer_command_pool {device, device.get_transfer_queue().get_family_index()}
+        , _direct_command_pool {device, device.get_direct_queue().get_family_index()}
+        , _transfer_command_buffers {}
+        , _direct_command_buffers {}
+        , _copy_fence {device, false, "Defragmentation Copy Fence"}
+        , _defragmentation_context {nullptr}
+        , _pass_info {}
+        , _is_pass_submitted {false}
+        , _remaining_retire_frame_count {0}
+        , _registered_buffers {}
+        , _pending_moves {}
+        , _retired_buffers {}
+        , _statistics {} {
+        auto transfer_command_buffers = _transfer_command_pool.allocate(1);
+        if(transfer_command_buffers.is_error()) {
+            throw std::runtime_error {fmt::format("Unable to create defragmenter: {}", transfer_command_buffers.get_error())};
+        }
+        _transfer_command_buffers = std::move(transfer_command_buffers.get());
+
+        auto direct_command_buffers = _direct_command_pool.allocate(1);
+        if(direct_command_buffers.is_error()) {
+            throw std::runtime_error {fmt::format("Unable to create defragmenter: {}", direct_command_buffers.get_error())};
+        }
+        _direct_command_buffers = std::move(direct_command_buffers.get());
+    }
+
+    /**
+     * This destructor waits for the copies of a submitted pass and ends the defragmentation. The moves of the
+     * submitted pass are discarded, so the registered buffers keep their old handles. If the old buffers of a pass are
+     * still kept alive for the frames in flight, the destructor waits for the device before destroying them.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    Defragmenter::~Defragmenter() noexcept {
+        if(_is_pass_submitted) {
+            static_cast<void>(_copy_fence.wait());
+            discard_pass();
+        }
+
+        if(_remaining_retire_frame_count > 0) {
+            static_cast<void>(::vkDeviceWaitIdle(**_device));
+            _remaining_retire_frame_count = 0;
+            static_cast<void>(end_pass());
+        }
+
+        if(_defragmentation_context != nullptr) {
+            end_defragmentation();
+        }
+    }
+
+    /**
+     * This function registers a buffer, which can be moved by the defragmentation. The buffer must be created with
+     * the transfer source and destination usage flags. Concurrent buffers must be shared with the transfer queue
+     * family, exclusive buffers must be owned by the direct queue family.
+     *
+     * @param allocation     The allocation of the buffer
+     * @param buffer         The buffer itself
+     * @param create_info    The info used to create the buffer
+     * @param moved_callback The callback called after the buffer was moved
+     * @param data           The data passed to the callback
+     * @return               Void or an error
+     * @author               Cedric Hammes
+     * @since                18/10/2026
+     */
+    auto Defragmenter::register_buffer(VmaAllocation allocation,
+                                       VkBuffer buffer,
+                                       const VkBufferCreateInfo& create_info,
+                                       BufferMovedCallbackFunction moved_callback,
+                                       void* data) noexcept -> Result<void> {
+        constexpr VkBufferUsageFlags required_usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+        if((create_info.usage & required_usage) != required_usage) {
+            return Error(fmt::format("Unable to register buffer {}: Buffer is not usable as transfer source and destination",
+                                     fmt::ptr(buffer)));
+        }
+
+        // Copy queue family indices into the registration, the create info is used to re-create the buffer later
+        RegisteredBuffer registered_buffer {buffer, create_info, std::move(moved_callback), data, {}};
+        registered_buffer.create_info.pNext = nullptr;
+        if(create_info.sharingMode == VK_SHARING_MODE_CONCURRENT) {
+            registered_buffer.queue_family_indices.assign(create_info.pQueueFamilyIndices,
+                                                          create_info.pQueueFamilyIndices + create_info.queueFamilyIndexCount);
+        }
+        _registered_buffers.insert_or_assign(allocation, std::move(registered_buffer));
+        return {};
+    }
+
+    /**
+     * This function unregisters the buffer of the specified allocation. This must be called before the buffer gets
+     * destroyed by its owner. If the buffer is moved by the submitted pass, the move is discarded.
+     *
+     * @param allocation The allocation of the buffer
+     * @author           Cedric Hammes
+     * @since            18/10/2026
+     */
+    auto Defragmenter::unregister_buffer(VmaAllocation allocation) noexcept -> void {
+        _registered_buffers.erase(allocation);
+    }
+
+    /**
+     * This function returns the current buffer handle of the specified allocation. The handle changes when the
+     * buffer was moved by the defragmentation.
+     *
+     * @param allocation The allocation of the buffer
+     * @return           The buffer handle or null if the allocation isn't registered
+     * @author           Cedric Hammes
+     * @since            18/10/2026
+     */
+    auto Defragmenter::get_buffer(VmaAllocation allocation) const noexcept -> VkBuffer {
+        const auto registered_buffer = _registered_buffers.find(allocation);
+        return registered_buffer != _registered_buffers.cend() ? registered_buffer->second.buffer : nullptr;
+    }
+
+    /**
+     * This function continues the defragmentation until the time budget is exhausted, the copies of the submitted
+     * pass aren't complete yet, the old buffers of a pass wait for the frames in flight or the defragmentation is
+     * complete. A new defragmentation is started if no defragmentation is running. This should be called once per
+     * frame after the frame waited for its last submission. The registered buffers must not be written by the GPU
+     * while a defragmentation is running, because the writes during the copies of a pass are lost.
+     *
+     * @param time_budget The time budget for the passes in this call
+     * @return            Whether the defragmentation is complete or an error
+     * @author            Cedric Hammes
+     * @since             18/10/2026
+     */
+    auto Defragmenter::run(std::chrono::microseconds time_budget) noexcept -> Result<bool> {
+        const auto deadline = std::chrono::steady_clock::now() + time_budget;
+        if(_defragmentation_context == nullptr) {
+            VmaDefragmentationInfo defragmentation_info {};
+            defragmentation_info.flags = VMA_DEFRAGMENTATION_FLAG_ALGORITHM_BALANCED_BIT;
+            defragmentation_info.pool = _pool;
+            defragmentation_info.maxBytesPerPass = _max_bytes_per_pass;
+            const auto err = ::vmaBeginDefragmentation(_device->get_allocator(), &defragmentation_info, &_defragmentation_context);
+            if(err != VK_SUCCESS) {
+                return Error(fmt::format("Unable to begin defragmentation: {}", vk_strerror(err)));
+            }
+        }
+
+        while(true) {
+            Result<bool> pass_result = false;
+            if(_remaining_retire_frame_count > 0) {
+                // Every call is a completed frame, the pass ends after all frames referencing the old buffers are done
+                _remaining_retire_frame_count -= 1;
+                if(_remaining_retire_frame_count > 0) {
+                    return false;
+                }
+                pass_result = end_pass();
+            }
+            else if(_is_pass_submitted) {
+                // The copies are polled, so a pass which isn't complete is continued by the next call
+                auto is_copied = _copy_fence.is_signaled();
+                if(is_copied.is_error()) {
+                    static_cast<void>(_copy_fence.wait());
+                    discard_pass();
+                    end_defragmentation();
+                    return Error(is_copied.get_error());
+                }
+
+                if(!*is_copied) {
+                    return false;
+                }
+                _is_pass_submitted = false;
+
+                // The owners switch to the new buffers, the old buffers are destroyed after the frames in flight
+                complete_moves();
+                if(!_retired_buffers.empty() && _frames_in_flight > 0) {
+                    _remaining_retire_frame_count = _frames_in_flight;
+                    return false;
+                }
+                pass_result = end_pass();
+            }
+            else {
+                if(std::chrono::steady_clock::now() >= deadline) {
+                    return false;
+                }
+                pass_result = begin_pass(deadline);
+            }
+
+            if(pass_result.is_error()) {
+                end_defragmentation();
+                return Error(pass_result.get_error());
+            }
+
+            if(*pass_result) {
+                end_defragmentation();
+                return true;
+            }
+        }
+    }
+
+    /**
+     * This function returns the fragmentation of the defragmented memory as ratio of the unused bytes in all
+     * memory blocks to the size of all memory blocks.
+     *
+     * @return The fragmentation between 0.0 and 1.0
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    auto Defragmenter::get_fragmentation() const noexcept -> float {
+        VmaStatistics statistics {};
+        if(_pool != nullptr) {
+            VmaDetailedStatistics pool_statistics {};
+            ::vmaCalculatePoolStatistics(_device->get_allocator(), _pool, &pool_statistics);
+            statistics = pool_statistics.statistics;
+        }
+        else {
+            VmaTotalStatistics total_statistics {};
+            ::vmaCalculateStatistics(_device->get_allocator(), &total_statistics);
+            statistics = total_statistics.total.statistics;
+        }
+
+        if(statistics.blockBytes == 0) {
+            return 0.0f;
+        }
+        return 1.0f - static_cast<float>(statistics.allocationBytes) / static_cast<float>(statistics.blockBytes);
+    }
+
+    auto Defragmenter::begin_pass(const std::chrono::steady_clock::time_point deadline) noexcept -> Result<bool> {
+        _pass_info = {};
+        if(const auto err = ::vmaBeginDefragmentationPass(_device->get_allocator(), _defragmentation_context, &_pass_info);
+           err == VK_SUCCESS) {
+            return true;
+        }
+        else if(err != VK_INCOMPLETE) {
+            return Error(fmt::format("Unable to begin defragmentation pass: {}", vk_strerror(err)));
+        }
+        _statistics.pass_count += 1;
+
+        // Ignore all moves of this pass if the moves can't be executed, so VMA releases the temporary allocations
+        if(auto record_result = record_moves(deadline); record_result.is_error()) {
+            discard_pass();
+            return Error(record_result.get_error());
+        }
+
+        if(_pending_moves.empty()) {
+            complete_moves();
+            return end_pass();
+        }
+
+        if(auto submit_result = submit_copies(); submit_result.is_error()) {
+            discard_pass();
+            return Error(submit_result.get_error());
+        }
+        _is_pass_submitted = true;
+        return false;
+    }
+
+    auto Defragmenter::end_pass() noexcept -> Result<bool> {
+        // The old buffers must be destroyed before the pass ends, VMA releases their memory when the pass ends
+        destroy_retired_buffers();
+        const auto err = ::vmaEndDefragmentationPass(_device->get_allocator(), _defragmentation_context, &_pass_info);
+        if(err != VK_SUCCESS && err != VK_INCOMPLETE) {
+            return Error(fmt::format("Unable to end defragmentation pass: {}", vk_strerror(err)));
+        }
+        return err == VK_SUCCESS;
+    }
+
+    auto Defragmenter::record_moves(const std::chrono::steady_clock::time_point deadline) noexcept -> Result<void> {
+        // Create the new buffers and bind them to the new location of the allocations. After the deadline, the remaining
+        // moves are ignored, VMA doesn't move their blocks again in this defragmentation.
+        _pending_moves.clear();
+        const auto moves = std::span {_pass_info.pMoves, _pass_info.moveCount};
+        for(usize move_index = 0; move_index < moves.size(); move_index++) {
+            auto& move = moves[move_index];
+            auto registered_buffer = _registered_buffers.find(move.srcAllocation);
+            if(registered_buffer == _registered_buffers.end() ||
+               (!_pending_moves.empty() && std::chrono::steady_clock::now() >= deadline)) {
+                move.operation = VMA_DEFRAGMENTATION_MOVE_OPERATION_IGNORE;
+                _statistics.ignored_allocation_count += 1;
+                continue;
+            }
+
+            auto create_info = registered_buffer->second.create_info;
+            create_info.pQueueFamilyIndices = registered_buffer->second.queue_family_indices.data();
+            VkBuffer new_buffer = nullptr;
+            if(const auto err = ::vkCreateBuffer(**_device, &create_info, nullptr, &new_buffer); err != VK_SUCCESS) {
+                return Error(fmt::format("Unable to create buffer for defragmentation move: {}", vk_strerror(err)));
+            }
+
+            if(const auto err = ::vmaBindBufferMemory(_device->get_allocator(), move.dstTmpAllocation, new_buffer); err != VK_SUCCESS) {
+                ::vkDestroyBuffer(**_device, new_buffer, nullptr);
+                return Error(fmt::format("Unable to bind buffer for defragmentation move: {}", vk_strerror(err)));
+            }
+            _pending_moves.push_back({move_index,
+                                      move.srcAllocation,
+                                      registered_buffer->second.buffer,
+                                      new_buffer,
+                                      create_info.size,
+                                      create_info.sharingMode == VK_SHARING_MODE_EXCLUSIVE});
+        }
+        return {};
+    }
+
+    auto Defragmenter::submit_copies() noexcept -> Result<void> {
+        // Exclusive buffers are owned by the direct queue family, so they're copied on the direct queue if the transfer
+        // queue has its own family. Otherwise the copies don't compete with the rendering on the direct queue.
+        const auto& transfer_queue = _device->get_transfer_queue();
+        const auto& direct_queue = _device->get_direct_queue();
+        const auto is_exclusive_move = std::any_of(_pending_moves.cbegin(), _pending_moves.cend(), [](const auto& pending_move) noexcept {
+            return pending_move.is_exclusive;
+        });
+        const auto is_direct_copy = is_exclusive_move && transfer_queue.get_family_index() != direct_queue.get_family_index();
+        const auto& command_buffer = is_direct_copy ? _direct_command_buffers[0] : _transfer_command_buffers[0];
+        EREBOS_TRY(command_buffer.begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT));
+
+        command_buffer.begin_label("Defragmentation");
+        for(const auto& pending_move : _pending_moves) {
+            VkBufferCopy copy_region {};
+            copy_region.size = pending_move.size;
+            ::vkCmdCopyBuffer(*command_buffer, pending_move.old_buffer, pending_move.new_buffer, 1, &copy_region);
+        }
+        command_buffer.end_label();
+
+        EREBOS_TRY(command_buffer.end());
+        EREBOS_TRY(_copy_fence.reset());
+
+        const auto raw_command_buffer = *command_buffer;
+        VkSubmitInfo submit_info {};
+        submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submit_info.commandBufferCount = 1;
+        submit_info.pCommandBuffers = &raw_command_buffer;
+        const auto& queue = is_direct_copy ? direct_queue : transfer_queue;
+        if(const auto err = ::vkQueueSubmit(*queue, 1, &submit_info, *_copy_fence); err != VK_SUCCESS) {
+            return Error(fmt::format("Unable to submit defragmentation copies: {}", vk_strerror(err)));
+        }
+        return {};
+    }
+
+    auto Defragmenter::complete_moves() noexcept -> void {
+        // Replace the old buffers with the new buffers, the old buffers are retired until the pass ends
+        const auto moves = std::span {_pass_info.pMoves, _pass_info.moveCount};
+        for(const auto& pending_move : _pending_moves) {
+            // The buffer was unregistered while its copy was running, so the owner keeps the allocation at its old place
+            const auto registered_buffer_entry = _registered_buffers.find(pending_move.allocation);
+            if(registered_buffer_entry == _registered_buffers.end()) {
+                ::vkDestroyBuffer(**_device, pending_move.new_buffer, nullptr);
+                moves[pending_move.move_index].operation = VMA_DEFRAGMENTATION_MOVE_OPERATION_IGNORE;
+                _statistics.ignored_allocation_count += 1;
+                continue;
+            }
+
+            auto& registered_buffer = registered_buffer_entry->second;
+            _retired_buffers.push_back(pending_move.old_buffer);
+            registered_buffer.buffer = pending_move.new_buffer;
+
+            VkDeviceAddress new_address = 0;
+            if(is_flag_set<VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT>(registered_buffer.create_info.usage)) {
+                VkBufferDeviceAddressInfo address_info {};
+                address_info.sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO;
+                address_info.buffer = pending_move.new_buffer;
+                new_address = ::vkGetBufferDeviceAddress(**_device, &address_info);
+            }
+
+            registered_buffer.moved_callback(pending_move.new_buffer, new_address, registered_buffer.data);
+            _statistics.moved_allocation_count += 1;
+            _statistics.moved_bytes += registered_buffer.create_info.size;
+        }
+        _pending_moves.clear();
+    }
+
+    auto Defragmenter::destroy_retired_buffers() noexcept -> void {
+        for(const auto retired_buffer : _retired_buffers) {
+            ::vkDestroyBuffer(**_device, retired_buffer, nullptr);
+        }
+        _retired_buffers.clear();
+    }
+
+    auto Defragmenter::discard_pass() noexcept -> void {
+        for(const auto& pending_move : _pending_moves) {
+            ::vkDestroyBuffer(**_device, pending_move.new_buffer, nullptr);
+        }
+        _pending_moves.clear();
+        _is_pass_submitted = false;
+
+        for(auto& move : std::span {_pass_info.pMoves, _pass_info.moveCount}) {
+            move.operation = VMA_DEFRAGMENTATION_MOVE_OPERATION_IGNORE;
+        }
+        static_cast<void>(::vmaEndDefragmentationPass(_device->get_allocator(), _defragmentation_context, &_pass_info));
+    }
+
+    auto Defragmenter::end_defragmentation() noexcept -> void {
+        VmaDefragmentationStats defragmentation_stats {};
+        ::vmaEndDefragmentation(_device->get_allocator(), _defragmentation_context, &defragmentation_stats);
+        _statistics.freed_bytes += defragmentation_stats.bytesFreed;
+        _statistics.freed_memory_block_count += defragmentation_stats.deviceMemoryBlocksFreed;
+        _defragmentation_context = nullptr;
+    }
+}// namespace erebos::render::vulkan
@@ -18,6 +18,8 @@
  */
 
 #include "erebos/render/vulkan/device.hpp"
+#include "erebos/log.hpp"
+#include "erebos/render/vulkan/debug_utils.hpp"
 #include "rps/runtime/vk/rps_vk_runtime.h"
 #define VMA_IMPLEMENTATION
 #include <vk_mem_alloc.h>
@@ -91,6 +93,38 @@ namespace erebos::render::vulkan {
             ::vprintf(format, args);
         }
 
+        [[nodiscard]] auto is_extension_supported(VkPhysicalDevice device_handle, std::string_view extension_name) noexcept -> bool {
+            uint32_t extension_count = 0;
+            if(::vkEnumerateDeviceExtensionProperties(device_handle, nullptr, &extension_count, nullptr) != VK_SUCCESS) {
+                return false;
+            }
+
+            std::vector<VkExtensionProperties> extensions {extension_count};
+            if(::vkEnumerateDeviceExtensionProperties(device_handle, nullptr, &extension_count, extensions.data()) != VK_SUCCESS) {
+                return false;
+            }
+            return std::any_of(extensions.cbegin(), extensions.cend(), [&](const auto& extension) noexcept -> bool {
+                return extension_name == extension.extensionName;
+            });
+        }
+
+        [[nodiscard]] auto is_time_domain_calibrateable(VkPhysicalDevice device_handle, const VkTimeDomainEXT time_domain) noexcept -> bool {
+            if(vkGetPhysicalDeviceCalibrateableTimeDomainsEXT == nullptr) {
+                return false;
+            }
+
+            uint32_t time_domain_count = 0;
+            if(::vkGetPhysicalDeviceCalibrateableTimeDomainsEXT(device_handle, &time_domain_count, nullptr) != VK_SUCCESS) {
+                return false;
+            }
+
+            std::vector<VkTimeDomainEXT> time_domains {time_domain_count};
+            if(::vkGetPhysicalDeviceCalibrateableTimeDomainsEXT(device_handle, &time_domain_count, time_domains.data()) != VK_SUCCESS) {
+                return false;
+            }
+            return std::find(time_domains.cbegin(), time_domains.cend(), time_domain) != time_domains.cend();
+        }
+
         [[nodiscard]] auto get_device_local_heap(VkPhysicalDevice device_handle) noexcept -> uint64_t {
             // Filter CPU type out (llvmpipe)
             VkPhysicalDeviceProperties properties {};
@@ -130,7 +164,11 @@ namespace erebos::render::vulkan {
         , _device_handle()
         , _rps_device()
         , _allocator()
-        , _queues() {
+        , _queues()
+        , _pipeline_layout_cache(nullptr)
+        , _is_present_wait_supported(false)
+        , _is_calibrated_timestamps_supported(false)
+        , _timestamp_period(0.0f) {
 
         // Get queue indices
         // clang-format off
@@ -179,12 +217,12 @@ namespace erebos::render::vulkan {
             queue_create_infos.push_back(transfer_queue_create_info);
         }
 
-        // clang-format off
-        constexpr std::array<const char*, 2> device_extensions = {
-            VK_KHR_SWAPCHAIN_EXTENSION_NAME,
-            VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME
-        };
-        // clang-format on
+        // Devices of headless contexts can't present, so the swapchain and present extensions aren't required
+        const auto is_headless = vulkan_context.is_headless();
+        std::vector<const char*> device_extensions = {VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME};
+        if(!is_headless) {
+            device_extensions.push_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+        }
 
         // Configure Vulkan 1.3 device features
         VkPhysicalDeviceVulkan13Features vulkan13_features {};
@@ -193,17 +231,48 @@ namespace erebos::render::vulkan {
 
         // Configure Vulkan 1.2 device features
         VkPhysicalDeviceVulkan12Features vulkan12_features {};
-        vulkan13_features.pNext = &vulkan13_features;
+        vulkan12_features.pNext = &vulkan13_features;
         vulkan12_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
         vulkan12_features.timelineSemaphore = true;
+        vulkan12_features.hostQueryReset = true;
 
         // Configure device features
         VkPhysicalDeviceFeatures2 features {};
         features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
         features.pNext = &vulkan12_features;
 
+        // Enable present id and present wait for frame pacing and latency measurement, if both are supported
+        VkPhysicalDevicePresentIdFeaturesKHR present_id_features {};
+        present_id_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR;
+        VkPhysicalDevicePresentWaitFeaturesKHR present_wait_features {};
+        present_wait_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR;
+        if(!is_headless && is_extension_supported(_physical_device, VK_KHR_PRESENT_ID_EXTENSION_NAME) &&
+           is_extension_supported(_physical_device, VK_KHR_PRESENT_WAIT_EXTENSION_NAME)) {
+            present_id_features.pNext = &present_wait_features;
+            VkPhysicalDeviceFeatures2 supported_features {};
+            supported_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+            supported_features.pNext = &present_id_features;
+            ::vkGetPhysicalDeviceFeatures2(_physical_device, &supported_features);
+
+            _is_present_wait_supported = present_id_features.presentId && present_wait_features.presentWait;
+            if(_is_present_wait_supported) {
+                device_extensions.push_back(VK_KHR_PRESENT_ID_EXTENSION_NAME);
+                device_extensions.push_back(VK_KHR_PRESENT_WAIT_EXTENSION_NAME);
+                vulkan13_features.pNext = &present_id_features;
+            }
+        }
+
+        // Enable calibrated timestamps for the GPU profiler, if the device time domain can be calibrated against the host
+        if(is_extension_supported(_physical_device, VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME) &&
+           is_time_domain_calibrateable(_physical_device, VK_TIME_DOMAIN_DEVICE_EXT) &&
+           is_time_domain_calibrateable(_physical_device, host_time_domain)) {
+            device_extensions.push_back(VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME);
+            _is_calibrated_timestamps_supported = true;
+        }
+
         VkPhysicalDeviceProperties device_properties {};
         ::vkGetPhysicalDeviceProperties(_physical_device, &device_properties);
+        _timestamp_period = device_properties.limits.timestampPeriod;
 
         // Create device
         VkDeviceCreateInfo device_create_info {};
@@ -217,25 +286,35 @@ namespace erebos::render::vulkan {
             throw std::runtime_error {fmt::format("Unable to create device: {}", vk_strerror(error))};
         }
         ::volkLoadDevice(_device_handle);
-        SPDLOG_INFO("Successfully created {} '{}' (Driver v{}.{}.{})",
-                    get_device_type(device_properties.deviceType),
-                    device_properties.deviceName,
-                    VK_API_VERSION_MAJOR(device_properties.driverVersion),
-                    VK_API_VERSION_MINOR(device_properties.driverVersion),
-                    VK_API_VERSION_PATCH(device_properties.driverVersion));
+        set_object_name(_device_handle, _device_handle, "{}", device_properties.deviceName);
+        _pipeline_layout_cache = PipelineLayoutCache(_device_handle);
+        EREBOS_LOG_INFO("Successfully created {} '{}' (Driver v{}.{}.{})",
+                        get_device_type(device_properties.deviceType),
+                        device_properties.deviceName,
+                        VK_API_VERSION_MAJOR(device_properties.driverVersion),
+                        VK_API_VERSION_MINOR(device_properties.driverVersion),
+                        VK_API_VERSION_PATCH(device_properties.driverVersion));
+        EREBOS_LOG_INFO("Present wait for '{}' is {}", device_properties.deviceName, _is_present_wait_supported ? "enabled" : "not supported");
+        EREBOS_LOG_INFO("Calibrated timestamps for '{}' are {}",
+                        device_properties.deviceName,
+                        _is_calibrated_timestamps_supported ? "enabled" : "not supported");
 
         // Initialize queues and print out information about these queues
         _queues.emplace_back(_device_handle, direct_queue_index, 0);
         _queues.emplace_back(_device_handle, compute_queue_index, 0);
         _queues.emplace_back(_device_handle, transfer_queue_index, 0);
-        SPDLOG_INFO("Initializes queues for '{}' -> Direct Queue ({}) = {}, Compute Queue ({}) = {}, Transfer Queue ({}) = {}",
-                    device_properties.deviceName,
-                    direct_queue_index,
-                    fmt::ptr(*_queues[0]),
-                    compute_queue_index,
-                    fmt::ptr(*_queues[1]),
-                    transfer_queue_index,
-                    fmt::ptr(*_queues[2]));
+        // The queues of the same family are the same handle, so the direct queue is named last and keeps its name
+        set_object_name(_device_handle, *_queues[2], "Transfer Queue");
+        set_object_name(_device_handle, *_queues[1], "Compute Queue");
+        set_object_name(_device_handle, *_queues[0], "Direct Queue");
+        EREBOS_LOG_INFO("Initializes queues for '{}' -> Direct Queue ({}) = {}, Compute Queue ({}) = {}, Transfer Queue ({}) = {}",
+                        device_properties.deviceName,
+                        direct_queue_index,
+                        fmt::ptr(*_queues[0]),
+                        compute_queue_index,
+                        fmt::ptr(*_queues[1]),
+                        transfer_queue_index,
+                        fmt::ptr(*_queues[2]));
 
         // Initialize Vulkan functions struct for VMA
         VmaVulkanFunctions vma_vulkan_functions {};
@@ -338,13 +417,19 @@ namespace erebos::render::vulkan {
         , _device_handle(other._device_handle)
         , _rps_device(other._rps_device)
         , _allocator(other._allocator)
-        , _queues(std::move(other._queues)) {
-        _device_handle = nullptr;
-        _rps_device = nullptr;
-        _allocator = nullptr;
+        , _queues(std::move(other._queues))
+        , _pipeline_layout_cache(std::move(other._pipeline_layout_cache))
+        , _is_present_wait_supported(other._is_present_wait_supported)
+        , _is_calibrated_timestamps_supported(other._is_calibrated_timestamps_supported)
+        , _timestamp_period(other._timestamp_period) {
+        other._device_handle = nullptr;
+        other._rps_device = nullptr;
+        other._allocator = nullptr;
     }
 
     Device::~Device() noexcept {
+        _pipeline_layout_cache.clear();
+
         if(_allocator != nullptr) {
             ::vmaDestroyAllocator(_allocator);
             _allocator = nullptr;
@@ -404,9 +489,13 @@ namespace erebos::render::vulkan {
         _rps_device = other._rps_device;
         _allocator = other._allocator;
         _queues = std::move(other._queues);
-        _device_handle = nullptr;
-        _rps_device = nullptr;
-        _allocator = nullptr;
+        _pipeline_layout_cache = std::move(other._pipeline_layout_cache);
+        _is_present_wait_supported = other._is_present_wait_supported;
+        _is_calibrated_timestamps_supported = other._is_calibrated_timestamps_supported;
+        _timestamp_period = other._timestamp_period;
+        other._device_handle = nullptr;
+        other._rps_device = nullptr;
+        other._allocator = nullptr;
         return *this;
     }
 
@@ -0,0 +1,333 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include "erebos/render/vulkan/gpu_profiler.hpp"
+#include "erebos/log.hpp"
+#include "rps/runtime/vk/rps_vk_runtime.h"
+#include <algorithm>
+#include <array>
+
+namespace erebos::render::vulkan {
+    namespace {
+        // Every scope uses two queries, one for the begin and one for the end timestamp
+        constexpr u32 QUERIES_PER_SCOPE = 2;
+
+        // Every query result contains the timestamp and the availability of the query
+        constexpr u32 RESULTS_PER_QUERY = 2;
+
+        [[nodiscard]] auto get_timestamp_valid_bits(const Device& device, const Queue& queue) noexcept -> u32 {
+            uint32_t queue_family_count = 0;
+            ::vkGetPhysicalDeviceQueueFamilyProperties(device.get_physical_device(), &queue_family_count, nullptr);
+            std::vector<VkQueueFamilyProperties> queue_families {queue_family_count};
+            ::vkGetPhysicalDeviceQueueFamilyProperties(device.get_physical_device(), &queue_family_count, queue_families.data());
+            if(queue.get_family_index() >= queue_families.size()) {
+                return 0;
+            }
+            return queue_families[queue.get_family_index()].timestampValidBits;
+        }
+
+        // Returns the name of the node declaration of the runtime command, which is valid as long as the render graph.
+        // Transitions inserted by RPS have no node, so RPS returns an error for them
+        [[nodiscard]] auto get_command_name(RpsRenderGraph render_graph, const u32 command_index) noexcept -> std::string_view {
+            RpsCmdInfo command_info {};
+            if(::rpsRenderGraphGetCmdInfo(render_graph, command_index, &command_info) < 0) {
+                return "RPS Transition";
+            }
+
+            if(command_info.pNodeDecl == nullptr || command_info.pNodeDecl->name == nullptr) {
+                return "RPS Node";
+            }
+            return command_info.pNodeDecl->name;
+        }
+
+        // Converts the value of the host time domain into nanoseconds of std::chrono::steady_clock
+        [[nodiscard]] auto to_host_nanoseconds(const u64 value) noexcept -> double {
+#ifdef PLATFORM_WINDOWS
+            LARGE_INTEGER frequency {};
+            ::QueryPerformanceFrequency(&frequency);
+            return static_cast<double>(value) * 1e9 / static_cast<double>(frequency.QuadPart);
+#else
+            return static_cast<double>(value);
+#endif
+        }
+    }// namespace
+
+    /**
+     * This constructor creates the timestamp query pool for the specified queue. If the queue family doesn't support
+     * timestamps, no pool is created and all scopes are ignored.
+     *
+     * @param device         The device to create the query pool on
+     * @param queue          The queue the profiled command buffers are submitted to
+     * @param scope_capacity The maximum count of scopes per frame
+     * @author               Cedric Hammes
+     * @since                18/10/2026
+     */
+    GpuProfiler::GpuProfiler(const Device& device, const Queue& queue, const u32 scope_capacity)
+        : _device {&device}
+        , _query_pool {nullptr}
+        , _query_capacity {scope_capacity * QUERIES_PER_SCOPE}
+        , _query_count {0}
+        , _depth {0}
+        , _timestamp_valid_bits {0}
+        , _scopes {}
+        , _query_results {}
+        , _timings {} {
+        _timestamp_valid_bits = std::min(get_timestamp_valid_bits(device, queue), 64u);
+        if(_timestamp_valid_bits == 0 || device.get_timestamp_period() == 0.0f) {
+            EREBOS_LOG_WARN("Queue family {} doesn't support timestamps, GPU profiling is disabled", queue.get_family_index());
+            return;
+        }
+
+        VkQueryPoolCreateInfo query_pool_create_info {};
+        query_pool_create_info.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        query_pool_create_info.queryType = VK_QUERY_TYPE_TIMESTAMP;
+        query_pool_create_info.queryCount = _query_capacity;
+        if(const auto err = ::vkCreateQueryPool(*device, &query_pool_create_info, nullptr, &_query_pool); err != VK_SUCCESS) {
+            throw std::runtime_error {fmt::format("Unable to create timestamp query pool: {}", vk_strerror(err))};
+        }
+        set_object_name(*device, _query_pool, "GPU Profiler Query Pool (Queue Family {})", queue.get_family_index());
+
+        // Queries have to be reset before the first use, the reset is done by the host so no command buffer is needed
+        ::vkResetQueryPool(*device, _query_pool, 0, _query_capacity);
+        _scopes.reserve(scope_capacity);
+        _query_results.resize(static_cast<usize>(_query_capacity) * RESULTS_PER_QUERY);
+        _timings.reserve(scope_capacity);
+    }
+
+    GpuProfiler::GpuProfiler(GpuProfiler&& other) noexcept
+        : _device {other._device}
+        , _query_pool {other._query_pool}
+        , _query_capacity {other._query_capacity}
+        , _query_count {other._query_count}
+        , _depth {other._depth}
+        , _timestamp_valid_bits {other._timestamp_valid_bits}
+        , _scopes {std::move(other._scopes)}
+        , _query_results {std::move(other._query_results)}
+        , _timings {std::move(other._timings)} {
+        other._query_pool = nullptr;
+    }
+
+    GpuProfiler::~GpuProfiler() noexcept {
+        if(_query_pool != nullptr) {
+            ::vkDestroyQueryPool(**_device, _query_pool, nullptr);
+            _query_pool = nullptr;
+        }
+    }
+
+    /**
+     * This function writes the begin timestamp of a scope into the command buffer. If the query pool is full, the
+     * scope is ignored. In debug builds a label region with the name of the scope is opened in the command buffer, even
+     * if the scope is ignored.
+     *
+     * @param command_buffer The command buffer to write the timestamp into
+     * @param name           The name of the scope, it has to be valid until the timings are read back
+     * @param index          An additional index of the scope, like the command index of a render graph node
+     * @return               The scope or INVALID_SCOPE if the scope is ignored
+     * @author               Cedric Hammes
+     * @since                18/10/2026
+     */
+    auto GpuProfiler::begin_scope(const CommandBuffer& command_buffer, const std::string_view name, const u32 index) noexcept -> u32 {
+        command_buffer.begin_label(name);
+        if(_query_pool == nullptr || _query_count + QUERIES_PER_SCOPE > _query_capacity) [[unlikely]] {
+            return INVALID_SCOPE;
+        }
+
+        const auto query_index = _query_count;
+        _query_count += QUERIES_PER_SCOPE;
+        ::vkCmdWriteTimestamp(*command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, _query_pool, query_index);
+        _scopes.push_back({name, index, _depth++, query_index});
+        return static_cast<u32>(_scopes.size() - 1);
+    }
+
+    /**
+     * This function writes the end timestamp of the scope into the command buffer and closes the label region of the
+     * scope.
+     *
+     * @param command_buffer The command buffer to write the timestamp into
+     * @param scope          The scope returned by begin_scope
+     * @author               Cedric Hammes
+     * @since                18/10/2026
+     */
+    auto GpuProfiler::end_scope(const CommandBuffer& command_buffer, const u32 scope) noexcept -> void {
+        command_buffer.end_label();
+        if(scope == INVALID_SCOPE) [[unlikely]] {
+            return;
+        }
+
+        _depth--;
+        ::vkCmdWriteTimestamp(*command_buffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, _query_pool, _scopes[scope].query_index + 1);
+    }
+
+    /**
+     * This function records the commands of the specified batch of the RPS render graph into the command buffer. Every
+     * command is recorded separately and wrapped into its own scope named after the node, so every node of the render
+     * graph is timed.
+     *
+     * @param render_graph   The render graph to record
+     * @param command_buffer The command buffer to record the commands into
+     * @param frame_index    The index of the frame passed to RPS
+     * @param batch_index    The index of the command batch in the batch layout of the render graph
+     * @param user_context   The user context passed to the node callbacks
+     * @return               Void or an error
+     * @author               Cedric Hammes
+     * @since                18/10/2026
+     */
+    auto GpuProfiler::record_render_graph(RpsRenderGraph render_graph,
+                                          const CommandBuffer& command_buffer,
+                                          const u64 frame_index,
+                                          const u32 batch_index,
+                                          void* user_context) noexcept -> Result<void, ErrorCode> {
+        RpsRenderGraphBatchLayout batch_layout {};
+        if(::rpsRenderGraphGetBatchLayout(render_graph, &batch_layout) < 0 || batch_index >= batch_layout.numCmdBatches) {
+            return Error(ErrorCode {ErrorKind::RECORD_RENDER_GRAPH});
+        }
+
+        const auto& batch = batch_layout.pCmdBatches[batch_index];
+        for(u32 i = 0; i < batch.numCmds; i++) {
+            RpsRenderGraphRecordCommandInfo record_command_info {};
+            record_command_info.hCmdBuffer = ::rpsVKCommandBufferToHandle(*command_buffer);
+            record_command_info.pUserContext = user_context;
+            record_command_info.frameIndex = frame_index;
+            record_command_info.cmdBeginIndex = batch.cmdBegin + i;
+            record_command_info.numCmds = 1;
+            if constexpr(is_debug_utils_enabled()) {
+                // RPS opens a label with the name of the node inside of the scope
+                record_command_info.flags = RPS_RECORD_COMMAND_FLAG_ENABLE_COMMAND_DEBUG_MARKERS;
+            }
+
+            const auto scope = begin_scope(command_buffer, get_command_name(render_graph, batch.cmdBegin + i), batch.cmdBegin + i);
+            const auto result = ::rpsRenderGraphRecordCommands(render_graph, &record_command_info);
+            end_scope(command_buffer, scope);
+            if(result < 0) {
+                return Error(ErrorCode {ErrorKind::RECORD_RENDER_GRAPH});
+            }
+        }
+        return {};
+    }
+
+    /**
+     * This function reads the timestamps of the last recorded frame back, converts them into timings and resets the
+     * query pool. This function has to be called after the submission of the frame has finished.
+     *
+     * @return Void or an error
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    auto GpuProfiler::read_back() noexcept -> Result<void, ErrorCode> {
+        _timings.clear();
+        if(_query_count == 0) {
+            return {};
+        }
+
+        // Queries of scopes, which were never submitted, are unavailable and VK_NOT_READY is returned for them
+        constexpr auto stride = sizeof(u64) * RESULTS_PER_QUERY;
+        constexpr auto flags = VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT;
+        const auto err = ::vkGetQueryPoolResults(**_device, _query_pool, 0, _query_count, _query_count * stride, _query_results.data(), stride, flags);
+        if(err != VK_SUCCESS && err != VK_NOT_READY) {
+            return Error(ErrorCode {ErrorKind::GET_QUERY_POOL_RESULTS, err});
+        }
+
+        // Map the timestamps into the host time domain if calibrated, otherwise relative to the first timestamp
+        const auto timestamp_period = static_cast<double>(_device->get_timestamp_period());
+        u64 base_timestamp = std::numeric_limits<u64>::max();
+        double base_nanoseconds = 0.0;
+        if(is_calibrated()) {
+            std::array<VkCalibratedTimestampInfoEXT, 2> timestamp_infos {};
+            timestamp_infos[0].sType = VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT;
+            timestamp_infos[0].timeDomain = VK_TIME_DOMAIN_DEVICE_EXT;
+            timestamp_infos[1].sType = VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT;
+            timestamp_infos[1].timeDomain = host_time_domain;
+
+            std::array<u64, 2> timestamps {};
+            u64 max_deviation = 0;
+            if(const auto calibrate_err = ::vkGetCalibratedTimestampsEXT(**_device, 2, timestamp_infos.data(), timestamps.data(), &max_deviation);
+               calibrate_err != VK_SUCCESS) {
+                return Error(ErrorCode {ErrorKind::GET_CALIBRATED_TIMESTAMPS, calibrate_err});
+            }
+            base_timestamp = timestamps[0];
+            base_nanoseconds = to_host_nanoseconds(timestamps[1]);
+        }
+        else {
+            for(u32 query = 0; query < _query_count; query++) {
+                if(_query_results[query * RESULTS_PER_QUERY + 1] != 0) {
+                    base_timestamp = std::min(base_timestamp, _query_results[query * RESULTS_PER_QUERY]);
+                }
+            }
+        }
+
+        // Timestamps written before the calibration are mapped before the host timestamp of the calibration
+        const auto to_nanoseconds = [&](const u64 timestamp) noexcept -> u64 {
+            const auto delta = detail::get_timestamp_delta(timestamp, base_timestamp, _timestamp_valid_bits);
+            return static_cast<u64>(base_nanoseconds + static_cast<double>(delta) * timestamp_period);
+        };
+
+        for(const auto& scope : _scopes) {
+            const auto begin_result = &_query_results[scope.query_index * RESULTS_PER_QUERY];
+            const auto end_result = &_query_results[(scope.query_index + 1) * RESULTS_PER_QUERY];
+            if(begin_result[1] == 0 || end_result[1] == 0) {
+                continue;
+            }
+            _timings.push_back({scope.name, scope.index, scope.depth, to_nanoseconds(begin_result[0]), to_nanoseconds(end_result[0])});
+        }
+        std::stable_sort(_timings.begin(), _timings.end(), [](const GpuTiming& left, const GpuTiming& right) noexcept -> bool {
+            return left.begin < right.begin;
+        });
+
+        ::vkResetQueryPool(**_device, _query_pool, 0, _query_count);
+        _scopes.clear();
+        _query_count = 0;
+        _depth = 0;
+        return {};
+    }
+
+    /**
+     * This function returns the GPU time of the last read back frame, from the begin of the first scope to the end of
+     * the last scope.
+     *
+     * @return The GPU time of the last read back frame in nanoseconds
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    auto GpuProfiler::get_frame_duration() const noexcept -> u64 {
+        if(_timings.empty()) {
+            return 0;
+        }
+
+        // The timings are sorted by begin, the last scope can be nested into an earlier scope and end before it
+        u64 end = 0;
+        for(const auto& timing : _timings) {
+            end = std::max(end, timing.end);
+        }
+        return end - _timings.front().begin;
+    }
+
+    auto GpuProfiler::operator=(GpuProfiler&& other) noexcept -> GpuProfiler& {
+        _device = other._device;
+        _query_pool = other._query_pool;
+        _query_capacity = other._query_capacity;
+        _query_count = other._query_count;
+        _depth = other._depth;
+        _timestamp_valid_bits = other._timestamp_valid_bits;
+        _scopes = std::move(other._scopes);
+        _query_results = std::move(other._query_results);
+        _timings = std::move(other._timings);
+        other._query_pool = nullptr;
+        return *this;
+    }
+}// namespace erebos::render::vulkan
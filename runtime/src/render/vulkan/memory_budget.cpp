@@ -0,0 +1,317 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include "erebos/render/vulkan/memory_budget.hpp"
+#include <algorithm>
+#include <array>
+
+namespace erebos::render::vulkan {
+    namespace {
+        [[nodiscard]] auto get_memory_pressure(const VkDeviceSize usage, const VkDeviceSize budget) noexcept -> MemoryPressure {
+            if(budget == 0) {
+                return MemoryPressure::CRITICAL;
+            }
+
+            const auto usage_ratio = static_cast<double>(usage) / static_cast<double>(budget);
+            if(usage_ratio < 0.70) {
+                return MemoryPressure::LOW;
+            }
+            if(usage_ratio < 0.85) {
+                return MemoryPressure::MEDIUM;
+            }
+            if(usage_ratio < 0.95) {
+                return MemoryPressure::HIGH;
+            }
+            return MemoryPressure::CRITICAL;
+        }
+    }// namespace
+
+    /**
+     * This constructor creates a budget manager for all heaps of the specified allocator. The allocator must be
+     * created with VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT to receive the budget of the driver.
+     *
+     * @param allocator The allocator to track the budget of
+     * @author          Cedric Hammes
+     * @since           18/10/2026
+     */
+    MemoryBudgetManager::MemoryBudgetManager(VmaAllocator allocator) noexcept
+        : _allocator {allocator}
+        , _frame_index {0}
+        , _heap_budgets {}
+        , _budget_overrides {}
+        , _simulated_budgets {}
+        , _streaming_resources {}
+        , _next_resource_handle {1}
+        , _evicted_resource_count {0} {
+        const VkPhysicalDeviceMemoryProperties* memory_properties = nullptr;
+        ::vmaGetMemoryProperties(_allocator, &memory_properties);
+        _heap_budgets.resize(memory_properties->memoryHeapCount);
+        _budget_overrides.resize(memory_properties->memoryHeapCount);
+        update_heap_budgets();
+    }
+
+    /**
+     * This constructor creates a budget manager without a device, which simulates heaps with the specified
+     * budgets. The usage of the heaps is only based on the registered streaming resources.
+     *
+     * @param heap_budgets The budget of each simulated heap
+     * @author             Cedric Hammes
+     * @since              18/10/2026
+     */
+    MemoryBudgetManager::MemoryBudgetManager(std::vector<VkDeviceSize> heap_budgets) noexcept
+        : _allocator {nullptr}
+        , _frame_index {0}
+        , _heap_budgets(heap_budgets.size())
+        , _budget_overrides(heap_budgets.size())
+        , _simulated_budgets {std::move(heap_budgets)}
+        , _streaming_resources {}
+        , _next_resource_handle {1}
+        , _evicted_resource_count {0} {
+        update_heap_budgets();
+    }
+
+    /**
+     * This function advances the frame index of the manager and the allocator and fetches the current usage and
+     * budget of all heaps. This should be called once per frame.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    auto MemoryBudgetManager::update() noexcept -> void {
+        _frame_index += 1;
+        if(_allocator != nullptr) {
+            ::vmaSetCurrentFrameIndex(_allocator, static_cast<u32>(_frame_index));
+        }
+        update_heap_budgets();
+    }
+
+    /**
+     * This function overrides the budget of the specified heap with a smaller budget than reported by the driver.
+     * An empty override restores the budget of the driver.
+     *
+     * @param heap_index The index of the heap
+     * @param budget     The simulated budget of the heap
+     * @author           Cedric Hammes
+     * @since            18/10/2026
+     */
+    auto MemoryBudgetManager::set_budget_override(u32 heap_index, std::optional<VkDeviceSize> budget) noexcept -> void {
+        if(heap_index >= _budget_overrides.size()) {
+            return;
+        }
+        _budget_overrides[heap_index] = budget;
+        update_heap_budgets();
+    }
+
+    /**
+     * This function registers a streaming resource, which can be evicted by the manager to free up memory in the
+     * specified heap. The resource is marked as used in the current frame.
+     *
+     * @param heap_index     The index of the heap the resource lives in
+     * @param size           The size of the resource's memory
+     * @param evict_callback The callback to release the resource
+     * @param data           The data passed to the callback
+     * @return               The handle of the registered resource or an error, if the heap doesn't exist
+     * @author               Cedric Hammes
+     * @since                18/10/2026
+     */
+    auto MemoryBudgetManager::register_resource(u32 heap_index, VkDeviceSize size, EvictCallbackFunction evict_callback, void* data) noexcept
+        -> Result<StreamingResourceHandle> {
+        if(heap_index >= _heap_budgets.size()) {
+            return Error(fmt::format("Unable to register streaming resource: Heap {} doesn't exist", heap_index));
+        }
+
+        const auto handle = _next_resource_handle++;
+        _streaming_resources.push_back({handle, heap_index, size, _frame_index, std::move(evict_callback), data});
+        return handle;
+    }
+
+    /**
+     * This function unregisters the specified streaming resource without evicting it. This should be called when
+     * the resource is released by its owner.
+     *
+     * @param handle The handle of the resource
+     * @author       Cedric Hammes
+     * @since        18/10/2026
+     */
+    auto MemoryBudgetManager::unregister_resource(StreamingResourceHandle handle) noexcept -> void {
+        std::erase_if(_streaming_resources, [handle](const auto& resource) noexcept -> bool {
+            return resource.handle == handle;
+        });
+    }
+
+    /**
+     * This function marks the specified streaming resource as used in the current frame, so it gets evicted after
+     * all resources which weren't used since.
+     *
+     * @param handle The handle of the resource
+     * @author       Cedric Hammes
+     * @since        18/10/2026
+     */
+    auto MemoryBudgetManager::touch(StreamingResourceHandle handle) noexcept -> void {
+        const auto resource = std::find_if(_streaming_resources.begin(), _streaming_resources.end(), [handle](const auto& resource) noexcept {
+            return resource.handle == handle;
+        });
+        if(resource != _streaming_resources.end()) {
+            resource->last_used_frame = _frame_index;
+        }
+    }
+
+    /**
+     * This function ensures that an allocation of the specified size fits into the budget of the heap. If that's
+     * not the case, the least recently used streaming resources of the heap are evicted until their sizes cover the
+     * missing bytes. Resources used in the current frame are never evicted. If the allocation doesn't fit even after
+     * evicting all candidates, nothing is evicted and this function returns an error.
+     *
+     * @param heap_index The index of the heap
+     * @param size       The size of the planned allocation
+     * @return           Void or an error
+     * @author           Cedric Hammes
+     * @since            18/10/2026
+     */
+    auto MemoryBudgetManager::ensure_budget(u32 heap_index, VkDeviceSize size) noexcept -> Result<void> {
+        if(heap_index >= _heap_budgets.size()) {
+            return Error(fmt::format("Unable to ensure budget: Heap {} doesn't exist", heap_index));
+        }
+
+        update_heap_budgets();
+        const auto& heap_budget = _heap_budgets[heap_index];
+        if(heap_budget.usage + size <= heap_budget.budget) {
+            return {};
+        }
+
+        // The usage of VMA is counted per memory block, so it doesn't shrink until a whole block is freed. The bytes of
+        // the evicted resources are counted instead, their space in the blocks is reused by the planned allocation.
+        const auto required_bytes = heap_budget.usage + size - heap_budget.budget;
+        std::vector<usize> candidates {};
+        for(usize i = 0; i < _streaming_resources.size(); i++) {
+            const auto& resource = _streaming_resources[i];
+            if(resource.heap_index == heap_index && resource.last_used_frame < _frame_index) {
+                candidates.push_back(i);
+            }
+        }
+        std::stable_sort(candidates.begin(), candidates.end(), [&](const auto first, const auto second) noexcept -> bool {
+            return _streaming_resources[first].last_used_frame < _streaming_resources[second].last_used_frame;
+        });
+
+        // Resources used in the current frame are never evicted, so nothing is evicted if the candidates aren't enough
+        VkDeviceSize evicted_bytes = 0;
+        usize evicted_count = 0;
+        while(evicted_count < candidates.size() && evicted_bytes < required_bytes) {
+            evicted_bytes += _streaming_resources[candidates[evicted_count]].size;
+            evicted_count += 1;
+        }
+
+        if(evicted_bytes < required_bytes) {
+            return Error(fmt::format("Unable to ensure budget: {} bytes don't fit into heap {} ({} of {} bytes used)",
+                                     size,
+                                     heap_index,
+                                     heap_budget.usage,
+                                     heap_budget.budget));
+        }
+
+        // Unregister the resources before evicting them, so the callbacks are able to re-register smaller versions
+        std::vector<StreamingResource> evicted_resources {};
+        evicted_resources.reserve(evicted_count);
+        for(usize i = 0; i < evicted_count; i++) {
+            evicted_resources.push_back(std::move(_streaming_resources[candidates[i]]));
+        }
+        std::erase_if(_streaming_resources, [&](const auto& resource) noexcept -> bool {
+            return std::any_of(evicted_resources.cbegin(), evicted_resources.cend(), [&](const auto& evicted_resource) noexcept {
+                return evicted_resource.handle == resource.handle;
+            });
+        });
+
+        for(auto& evicted_resource : evicted_resources) {
+            evicted_resource.evict_callback(evicted_resource.data);
+            _evicted_resource_count += 1;
+        }
+        update_heap_budgets();
+        return {};
+    }
+
+    /**
+     * This function returns the index of the heap, in which the specified memory type lives. Without an allocator,
+     * every memory type is mapped to the heap with the same index.
+     *
+     * @param memory_type_index The index of the memory type
+     * @return                  The index of the heap or an error, if the memory type doesn't exist
+     * @author                  Cedric Hammes
+     * @since                   18/10/2026
+     */
+    auto MemoryBudgetManager::get_heap_index(u32 memory_type_index) const noexcept -> Result<u32> {
+        if(_allocator == nullptr) {
+            if(memory_type_index >= _heap_budgets.size()) {
+                return Error(fmt::format("Unable to get heap index: Memory type {} doesn't exist", memory_type_index));
+            }
+            return memory_type_index;
+        }
+
+        const VkPhysicalDeviceMemoryProperties* memory_properties = nullptr;
+        ::vmaGetMemoryProperties(_allocator, &memory_properties);
+        if(memory_type_index >= memory_properties->memoryTypeCount) {
+            return Error(fmt::format("Unable to get heap index: Memory type {} doesn't exist", memory_type_index));
+        }
+        return memory_properties->memoryTypes[memory_type_index].heapIndex;
+    }
+
+    /**
+     * This function returns the memory pressure of the specified heap.
+     *
+     * @param heap_index The index of the heap
+     * @return           The memory pressure of the heap or an error, if the heap doesn't exist
+     * @author           Cedric Hammes
+     * @since            18/10/2026
+     */
+    auto MemoryBudgetManager::get_pressure(u32 heap_index) const noexcept -> Result<MemoryPressure> {
+        if(heap_index >= _heap_budgets.size()) {
+            return Error(fmt::format("Unable to get memory pressure: Heap {} doesn't exist", heap_index));
+        }
+        return _heap_budgets[heap_index].pressure;
+    }
+
+    auto MemoryBudgetManager::update_heap_budgets() noexcept -> void {
+        if(_allocator != nullptr) {
+            std::array<VmaBudget, VK_MAX_MEMORY_HEAPS> vma_budgets {};
+            ::vmaGetHeapBudgets(_allocator, vma_budgets.data());
+            for(usize i = 0; i < _heap_budgets.size(); i++) {
+                _heap_budgets[i].usage = vma_budgets[i].usage;
+                _heap_budgets[i].budget = vma_budgets[i].budget;
+            }
+        }
+        else {
+            for(usize i = 0; i < _heap_budgets.size(); i++) {
+                _heap_budgets[i].usage = 0;
+                _heap_budgets[i].budget = _simulated_budgets[i];
+            }
+
+            // The heap index of every resource was validated on registration
+            for(const auto& resource : _streaming_resources) {
+                _heap_budgets[resource.heap_index].usage += resource.size;
+            }
+        }
+
+        for(usize i = 0; i < _heap_budgets.size(); i++) {
+            auto& heap_budget = _heap_budgets[i];
+            if(_budget_overrides[i].has_value()) {
+                heap_budget.budget = std::min(heap_budget.budget, *_budget_overrides[i]);
+            }
+            heap_budget.pressure = get_memory_pressure(heap_budget.usage, heap_budget.budget);
+        }
+    }
+}// namespace erebos::render::vulkan
@@ -0,0 +1,369 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include "erebos/render/vulkan/pipeline_layout.hpp"
+#include <algorithm>
+#include <spirv_reflect.h>
+
+namespace erebos::render::vulkan {
+    namespace {
+        constexpr auto hash_combine(usize seed, usize value) noexcept -> usize {
+            return seed ^ (value + 0x9E3779B9 + (seed << 6) + (seed >> 2));
+        }
+
+        [[nodiscard]] auto is_same_binding(const VkDescriptorSetLayoutBinding& first, const VkDescriptorSetLayoutBinding& second) noexcept
+            -> bool {
+            return first.binding == second.binding && first.descriptorType == second.descriptorType &&
+                   first.descriptorCount == second.descriptorCount && first.stageFlags == second.stageFlags &&
+                   first.pImmutableSamplers == second.pImmutableSamplers;
+        }
+
+        [[nodiscard]] auto is_same_range(const VkPushConstantRange& first, const VkPushConstantRange& second) noexcept -> bool {
+            return first.stageFlags == second.stageFlags && first.offset == second.offset && first.size == second.size;
+        }
+
+        [[nodiscard]] auto spv_reflect_strerror(const SpvReflectResult result) noexcept -> std::string_view {
+            switch(result) {
+                case SPV_REFLECT_RESULT_ERROR_ALLOC_FAILED:
+                    return "Allocation failed";
+                case SPV_REFLECT_RESULT_ERROR_SPIRV_INVALID_CODE_SIZE:
+                    return "Invalid code size";
+                case SPV_REFLECT_RESULT_ERROR_SPIRV_INVALID_MAGIC_NUMBER:
+                    return "Invalid magic number";
+                case SPV_REFLECT_RESULT_ERROR_SPIRV_UNEXPECTED_EOF:
+                    return "Unexpected end of file";
+                default:
+                    return "Invalid module";
+            }
+        }
+    }// namespace
+
+    auto DescriptorSetLayoutInfo::operator==(const DescriptorSetLayoutInfo& other) const noexcept -> bool {
+        return std::equal(bindings.cbegin(), bindings.cend(), other.bindings.cbegin(), other.bindings.cend(), is_same_binding);
+    }
+
+    auto PipelineLayoutInfo::operator==(const PipelineLayoutInfo& other) const noexcept -> bool {
+        return sets == other.sets && std::equal(push_constant_ranges.cbegin(),
+                                                push_constant_ranges.cend(),
+                                                other.push_constant_ranges.cbegin(),
+                                                other.push_constant_ranges.cend(),
+                                                is_same_range);
+    }
+
+    auto DescriptorSetLayoutInfoHash::operator()(const DescriptorSetLayoutInfo& info) const noexcept -> usize {
+        usize hash = info.bindings.size();
+        for(const auto& binding : info.bindings) {
+            hash = hash_combine(hash, binding.binding);
+            hash = hash_combine(hash, binding.descriptorType);
+            hash = hash_combine(hash, binding.descriptorCount);
+            hash = hash_combine(hash, binding.stageFlags);
+        }
+        return hash;
+    }
+
+    /**
+     * This function reflects the specified SPIR-V module with SPIRV-Reflect and derives the descriptor set layouts and
+     * push constant ranges of the module's shader stage from it.
+     *
+     * @param spirv_code The code of the SPIR-V module
+     * @return           The pipeline layout info of the module or an error
+     * @author           Cedric Hammes
+     * @since            18/10/2026
+     */
+    auto reflect_pipeline_layout(std::span<const u32> spirv_code) noexcept -> Result<PipelineLayoutInfo> {
+        SpvReflectShaderModule module {};
+        if(const auto error = ::spvReflectCreateShaderModule(spirv_code.size_bytes(), spirv_code.data(), &module);
+           error != SPV_REFLECT_RESULT_SUCCESS) {
+            return Error(fmt::format("Unable to reflect SPIR-V module: {}", spv_reflect_strerror(error)));
+        }
+        const auto stage = static_cast<VkShaderStageFlags>(module.shader_stage);
+
+        // Enumerate descriptor sets and convert the bindings into Vulkan layout bindings
+        uint32_t set_count = 0;
+        ::spvReflectEnumerateDescriptorSets(&module, &set_count, nullptr);
+        std::vector<SpvReflectDescriptorSet*> reflected_sets {set_count};
+        ::spvReflectEnumerateDescriptorSets(&module, &set_count, reflected_sets.data());
+
+        PipelineLayoutInfo layout_info {};
+        for(const auto* reflected_set : reflected_sets) {
+            if(reflected_set->set >= layout_info.sets.size()) {
+                layout_info.sets.resize(reflected_set->set + 1);
+            }
+
+            auto& bindings = layout_info.sets[reflected_set->set].bindings;
+            for(uint32_t i = 0; i < reflected_set->binding_count; i++) {
+                const auto* reflected_binding = reflected_set->bindings[i];
+                VkDescriptorSetLayoutBinding binding {};
+                binding.binding = reflected_binding->binding;
+                binding.descriptorType = static_cast<VkDescriptorType>(reflected_binding->descriptor_type);
+                binding.descriptorCount = reflected_binding->count;
+                binding.stageFlags = stage;
+                bindings.push_back(binding);
+            }
+            std::sort(bindings.begin(), bindings.end(), [](const auto& first, const auto& second) noexcept -> bool {
+                return first.binding < second.binding;
+            });
+        }
+
+        // Enumerate push constant blocks and merge them into one range for this stage
+        uint32_t block_count = 0;
+        ::spvReflectEnumeratePushConstantBlocks(&module, &block_count, nullptr);
+        std::vector<SpvReflectBlockVariable*> reflected_blocks {block_count};
+        ::spvReflectEnumeratePushConstantBlocks(&module, &block_count, reflected_blocks.data());
+        if(!reflected_blocks.empty()) {
+            auto begin = std::numeric_limits<uint32_t>::max();
+            uint32_t end = 0;
+            for(const auto* block : reflected_blocks) {
+                begin = std::min(begin, block->offset);
+                end = std::max(end, block->offset + block->size);
+            }
+            layout_info.push_constant_ranges.push_back({stage, begin, end - begin});
+        }
+
+        ::spvReflectDestroyShaderModule(&module);
+        return layout_info;
+    }
+
+    /**
+     * This function merges the layout of the source into the target layout. Bindings which are used by multiple stages
+     * are combined into one binding with the stage flags of all stages. All push constant ranges are merged into a
+     * single range, which covers all ranges and is visible to all stages. If a binding is declared with different
+     * descriptor types in the layouts, this function returns an error.
+     *
+     * @param target The layout to merge into
+     * @param source The layout to merge from
+     * @return       Void or an error
+     * @author       Cedric Hammes
+     * @since        18/10/2026
+     */
+    auto merge_pipeline_layouts(PipelineLayoutInfo& target, const PipelineLayoutInfo& source) noexcept -> Result<void> {
+        if(source.sets.size() > target.sets.size()) {
+            target.sets.resize(source.sets.size());
+        }
+
+        // Merge the bindings of all descriptor sets
+        for(usize set = 0; set < source.sets.size(); set++) {
+            auto& target_bindings = target.sets[set].bindings;
+            for(const auto& binding : source.sets[set].bindings) {
+                const auto position = std::lower_bound(target_bindings.begin(),
+                                                       target_bindings.end(),
+                                                       binding.binding,
+                                                       [](const auto& element, const auto value) noexcept -> bool {
+                                                           return element.binding < value;
+                                                       });
+                if(position == target_bindings.end() || position->binding != binding.binding) {
+                    target_bindings.insert(position, binding);
+                    continue;
+                }
+
+                if(position->descriptorType != binding.descriptorType) {
+                    return Error(fmt::format("Unable to merge pipeline layouts: Binding {} in set {} is declared with different types",
+                                             binding.binding,
+                                             set));
+                }
+                position->descriptorCount = std::max(position->descriptorCount, binding.descriptorCount);
+                position->stageFlags |= binding.stageFlags;
+            }
+        }
+
+        // Merge all push constant ranges into a single range
+        if(source.push_constant_ranges.empty()) {
+            return {};
+        }
+
+        VkPushConstantRange merged_range {0, std::numeric_limits<uint32_t>::max(), 0};
+        uint32_t end = 0;
+        const auto merge_range = [&](const VkPushConstantRange& range) noexcept -> void {
+            merged_range.stageFlags |= range.stageFlags;
+            merged_range.offset = std::min(merged_range.offset, range.offset);
+            end = std::max(end, range.offset + range.size);
+        };
+        std::for_each(target.push_constant_ranges.cbegin(), target.push_constant_ranges.cend(), merge_range);
+        std::for_each(source.push_constant_ranges.cbegin(), source.push_constant_ranges.cend(), merge_range);
+        merged_range.size = end - merged_range.offset;
+        target.push_constant_ranges = {merged_range};
+        return {};
+    }
+
+    auto PipelineLayoutCache::PipelineLayoutKey::operator==(const PipelineLayoutKey& other) const noexcept -> bool {
+        return set_layouts == other.set_layouts && std::equal(push_constant_ranges.cbegin(),
+                                                              push_constant_ranges.cend(),
+                                                              other.push_constant_ranges.cbegin(),
+                                                              other.push_constant_ranges.cend(),
+                                                              is_same_range);
+    }
+
+    auto PipelineLayoutCache::PipelineLayoutKeyHash::operator()(const PipelineLayoutKey& key) const noexcept -> usize {
+        usize hash = key.set_layouts.size();
+        for(const auto set_layout : key.set_layouts) {
+            hash = hash_combine(hash, std::hash<VkDescriptorSetLayout> {}(set_layout));
+        }
+        for(const auto& range : key.push_constant_ranges) {
+            hash = hash_combine(hash, range.stageFlags);
+            hash = hash_combine(hash, range.offset);
+            hash = hash_combine(hash, range.size);
+        }
+        return hash;
+    }
+
+    PipelineLayoutCache::PipelineLayoutCache(VkDevice device) noexcept
+        : _device {device}
+        , _descriptor_set_layouts {}
+        , _pipeline_layouts {} {
+    }
+
+    PipelineLayoutCache::PipelineLayoutCache(PipelineLayoutCache&& other) noexcept
+        : _device {other._device}
+        , _descriptor_set_layouts {std::move(other._descriptor_set_layouts)}
+        , _pipeline_layouts {std::move(other._pipeline_layouts)} {
+        other._device = nullptr;
+        other._descriptor_set_layouts.clear();
+        other._pipeline_layouts.clear();
+    }
+
+    PipelineLayoutCache::~PipelineLayoutCache() noexcept {
+        clear();
+    }
+
+    /**
+     * This function returns the descriptor set layout for the specified description. If there is no cached layout
+     * with the same description, the layout gets created and inserted into the cache.
+     *
+     * @param info The description of the descriptor set layout
+     * @return     The descriptor set layout or an error
+     * @author     Cedric Hammes
+     * @since      18/10/2026
+     */
+    auto PipelineLayoutCache::get_descriptor_set_layout(const DescriptorSetLayoutInfo& info) noexcept -> Result<VkDescriptorSetLayout> {
+        if(const auto entry = _descriptor_set_layouts.find(info); entry != _descriptor_set_layouts.end()) {
+            return entry->second;
+        }
+
+        VkDescriptorSetLayoutCreateInfo create_info {};
+        create_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        create_info.bindingCount = info.bindings.size();
+        create_info.pBindings = info.bindings.data();
+
+        VkDescriptorSetLayout layout {};
+        if(const auto error = ::vkCreateDescriptorSetLayout(_device, &create_info, nullptr, &layout); error != VK_SUCCESS) {
+            return Error(fmt::format("Unable to create descriptor set layout: {}", vk_strerror(error)));
+        }
+        _descriptor_set_layouts.emplace(info, layout);
+        return layout;
+    }
+
+    /**
+     * This function returns the pipeline layout for the specified description. If there is no cached layout with
+     * the same description, the layout (and all missing descriptor set layouts) gets created and inserted into the
+     * cache.
+     *
+     * @param info The description of the pipeline layout
+     * @return     The pipeline layout or an error
+     * @author     Cedric Hammes
+     * @since      18/10/2026
+     */
+    auto PipelineLayoutCache::get_pipeline_layout(const PipelineLayoutInfo& info) noexcept -> Result<VkPipelineLayout> {
+        PipelineLayoutKey key {{}, info.push_constant_ranges};
+        key.set_layouts.reserve(info.sets.size());
+        for(const auto& set : info.sets) {
+            auto set_layout = get_descriptor_set_layout(set);
+            if(!set_layout) {
+                return Error(set_layout.get_error());
+            }
+            key.set_layouts.push_back(*set_layout);
+        }
+
+        if(const auto entry = _pipeline_layouts.find(key); entry != _pipeline_layouts.end()) {
+            return entry->second;
+        }
+
+        VkPipelineLayoutCreateInfo create_info {};
+        create_info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        create_info.setLayoutCount = key.set_layouts.size();
+        create_info.pSetLayouts = key.set_layouts.data();
+        create_info.pushConstantRangeCount = key.push_constant_ranges.size();
+        create_info.pPushConstantRanges = key.push_constant_ranges.data();
+
+        VkPipelineLayout layout {};
+        if(const auto error = ::vkCreatePipelineLayout(_device, &create_info, nullptr, &layout); error != VK_SUCCESS) {
+            return Error(fmt::format("Unable to create pipeline layout: {}", vk_strerror(error)));
+        }
+        _pipeline_layouts.emplace(std::move(key), layout);
+        return layout;
+    }
+
+    /**
+     * This function reflects all specified SPIR-V modules, merges their layouts and returns the pipeline layout for
+     * the merged description.
+     *
+     * @param spirv_modules The code of all SPIR-V modules used by the pipeline
+     * @return              The pipeline layout or an error
+     * @author              Cedric Hammes
+     * @since               18/10/2026
+     */
+    auto PipelineLayoutCache::get_pipeline_layout(std::initializer_list<std::span<const u32>> spirv_modules) noexcept
+        -> Result<VkPipelineLayout> {
+        PipelineLayoutInfo merged_info {};
+        for(const auto spirv_module : spirv_modules) {
+            const auto module_info = reflect_pipeline_layout(spirv_module);
+            if(!module_info) {
+                return Error(module_info.get_error());
+            }
+
+            if(const auto result = merge_pipeline_layouts(merged_info, *module_info); !result) {
+                return Error(result.get_error());
+            }
+        }
+        return get_pipeline_layout(merged_info);
+    }
+
+    /**
+     * This function destroys all cached layouts. All handles, which were returned by this cache, are invalid after
+     * this call.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    auto PipelineLayoutCache::clear() noexcept -> void {
+        if(_device == nullptr) {
+            return;
+        }
+
+        for(const auto& [key, layout] : _pipeline_layouts) {
+            ::vkDestroyPipelineLayout(_device, layout, nullptr);
+        }
+        _pipeline_layouts.clear();
+
+        for(const auto& [info, layout] : _descriptor_set_layouts) {
+            ::vkDestroyDescriptorSetLayout(_device, layout, nullptr);
+        }
+        _descriptor_set_layouts.clear();
+    }
+
+    auto PipelineLayoutCache::operator=(PipelineLayoutCache&& other) noexcept -> PipelineLayoutCache& {
+        clear();
+        _device = other._device;
+        _descriptor_set_layouts = std::move(other._descriptor_set_layouts);
+        _pipeline_layouts = std::move(other._pipeline_layouts);
+        other._device = nullptr;
+        other._descriptor_set_layouts.clear();
+        other._pipeline_layouts.clear();
+        return *this;
+    }
+}// namespace erebos::render::vulkan
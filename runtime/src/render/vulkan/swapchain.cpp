@@ -0,0 +1,494 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include "erebos/render/vulkan/swapchain.hpp"
+#include "erebos/log.hpp"
+#include "erebos/profiler.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace erebos::render::vulkan {
+    namespace {
+        [[nodiscard]] constexpr auto to_vk_present_mode(const PresentMode present_mode) noexcept -> VkPresentModeKHR {
+            switch(present_mode) {
+                case PresentMode::MAILBOX:
+                    return VK_PRESENT_MODE_MAILBOX_KHR;
+                case PresentMode::IMMEDIATE:
+                    return VK_PRESENT_MODE_IMMEDIATE_KHR;
+                case PresentMode::FIFO_RELAXED:
+                    return VK_PRESENT_MODE_FIFO_RELAXED_KHR;
+                default:
+                    return VK_PRESENT_MODE_FIFO_KHR;
+            }
+        }
+
+        [[nodiscard]] auto find_present_mode(const Device& device, const std::vector<PresentMode>& preferred_present_modes) noexcept
+            -> Result<VkPresentModeKHR> {
+            const auto physical_device = device.get_physical_device();
+            const auto surface = device.get_vulkan_context()->get_surface();
+
+            uint32_t present_mode_count = 0;
+            if(const auto err = ::vkGetPhysicalDeviceSurfacePresentModesKHR(physical_device, surface, &present_mode_count, nullptr);
+               err != VK_SUCCESS) {
+                return Error(fmt::format("Unable to acquire count of present modes: {}", vk_strerror(err)));
+            }
+
+            std::vector<VkPresentModeKHR> present_modes {present_mode_count};
+            if(const auto err = ::vkGetPhysicalDeviceSurfacePresentModesKHR(physical_device, surface, &present_mode_count, present_modes.data());
+               err != VK_SUCCESS) {
+                return Error(fmt::format("Unable to acquire present modes: {}", vk_strerror(err)));
+            }
+
+            return detail::select_present_mode(present_modes, preferred_present_modes);
+        }
+    }// namespace
+
+    namespace detail {
+        auto select_present_mode(const std::span<const VkPresentModeKHR> supported_present_modes,
+                                 const std::span<const PresentMode> preferred_present_modes) noexcept -> VkPresentModeKHR {
+            for(const auto preferred_present_mode : preferred_present_modes) {
+                const auto vk_present_mode = to_vk_present_mode(preferred_present_mode);
+                if(std::find(supported_present_modes.begin(), supported_present_modes.end(), vk_present_mode) != supported_present_modes.end()) {
+                    return vk_present_mode;
+                }
+            }
+            return VK_PRESENT_MODE_FIFO_KHR;
+        }
+
+        auto clamp_image_count(const u32 image_count, const VkSurfaceCapabilitiesKHR& surface_capabilities) noexcept -> u32 {
+            const auto min_image_count = std::max(image_count, surface_capabilities.minImageCount);
+            if(surface_capabilities.maxImageCount == 0) {
+                return min_image_count;
+            }
+            return std::min(min_image_count, surface_capabilities.maxImageCount);
+        }
+
+        auto get_latency_wait_present_id(const u64 present_id, const u64 first_present_id, const u32 max_frame_latency) noexcept
+                -> u64 {
+            if(present_id <= max_frame_latency) {
+                return 0;
+            }
+
+            // The presents before the first present of the current swapchain were presented to a retired swapchain
+            const auto wait_present_id = present_id - max_frame_latency;
+            return wait_present_id >= first_present_id ? wait_present_id : 0;
+        }
+    }// namespace detail
+
+    /**
+     * This constructor creates the swapchain for the surface of the device's Vulkan context with the size of the
+     * context's window.
+     *
+     * @param device         The device to create the swapchain on
+     * @param surface_format The format of the swapchain images
+     * @param config         The configuration of the swapchain
+     * @author               Cedric Hammes
+     * @since                18/10/2026
+     */
+    Swapchain::Swapchain(const Device& device, VkSurfaceFormatKHR surface_format, SwapchainConfig config)
+        : _device {&device}
+        , _config {std::move(config)}
+        , _surface_format {surface_format}
+        , _present_mode {VK_PRESENT_MODE_FIFO_KHR}
+        , _extent {}
+        , _swapchain_handle {nullptr}
+        , _images {}
+        , _image_views {}
+        , _retired_swapchains {}
+        , _pending_presents {}
+        , _present_queue {&device.get_direct_queue()}
+        , _present_id {0}
+        , _first_present_id {1}
+        , _is_outdated {false}
+        , _latency_statistics {} {
+        _latency_statistics.is_photon_latency = device.is_present_wait_supported();
+
+        auto present_mode = find_present_mode(device, _config.preferred_present_modes);
+        if(present_mode.is_error()) {
+            throw std::runtime_error {fmt::format("Unable to create swapchain: {}", present_mode.get_error())};
+        }
+        _present_mode = *present_mode;
+
+        int width = 0;
+        int height = 0;
+        ::SDL_Vulkan_GetDrawableSize(**device.get_vulkan_context()->get_window(), &width, &height);
+        if(auto create_result = create({static_cast<uint32_t>(width), static_cast<uint32_t>(height)}); create_result.is_error()) {
+            throw std::runtime_error {create_result.get_error()};
+        }
+    }
+
+    Swapchain::Swapchain(Swapchain&& other) noexcept
+        : _device {other._device}
+        , _config {std::move(other._config)}
+        , _surface_format {other._surface_format}
+        , _present_mode {other._present_mode}
+        , _extent {other._extent}
+        , _swapchain_handle {other._swapchain_handle}
+        , _images {std::move(other._images)}
+        , _image_views {std::move(other._image_views)}
+        , _retired_swapchains {std::move(other._retired_swapchains)}
+        , _pending_presents {std::move(other._pending_presents)}
+        , _present_queue {other._present_queue}
+        , _present_id {other._present_id}
+        , _first_present_id {other._first_present_id}
+        , _is_outdated {other._is_outdated}
+        , _latency_statistics {other._latency_statistics} {
+        other._swapchain_handle = nullptr;
+        other._image_views.clear();
+        other._retired_swapchains.clear();
+    }
+
+    Swapchain::~Swapchain() noexcept {
+        for(auto& retired_swapchain : _retired_swapchains) {
+            if(const auto wait_result = retired_swapchain.retire_fence.wait(); wait_result.is_error()) {
+                EREBOS_LOG_WARN("Unable to wait for retired swapchain: {}", wait_result.get_error());
+            }
+            destroy_image_views(retired_swapchain.image_views);
+            ::vkDestroySwapchainKHR(**_device, retired_swapchain.swapchain, nullptr);
+        }
+        _retired_swapchains.clear();
+
+        destroy_image_views(_image_views);
+        if(_swapchain_handle != nullptr) {
+            ::vkDestroySwapchainKHR(**_device, _swapchain_handle, nullptr);
+            _swapchain_handle = nullptr;
+        }
+    }
+
+    auto Swapchain::operator=(Swapchain&& other) noexcept -> Swapchain& {
+        _device = other._device;
+        _config = std::move(other._config);
+        _surface_format = other._surface_format;
+        _present_mode = other._present_mode;
+        _extent = other._extent;
+        _swapchain_handle = other._swapchain_handle;
+        _images = std::move(other._images);
+        _image_views = std::move(other._image_views);
+        _retired_swapchains = std::move(other._retired_swapchains);
+        _pending_presents = std::move(other._pending_presents);
+        _present_queue = other._present_queue;
+        _present_id = other._present_id;
+        _first_present_id = other._first_present_id;
+        _is_outdated = other._is_outdated;
+        _latency_statistics = other._latency_statistics;
+        other._swapchain_handle = nullptr;
+        other._image_views.clear();
+        other._retired_swapchains.clear();
+        return *this;
+    }
+
+    /**
+     * This function acquires the next image of the swapchain and signals the specified semaphore when the image is
+     * ready. If the swapchain is out of date, the option is empty and the swapchain must be recreated.
+     *
+     * @param image_acquired_semaphore The semaphore to signal
+     * @return                         The index of the acquired image, nothing or an error
+     * @author                         Cedric Hammes
+     * @since                          18/10/2026
+     */
+    auto Swapchain::acquire_next_image(const sync::Semaphore& image_acquired_semaphore) noexcept -> Result<std::optional<u32>> {
+        if(_swapchain_handle == nullptr) {
+            return std::optional<u32> {};
+        }
+
+        EREBOS_PROFILE_SCOPE("vkAcquireNextImageKHR");
+        u32 image_index = 0;
+        const auto err = ::vkAcquireNextImageKHR(**_device,
+                                                 _swapchain_handle,
+                                                 std::numeric_limits<uint64_t>::max(),
+                                                 *image_acquired_semaphore,
+                                                 nullptr,
+                                                 &image_index);
+        switch(err) {
+            case VK_SUCCESS:
+                return std::optional {image_index};
+            case VK_SUBOPTIMAL_KHR:
+                // The image is acquired and the semaphore gets signaled, so the image must be presented before recreating
+                _is_outdated = true;
+                return std::optional {image_index};
+            case VK_ERROR_OUT_OF_DATE_KHR:
+                _is_outdated = true;
+                return std::optional<u32> {};
+            default:
+                return Error(fmt::format("Unable to acquire next swapchain image: {}", vk_strerror(err)));
+        }
+    }
+
+    /**
+     * This function queues the specified image for presentation after the semaphore was signaled. If the input
+     * time is specified, the latency from the input to the present is recorded in the latency statistics.
+     *
+     * @param queue          The queue to present on
+     * @param image_index    The index of the image to present
+     * @param wait_semaphore The semaphore signaled when the rendering is done
+     * @param input_time     The time of the oldest input handled in this frame
+     * @return               Void or an error
+     * @author               Cedric Hammes
+     * @since                18/10/2026
+     */
+    auto Swapchain::present(const Queue& queue,
+                            u32 image_index,
+                            const sync::Semaphore& wait_semaphore,
+                            std::optional<std::chrono::steady_clock::time_point> input_time) noexcept -> Result<void> {
+        const auto raw_wait_semaphore = *wait_semaphore;
+        _present_queue = &queue;
+        _present_id += 1;
+
+        VkPresentIdKHR present_id_info {};
+        present_id_info.sType = VK_STRUCTURE_TYPE_PRESENT_ID_KHR;
+        present_id_info.swapchainCount = 1;
+        present_id_info.pPresentIds = &_present_id;
+
+        VkPresentInfoKHR present_info {};
+        present_info.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
+        present_info.pNext = _device->is_present_wait_supported() ? &present_id_info : nullptr;
+        present_info.waitSemaphoreCount = 1;
+        present_info.pWaitSemaphores = &raw_wait_semaphore;
+        present_info.swapchainCount = 1;
+        present_info.pSwapchains = &_swapchain_handle;
+        present_info.pImageIndices = &image_index;
+        const auto err = [&]() noexcept {
+            EREBOS_PROFILE_SCOPE("vkQueuePresentKHR");
+            return ::vkQueuePresentKHR(*queue, &present_info);
+        }();
+        if(err == VK_ERROR_OUT_OF_DATE_KHR || err == VK_SUBOPTIMAL_KHR) {
+            _is_outdated = true;
+        }
+        else if(err != VK_SUCCESS) {
+            return Error(fmt::format("Unable to present swapchain image: {}", vk_strerror(err)));
+        }
+
+        // Without present wait, the latency is measured until the frame was queued for presentation
+        if(input_time.has_value()) {
+            if(_device->is_present_wait_supported()) {
+                _pending_presents.push_back({_present_id, *input_time});
+            }
+            else {
+                record_latency(std::chrono::steady_clock::now() - *input_time);
+            }
+        }
+        collect_completed_presents();
+        return {};
+    }
+
+    /**
+     * This function waits until no more than the maximum frame latency presents are queued. This should be called
+     * before the input of the next frame is sampled, so the input is as fresh as possible when the frame gets
+     * displayed. Without present wait, this function only collects the completed presents.
+     *
+     * @param timeout The maximum time to wait
+     * @return        Void or an error
+     * @author        Cedric Hammes
+     * @since         18/10/2026
+     */
+    auto Swapchain::wait_for_frame_latency(std::chrono::nanoseconds timeout) noexcept -> Result<void> {
+        const auto wait_present_id = detail::get_latency_wait_present_id(_present_id, _first_present_id, _config.max_frame_latency);
+        if(_device->is_present_wait_supported() && _swapchain_handle != nullptr && wait_present_id != 0) {
+            const auto err = ::vkWaitForPresentKHR(**_device, _swapchain_handle, wait_present_id, static_cast<uint64_t>(timeout.count()));
+            if(err == VK_ERROR_OUT_OF_DATE_KHR || err == VK_SUBOPTIMAL_KHR) {
+                _is_outdated = true;
+            }
+            else if(err != VK_SUCCESS && err != VK_TIMEOUT) {
+                return Error(fmt::format("Unable to wait for present {}: {}", wait_present_id, vk_strerror(err)));
+            }
+        }
+        collect_completed_presents();
+        return {};
+    }
+
+    /**
+     * This function recreates the swapchain with the specified size. The old swapchain is retired and destroyed
+     * later, so this doesn't wait for the device. If the size is zero (e.g. the window is minimized), the swapchain
+     * stays out of date.
+     *
+     * @param extent The new size of the swapchain images
+     * @return       Void or an error
+     * @author       Cedric Hammes
+     * @since        18/10/2026
+     */
+    auto Swapchain::recreate(VkExtent2D extent) noexcept -> Result<void> {
+        if(extent.width == 0 || extent.height == 0) {
+            _is_outdated = true;
+            return {};
+        }
+        return create(extent);
+    }
+
+    auto Swapchain::create(VkExtent2D extent) noexcept -> Result<void> {
+        const auto surface = _device->get_vulkan_context()->get_surface();
+        VkSurfaceCapabilitiesKHR surface_capabilities {};
+        if(const auto err = ::vkGetPhysicalDeviceSurfaceCapabilitiesKHR(_device->get_physical_device(), surface, &surface_capabilities);
+           err != VK_SUCCESS) {
+            return Error(fmt::format("Unable to acquire surface capabilities: {}", vk_strerror(err)));
+        }
+
+        // Use the size of the surface if the surface defines it, otherwise clamp the requested size into the limits
+        if(surface_capabilities.currentExtent.width != std::numeric_limits<uint32_t>::max()) {
+            extent = surface_capabilities.currentExtent;
+        }
+        else {
+            extent.width = std::clamp(extent.width, surface_capabilities.minImageExtent.width, surface_capabilities.maxImageExtent.width);
+            extent.height = std::clamp(extent.height, surface_capabilities.minImageExtent.height, surface_capabilities.maxImageExtent.height);
+        }
+
+        if(extent.width == 0 || extent.height == 0) {
+            _is_outdated = true;
+            return {};
+        }
+
+        const auto image_count = detail::clamp_image_count(_config.image_count, surface_capabilities);
+
+        VkSwapchainCreateInfoKHR swapchain_create_info {};
+        swapchain_create_info.sType = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR;
+        swapchain_create_info.surface = surface;
+        swapchain_create_info.minImageCount = image_count;
+        swapchain_create_info.imageFormat = _surface_format.format;
+        swapchain_create_info.imageColorSpace = _surface_format.colorSpace;
+        swapchain_create_info.imageExtent = extent;
+        swapchain_create_info.imageArrayLayers = 1;
+        swapchain_create_info.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+        swapchain_create_info.imageSharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        swapchain_create_info.preTransform = surface_capabilities.currentTransform;
+        swapchain_create_info.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
+        swapchain_create_info.presentMode = _present_mode;
+        swapchain_create_info.clipped = VK_TRUE;
+        swapchain_create_info.oldSwapchain = _swapchain_handle;
+
+        EREBOS_TRY_ASSIGN(auto retire_fence, try_construct<sync::Fence>(*_device, false, "Swapchain Retire Fence"));
+        VkSwapchainKHR swapchain_handle = nullptr;
+        if(const auto err = ::vkCreateSwapchainKHR(**_device, &swapchain_create_info, nullptr, &swapchain_handle); err != VK_SUCCESS) {
+            return Error(fmt::format("Unable to create swapchain: {}", vk_strerror(err)));
+        }
+
+        // Retire the old swapchain. The empty submission signals the fence after all work queued before, including the
+        // presents of the old swapchain, is complete. Without the fence, the device has to be idle before destroying it.
+        if(_swapchain_handle != nullptr) {
+            const auto last_present_id = _present_id >= _first_present_id ? _present_id : 0;
+            if(const auto err = ::vkQueueSubmit(**_present_queue, 0, nullptr, *retire_fence); err == VK_SUCCESS) {
+                _retired_swapchains.push_back({_swapchain_handle, std::move(_image_views), std::move(retire_fence), last_present_id});
+            }
+            else {
+                EREBOS_LOG_WARN("Unable to queue fence of retired swapchain, waiting for device: {}", vk_strerror(err));
+                ::vkDeviceWaitIdle(**_device);
+                destroy_image_views(_image_views);
+                ::vkDestroySwapchainKHR(**_device, _swapchain_handle, nullptr);
+            }
+            _image_views.clear();
+        }
+        _swapchain_handle = swapchain_handle;
+        _first_present_id = _present_id + 1;
+        _extent = extent;
+        _is_outdated = false;
+        _pending_presents.clear();
+
+        // Acquire images of the swapchain and create views for them
+        uint32_t swapchain_image_count = 0;
+        if(const auto err = ::vkGetSwapchainImagesKHR(**_device, _swapchain_handle, &swapchain_image_count, nullptr); err != VK_SUCCESS) {
+            return Error(fmt::format("Unable to acquire count of swapchain images: {}", vk_strerror(err)));
+        }
+
+        _images.resize(swapchain_image_count);
+        if(const auto err = ::vkGetSwapchainImagesKHR(**_device, _swapchain_handle, &swapchain_image_count, _images.data());
+           err != VK_SUCCESS) {
+            return Error(fmt::format("Unable to acquire swapchain images: {}", vk_strerror(err)));
+        }
+
+        for(const auto image : _images) {
+            VkImageViewCreateInfo image_view_create_info {};
+            image_view_create_info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+            image_view_create_info.image = image;
+            image_view_create_info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+            image_view_create_info.format = _surface_format.format;
+            image_view_create_info.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            image_view_create_info.subresourceRange.levelCount = 1;
+            image_view_create_info.subresourceRange.layerCount = 1;
+
+            VkImageView image_view = nullptr;
+            if(const auto err = ::vkCreateImageView(**_device, &image_view_create_info, nullptr, &image_view); err != VK_SUCCESS) {
+                return Error(fmt::format("Unable to create swapchain image view: {}", vk_strerror(err)));
+            }
+            _image_views.push_back(image_view);
+        }
+
+        EREBOS_LOG_INFO("Created swapchain with {} images ({}x{}, present mode {})",
+                        _images.size(),
+                        _extent.width,
+                        _extent.height,
+                        static_cast<uint32_t>(_present_mode));
+        return {};
+    }
+
+    auto Swapchain::collect_completed_presents() noexcept -> void {
+        // Record the latency of all presents, which were displayed since the last collection
+        if(_device->is_present_wait_supported()) {
+            while(!_pending_presents.empty()) {
+                const auto& pending_present = _pending_presents.front();
+                if(::vkWaitForPresentKHR(**_device, _swapchain_handle, pending_present.present_id, 0) != VK_SUCCESS) {
+                    break;
+                }
+
+                record_latency(std::chrono::steady_clock::now() - pending_present.input_time);
+                _pending_presents.erase(_pending_presents.begin());
+            }
+        }
+
+        // Destroy all retired swapchains, which can't be in use anymore
+        std::erase_if(_retired_swapchains, [this](auto& retired_swapchain) noexcept -> bool {
+            if(!is_retired_swapchain_unused(retired_swapchain)) {
+                return false;
+            }
+
+            destroy_image_views(retired_swapchain.image_views);
+            ::vkDestroySwapchainKHR(**_device, retired_swapchain.swapchain, nullptr);
+            return true;
+        });
+    }
+
+    auto Swapchain::is_retired_swapchain_unused(const RetiredSwapchain& retired_swapchain) const noexcept -> bool {
+        // Keep the swapchain until the next collection if the status of the fence is unknown
+        const auto is_signaled = retired_swapchain.retire_fence.is_signaled();
+        if(is_signaled.is_error() || !*is_signaled) {
+            return false;
+        }
+
+        // The presentation engine can read the last presented image after the queue is done, present wait tells when
+        // the present is complete. An out of date swapchain returns early, its images aren't presented anymore.
+        if(_device->is_present_wait_supported() && retired_swapchain.last_present_id != 0) {
+            const auto err = ::vkWaitForPresentKHR(**_device, retired_swapchain.swapchain, retired_swapchain.last_present_id, 0);
+            return err != VK_TIMEOUT && err != VK_NOT_READY;
+        }
+        return true;
+    }
+
+    auto Swapchain::record_latency(std::chrono::steady_clock::duration latency) noexcept -> void {
+        const auto latency_micros = std::chrono::duration_cast<std::chrono::microseconds>(latency);
+        auto& statistics = _latency_statistics;
+        statistics.last = latency_micros;
+        statistics.max = std::max(statistics.max, latency_micros);
+        statistics.average = (statistics.average * statistics.sample_count + latency_micros) / (statistics.sample_count + 1);
+        statistics.sample_count += 1;
+    }
+
+    auto Swapchain::destroy_image_views(std::vector<VkImageView>& image_views) const noexcept -> void {
+        for(const auto image_view : image_views) {
+            ::vkDestroyImageView(**_device, image_view, nullptr);
+        }
+        image_views.clear();
+    }
+}// namespace erebos::render::vulkan
@@ -0,0 +1,373 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include "erebos/unicode.hpp"
+#include "erebos/platform/cpu.hpp"
+#include <bit>
+
+#if defined(ARCH_X86)
+#include <immintrin.h>
+#elif defined(ARCH_ARM64)
+#include <arm_neon.h>
+#endif
+
+namespace erebos::unicode::detail {
+    namespace {
+        template<typename CHAR_OUT>
+        using FromUTF8Function = usize (*)(const char* value, usize length, CHAR_OUT* out) noexcept;
+
+        template<typename CHAR_IN>
+        using ToUTF8Function = usize (*)(const CHAR_IN* value, usize length, char* out) noexcept;
+
+        // Converts the non-ASCII code points at the current position, so the SIMD kernels continue with the next block
+        // at the next ASCII character
+        template<typename CHAR_OUT, typename CHAR_IN>
+        inline auto convert_non_ascii_run(const CHAR_IN*& current, const CHAR_IN* end, CHAR_OUT*& out) noexcept -> void {
+            do {
+                convert_code_point(current, end, out);
+            } while(current != end && static_cast<std::make_unsigned_t<CHAR_IN>>(*current) >= 0x80);
+        }
+
+        template<typename CHAR_OUT>
+        auto convert_from_utf8_scalar(const char* value, const usize length, CHAR_OUT* out) noexcept -> usize {
+            return convert_buffer_scalar(value, length, out);
+        }
+
+        template<typename CHAR_IN>
+        auto convert_to_utf8_scalar(const CHAR_IN* value, const usize length, char* out) noexcept -> usize {
+            return convert_buffer_scalar(value, length, out);
+        }
+
+#if defined(ARCH_X86)
+        // The kernels always store a whole block, but only advance the output by the ASCII prefix of the block. This
+        // is safe because the output is sized for the maximum converted length of the remaining input.
+        template<typename CHAR_OUT>
+        EREBOS_TARGET_FEATURES("sse4.1")
+        auto convert_from_utf8_sse4_1(const char* value, const usize length, CHAR_OUT* out) noexcept -> usize {
+            constexpr usize block_size = 16;
+            const auto* current = value;
+            const auto* end = value + length;
+            auto* out_begin = out;
+            while(static_cast<usize>(end - current) >= block_size) {
+                const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current));
+                auto* block_out = reinterpret_cast<__m128i*>(out);
+                if constexpr(sizeof(CHAR_OUT) == 2) {
+                    _mm_storeu_si128(block_out + 0, _mm_cvtepu8_epi16(block));
+                    _mm_storeu_si128(block_out + 1, _mm_cvtepu8_epi16(_mm_srli_si128(block, 8)));
+                }
+                else {
+                    _mm_storeu_si128(block_out + 0, _mm_cvtepu8_epi32(block));
+                    _mm_storeu_si128(block_out + 1, _mm_cvtepu8_epi32(_mm_srli_si128(block, 4)));
+                    _mm_storeu_si128(block_out + 2, _mm_cvtepu8_epi32(_mm_srli_si128(block, 8)));
+                    _mm_storeu_si128(block_out + 3, _mm_cvtepu8_epi32(_mm_srli_si128(block, 12)));
+                }
+
+                const auto non_ascii_mask = static_cast<u32>(_mm_movemask_epi8(block));
+                if(non_ascii_mask == 0) {
+                    current += block_size;
+                    out += block_size;
+                    continue;
+                }
+                const auto ascii_length = std::countr_zero(non_ascii_mask);
+                current += ascii_length;
+                out += ascii_length;
+                convert_non_ascii_run(current, end, out);
+            }
+            return static_cast<usize>(out - out_begin) + convert_buffer_scalar(current, static_cast<usize>(end - current), out);
+        }
+
+        template<typename CHAR_OUT>
+        EREBOS_TARGET_FEATURES("avx2")
+        auto convert_from_utf8_avx2(const char* value, const usize length, CHAR_OUT* out) noexcept -> usize {
+            constexpr usize block_size = 32;
+            const auto* current = value;
+            const auto* end = value + length;
+            auto* out_begin = out;
+            while(static_cast<usize>(end - current) >= block_size) {
+                const auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(current));
+                const auto low_block = _mm256_castsi256_si128(block);
+                const auto high_block = _mm256_extracti128_si256(block, 1);
+                auto* block_out = reinterpret_cast<__m256i*>(out);
+                if constexpr(sizeof(CHAR_OUT) == 2) {
+                    _mm256_storeu_si256(block_out + 0, _mm256_cvtepu8_epi16(low_block));
+                    _mm256_storeu_si256(block_out + 1, _mm256_cvtepu8_epi16(high_block));
+                }
+                else {
+                    _mm256_storeu_si256(block_out + 0, _mm256_cvtepu8_epi32(low_block));
+                    _mm256_storeu_si256(block_out + 1, _mm256_cvtepu8_epi32(_mm_srli_si128(low_block, 8)));
+                    _mm256_storeu_si256(block_out + 2, _mm256_cvtepu8_epi32(high_block));
+                    _mm256_storeu_si256(block_out + 3, _mm256_cvtepu8_epi32(_mm_srli_si128(high_block, 8)));
+                }
+
+                const auto non_ascii_mask = static_cast<u32>(_mm256_movemask_epi8(block));
+                if(non_ascii_mask == 0) {
+                    current += block_size;
+                    out += block_size;
+                    continue;
+                }
+                const auto ascii_length = std::countr_zero(non_ascii_mask);
+                current += ascii_length;
+                out += ascii_length;
+                convert_non_ascii_run(current, end, out);
+            }
+            return static_cast<usize>(out - out_begin) + convert_buffer_scalar(current, static_cast<usize>(end - current), out);
+        }
+
+        // The units are clamped to 0xFF before they are packed with unsigned saturation, so every non-ASCII unit keeps
+        // the high bit of its byte (the packs treat the units as signed, so large units would saturate to zero otherwise)
+        template<typename CHAR_IN>
+        EREBOS_TARGET_FEATURES("sse4.1")
+        auto convert_to_utf8_sse4_1(const CHAR_IN* value, const usize length, char* out) noexcept -> usize {
+            constexpr usize block_size = 16;
+            const auto* current = value;
+            const auto* end = value + length;
+            auto* out_begin = out;
+            while(static_cast<usize>(end - current) >= block_size) {
+                const auto* block_in = reinterpret_cast<const __m128i*>(current);
+                __m128i block;
+                if constexpr(sizeof(CHAR_IN) == 2) {
+                    const auto max_unit = _mm_set1_epi16(0xFF);
+                    block = _mm_packus_epi16(_mm_min_epu16(_mm_loadu_si128(block_in + 0), max_unit),
+                                             _mm_min_epu16(_mm_loadu_si128(block_in + 1), max_unit));
+                }
+                else {
+                    const auto max_unit = _mm_set1_epi32(0xFF);
+                    const auto first_half = _mm_packus_epi32(_mm_min_epu32(_mm_loadu_si128(block_in + 0), max_unit),
+                                                             _mm_min_epu32(_mm_loadu_si128(block_in + 1), max_unit));
+                    const auto second_half = _mm_packus_epi32(_mm_min_epu32(_mm_loadu_si128(block_in + 2), max_unit),
+                                                              _mm_min_epu32(_mm_loadu_si128(block_in + 3), max_unit));
+                    block = _mm_packus_epi16(first_half, second_half);
+                }
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out), block);
+
+                const auto non_ascii_mask = static_cast<u32>(_mm_movemask_epi8(block));
+                if(non_ascii_mask == 0) {
+                    current += block_size;
+                    out += block_size;
+                    continue;
+                }
+                const auto ascii_length = std::countr_zero(non_ascii_mask);
+                current += ascii_length;
+                out += ascii_length;
+                convert_non_ascii_run(current, end, out);
+            }
+            return static_cast<usize>(out - out_begin) + convert_buffer_scalar(current, static_cast<usize>(end - current), out);
+        }
+
+        // The packs of AVX2 operate on each 128-bit lane, so the packed blocks are permuted back into the input order
+        template<typename CHAR_IN>
+        EREBOS_TARGET_FEATURES("avx2")
+        auto convert_to_utf8_avx2(const CHAR_IN* value, const usize length, char* out) noexcept -> usize {
+            constexpr usize block_size = 32;
+            const auto* current = value;
+            const auto* end = value + length;
+            auto* out_begin = out;
+            while(static_cast<usize>(end - current) >= block_size) {
+                const auto* block_in = reinterpret_cast<const __m256i*>(current);
+                __m256i block;
+                if constexpr(sizeof(CHAR_IN) == 2) {
+                    const auto max_unit = _mm256_set1_epi16(0xFF);
+                    const auto packed = _mm256_packus_epi16(_mm256_min_epu16(_mm256_loadu_si256(block_in + 0), max_unit),
+                                                            _mm256_min_epu16(_mm256_loadu_si256(block_in + 1), max_unit));
+                    block = _mm256_permute4x64_epi64(packed, 0b11'01'10'00);
+                }
+                else {
+                    const auto max_unit = _mm256_set1_epi32(0xFF);
+                    const auto first_half = _mm256_packus_epi32(_mm256_min_epu32(_mm256_loadu_si256(block_in + 0), max_unit),
+                                                                _mm256_min_epu32(_mm256_loadu_si256(block_in + 1), max_unit));
+                    const auto second_half = _mm256_packus_epi32(_mm256_min_epu32(_mm256_loadu_si256(block_in + 2), max_unit),
+                                                                 _mm256_min_epu32(_mm256_loadu_si256(block_in + 3), max_unit));
+                    block = _mm256_permutevar8x32_epi32(_mm256_packus_epi16(first_half, second_half),
+                                                        _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+                }
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), block);
+
+                const auto non_ascii_mask = static_cast<u32>(_mm256_movemask_epi8(block));
+                if(non_ascii_mask == 0) {
+                    current += block_size;
+                    out += block_size;
+                    continue;
+                }
+                const auto ascii_length = std::countr_zero(non_ascii_mask);
+                current += ascii_length;
+                out += ascii_length;
+                convert_non_ascii_run(current, end, out);
+            }
+            return static_cast<usize>(out - out_begin) + convert_buffer_scalar(current, static_cast<usize>(end - current), out);
+        }
+#elif defined(ARCH_ARM64)
+        // NEON has no movemask, so blocks with non-ASCII characters are converted with the scalar code until the end of
+        // the block
+        template<typename CHAR_OUT>
+        auto convert_from_utf8_neon(const char* value, const usize length, CHAR_OUT* out) noexcept -> usize {
+            constexpr usize block_size = 16;
+            const auto* current = value;
+            const auto* end = value + length;
+            auto* out_begin = out;
+            while(static_cast<usize>(end - current) >= block_size) {
+                const auto block = vld1q_u8(reinterpret_cast<const u8*>(current));
+                if(vmaxvq_u8(block) >= 0x80) {
+                    const auto* block_end = current + block_size;
+                    while(current < block_end) {
+                        convert_code_point(current, end, out);
+                    }
+                    continue;
+                }
+
+                const auto low_block = vmovl_u8(vget_low_u8(block));
+                const auto high_block = vmovl_high_u8(block);
+                if constexpr(sizeof(CHAR_OUT) == 2) {
+                    auto* block_out = reinterpret_cast<u16*>(out);
+                    vst1q_u16(block_out + 0, low_block);
+                    vst1q_u16(block_out + 8, high_block);
+                }
+                else {
+                    auto* block_out = reinterpret_cast<u32*>(out);
+                    vst1q_u32(block_out + 0, vmovl_u16(vget_low_u16(low_block)));
+                    vst1q_u32(block_out + 4, vmovl_high_u16(low_block));
+                    vst1q_u32(block_out + 8, vmovl_u16(vget_low_u16(high_block)));
+                    vst1q_u32(block_out + 12, vmovl_high_u16(high_block));
+                }
+                current += block_size;
+                out += block_size;
+            }
+            return static_cast<usize>(out - out_begin) + convert_buffer_scalar(current, static_cast<usize>(end - current), out);
+        }
+
+        template<typename CHAR_IN>
+        auto convert_to_utf8_neon(const CHAR_IN* value, const usize length, char* out) noexcept -> usize {
+            constexpr usize block_size = 16;
+            const auto* current = value;
+            const auto* end = value + length;
+            auto* out_begin = out;
+            while(static_cast<usize>(end - current) >= block_size) {
+                uint8x16_t block;
+                bool is_ascii;
+                if constexpr(sizeof(CHAR_IN) == 2) {
+                    const auto* block_in = reinterpret_cast<const u16*>(current);
+                    const auto low_block = vld1q_u16(block_in + 0);
+                    const auto high_block = vld1q_u16(block_in + 8);
+                    is_ascii = vmaxvq_u16(vorrq_u16(low_block, high_block)) < 0x80;
+                    block = vcombine_u8(vmovn_u16(low_block), vmovn_u16(high_block));
+                }
+                else {
+                    const auto* block_in = reinterpret_cast<const u32*>(current);
+                    const auto block0 = vld1q_u32(block_in + 0);
+                    const auto block1 = vld1q_u32(block_in + 4);
+                    const auto block2 = vld1q_u32(block_in + 8);
+                    const auto block3 = vld1q_u32(block_in + 12);
+                    is_ascii = vmaxvq_u32(vorrq_u32(vorrq_u32(block0, block1), vorrq_u32(block2, block3))) < 0x80;
+                    block = vcombine_u8(vmovn_u16(vcombine_u16(vmovn_u32(block0), vmovn_u32(block1))),
+                                        vmovn_u16(vcombine_u16(vmovn_u32(block2), vmovn_u32(block3))));
+                }
+
+                if(!is_ascii) {
+                    const auto* block_end = current + block_size;
+                    while(current < block_end) {
+                        convert_code_point(current, end, out);
+                    }
+                    continue;
+                }
+                vst1q_u8(reinterpret_cast<u8*>(out), block);
+                current += block_size;
+                out += block_size;
+            }
+            return static_cast<usize>(out - out_begin) + convert_buffer_scalar(current, static_cast<usize>(end - current), out);
+        }
+#endif
+
+        template<typename CHAR_OUT>
+        [[nodiscard]] auto select_from_utf8_function() noexcept -> FromUTF8Function<CHAR_OUT> {
+            [[maybe_unused]] const auto& cpu_features = platform::get_cpu_features();
+#if defined(ARCH_X86)
+            if(cpu_features.has_avx2) {
+                return &convert_from_utf8_avx2<CHAR_OUT>;
+            }
+            if(cpu_features.has_sse4_1) {
+                return &convert_from_utf8_sse4_1<CHAR_OUT>;
+            }
+#elif defined(ARCH_ARM64)
+            if(cpu_features.has_neon) {
+                return &convert_from_utf8_neon<CHAR_OUT>;
+            }
+#endif
+            return &convert_from_utf8_scalar<CHAR_OUT>;
+        }
+
+        template<typename CHAR_IN>
+        [[nodiscard]] auto select_to_utf8_function() noexcept -> ToUTF8Function<CHAR_IN> {
+            [[maybe_unused]] const auto& cpu_features = platform::get_cpu_features();
+#if defined(ARCH_X86)
+            if(cpu_features.has_avx2) {
+                return &convert_to_utf8_avx2<CHAR_IN>;
+            }
+            if(cpu_features.has_sse4_1) {
+                return &convert_to_utf8_sse4_1<CHAR_IN>;
+            }
+#elif defined(ARCH_ARM64)
+            if(cpu_features.has_neon) {
+                return &convert_to_utf8_neon<CHAR_IN>;
+            }
+#endif
+            return &convert_to_utf8_scalar<CHAR_IN>;
+        }
+    }// namespace
+
+    /**
+     * This function converts UTF-8 into UTF-16 or UTF-32 like the scalar conversion, but uses the SIMD kernel
+     * selected for the CPU to convert runs of ASCII characters.
+     *
+     * @tparam CHAR_OUT The type of the output units
+     * @param value     The input units
+     * @param length    The count of input units
+     * @param out       The output buffer
+     * @return          The count of written output units
+     * @author          Cedric Hammes
+     * @since           18/10/2026
+     */
+    template<WideChar CHAR_OUT>
+    auto convert_from_utf8(const char* value, const usize length, CHAR_OUT* out) noexcept -> usize {
+        static const auto function = select_from_utf8_function<CHAR_OUT>();
+        return function(value, length, out);
+    }
+
+    /**
+     * This function converts UTF-16 or UTF-32 into UTF-8 like the scalar conversion, but uses the SIMD kernel
+     * selected for the CPU to convert runs of ASCII characters.
+     *
+     * @tparam CHAR_IN The type of the input units
+     * @param value    The input units
+     * @param length   The count of input units
+     * @param out      The output buffer
+     * @return         The count of written output units
+     * @author         Cedric Hammes
+     * @since          18/10/2026
+     */
+    template<WideChar CHAR_IN>
+    auto convert_to_utf8(const CHAR_IN* value, const usize length, char* out) noexcept -> usize {
+        static const auto function = select_to_utf8_function<CHAR_IN>();
+        return function(value, length, out);
+    }
+
+    template auto convert_from_utf8<char16_t>(const char*, usize, char16_t*) noexcept -> usize;
+    template auto convert_from_utf8<char32_t>(const char*, usize, char32_t*) noexcept -> usize;
+    template auto convert_from_utf8<wchar_t>(const char*, usize, wchar_t*) noexcept -> usize;
+    template auto convert_to_utf8<char16_t>(const char16_t*, usize, char*) noexcept -> usize;
+    template auto convert_to_utf8<char32_t>(const char32_t*, usize, char*) noexcept -> usize;
+    template auto convert_to_utf8<wchar_t>(const wchar_t*, usize, char*) noexcept -> usize;
+}// namespace erebos::unicode::detail
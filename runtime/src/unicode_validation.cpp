@@ -0,0 +1,458 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include "erebos/platform/cpu.hpp"
+#include "erebos/unicode.hpp"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#if defined(ARCH_X86)
+#include <immintrin.h>
+#elif defined(ARCH_ARM64)
+#include <arm_neon.h>
+#endif
+
+// The SIMD validation is the lookup algorithm of simdjson (John Keiser, Daniel Lemire - Validating UTF-8 In Less Than
+// One Instruction Per Byte). The high and low nibble of each byte and the high nibble of the next byte are looked up
+// in three tables, the bitwise AND of the lookups is non-zero for every invalid pair of bytes. The third and fourth
+// bytes of a sequence are checked separately, because they can't be detected by looking at a pair of bytes.
+namespace erebos::unicode {
+    namespace {
+        using FindInvalidBlockFunction = usize (*)(const u8* value, usize length) noexcept;
+        using CountCodePointsFunction = usize (*)(const u8* value, usize length) noexcept;
+
+        constexpr u8 TOO_SHORT = 1 << 0;     // 11______ 0_______ or 11______ 11______
+        constexpr u8 TOO_LONG = 1 << 1;      // 0_______ 10______
+        constexpr u8 OVERLONG_3 = 1 << 2;    // 11100000 100_____
+        constexpr u8 TOO_LARGE = 1 << 3;     // 11110100 1001____ and larger
+        constexpr u8 SURROGATE = 1 << 4;     // 11101101 101_____
+        constexpr u8 OVERLONG_2 = 1 << 5;    // 1100000_ 10______
+        constexpr u8 TOO_LARGE_1000 = 1 << 6;// 11110101 1000____ and larger
+        constexpr u8 OVERLONG_4 = 1 << 6;    // 11110000 1000____
+        constexpr u8 TWO_CONTINUATIONS = 1 << 7;// 10______ 10______
+        constexpr u8 CARRY = TOO_SHORT | TOO_LONG | TWO_CONTINUATIONS;
+
+        // Indexed by the high nibble of the first byte
+        constexpr u8 BYTE_1_HIGH_TABLE[16] = {
+            TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,// 0_______
+            TWO_CONTINUATIONS, TWO_CONTINUATIONS, TWO_CONTINUATIONS, TWO_CONTINUATIONS,    // 10______
+            TOO_SHORT | OVERLONG_2,                                                        // 1100____
+            TOO_SHORT,                                                                     // 1101____
+            TOO_SHORT | OVERLONG_3 | SURROGATE,                                            // 1110____
+            TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4                            // 1111____
+        };
+
+        // Indexed by the low nibble of the first byte
+        constexpr u8 BYTE_1_LOW_TABLE[16] = {
+            CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,      // ____0000
+            CARRY | OVERLONG_2,                                // ____0001
+            CARRY,                                             // ____0010
+            CARRY,                                             // ____0011
+            CARRY | TOO_LARGE,                                 // ____0100
+            CARRY | TOO_LARGE | TOO_LARGE_1000,                // ____0101
+            CARRY | TOO_LARGE | TOO_LARGE_1000,                // ____0110
+            CARRY | TOO_LARGE | TOO_LARGE_1000,                // ____0111
+            CARRY | TOO_LARGE | TOO_LARGE_1000,                // ____1000
+            CARRY | TOO_LARGE | TOO_LARGE_1000,                // ____1001
+            CARRY | TOO_LARGE | TOO_LARGE_1000,                // ____1010
+            CARRY | TOO_LARGE | TOO_LARGE_1000,                // ____1011
+            CARRY | TOO_LARGE | TOO_LARGE_1000,                // ____1100
+            CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,    // ____1101
+            CARRY | TOO_LARGE | TOO_LARGE_1000,                // ____1110
+            CARRY | TOO_LARGE | TOO_LARGE_1000                 // ____1111
+        };
+
+        // Indexed by the high nibble of the second byte
+        constexpr u8 BYTE_2_HIGH_TABLE[16] = {
+            TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,// 0_______
+            TOO_LONG | OVERLONG_2 | TWO_CONTINUATIONS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,  // 1000____
+            TOO_LONG | OVERLONG_2 | TWO_CONTINUATIONS | OVERLONG_3 | TOO_LARGE,                    // 1001____
+            TOO_LONG | OVERLONG_2 | TWO_CONTINUATIONS | SURROGATE | TOO_LARGE,                     // 1010____
+            TOO_LONG | OVERLONG_2 | TWO_CONTINUATIONS | SURROGATE | TOO_LARGE,                     // 1011____
+            TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT                                             // 11______
+        };
+
+        // A block ending with one of these bytes at the last three positions ends with an incomplete sequence
+        constexpr u8 INCOMPLETE_THRESHOLD_2 = 0xF0 - 1;
+        constexpr u8 INCOMPLETE_THRESHOLD_1 = 0xE0 - 1;
+        constexpr u8 INCOMPLETE_THRESHOLD_0 = 0xC0 - 1;
+
+        auto find_invalid_block_scalar(const u8* value, const usize length) noexcept -> usize {
+            const auto* current = value;
+            const auto* end = value + length;
+            while(current != end) {
+                const auto* sequence = current;
+                const auto code_point = detail::UTFTraits<u8>::decode(current, end);
+                if(code_point == detail::illegal || code_point == detail::incomplete) {
+                    return static_cast<usize>(sequence - value);
+                }
+            }
+            return length;
+        }
+
+        auto count_code_points_scalar(const u8* value, const usize length) noexcept -> usize {
+            usize count = 0;
+            for(usize i = 0; i < length; ++i) {
+                count += static_cast<usize>(!detail::UTFTraits<u8>::is_trail(value[i]));
+            }
+            return count;
+        }
+
+        // The accumulators of the counting kernels are 8-bit, so they are summed up before they can overflow
+        constexpr usize MAX_ACCUMULATED_BLOCKS = std::numeric_limits<u8>::max();
+
+#if defined(ARCH_X86)
+        template<typename T>
+        [[nodiscard]] inline auto load_table(const u8 (&table)[16]) noexcept -> T {
+            T value;
+            std::memcpy(&value, table, sizeof(table));
+            return value;
+        }
+
+        EREBOS_TARGET_FEATURES("sse4.1")
+        inline auto get_block_errors_sse4_1(const __m128i input, const __m128i prev_input) noexcept -> __m128i {
+            const auto low_nibble_mask = _mm_set1_epi8(0x0F);
+            const auto prev1 = _mm_alignr_epi8(input, prev_input, 15);
+            const auto byte_1_high = _mm_shuffle_epi8(load_table<__m128i>(BYTE_1_HIGH_TABLE),
+                                                      _mm_and_si128(_mm_srli_epi16(prev1, 4), low_nibble_mask));
+            const auto byte_1_low = _mm_shuffle_epi8(load_table<__m128i>(BYTE_1_LOW_TABLE), _mm_and_si128(prev1, low_nibble_mask));
+            const auto byte_2_high = _mm_shuffle_epi8(load_table<__m128i>(BYTE_2_HIGH_TABLE),
+                                                      _mm_and_si128(_mm_srli_epi16(input, 4), low_nibble_mask));
+            const auto special_cases = _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+
+            // Only bytes after a three or four byte lead are above the thresholds after the saturating subtraction
+            const auto prev2 = _mm_alignr_epi8(input, prev_input, 14);
+            const auto prev3 = _mm_alignr_epi8(input, prev_input, 13);
+            const auto is_third_byte = _mm_subs_epu8(prev2, _mm_set1_epi8(0xE0 - 0x80));
+            const auto is_fourth_byte = _mm_subs_epu8(prev3, _mm_set1_epi8(0xF0 - 0x80));
+            const auto must_be_continuation = _mm_and_si128(_mm_or_si128(is_third_byte, is_fourth_byte), _mm_set1_epi8(static_cast<char>(0x80)));
+            return _mm_xor_si128(must_be_continuation, special_cases);
+        }
+
+        EREBOS_TARGET_FEATURES("sse4.1")
+        inline auto has_block_errors_sse4_1(const __m128i input, __m128i& prev_input, __m128i& prev_incomplete) noexcept -> bool {
+            __m128i errors;
+            if(_mm_movemask_epi8(input) == 0) {
+                // An ASCII block can only complete the sequence at the end of the previous block wrongly
+                errors = prev_incomplete;
+                prev_incomplete = _mm_setzero_si128();
+            }
+            else {
+                errors = get_block_errors_sse4_1(input, prev_input);
+                const auto max_value = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                                     static_cast<char>(INCOMPLETE_THRESHOLD_2),
+                                                     static_cast<char>(INCOMPLETE_THRESHOLD_1),
+                                                     static_cast<char>(INCOMPLETE_THRESHOLD_0));
+                prev_incomplete = _mm_subs_epu8(input, max_value);
+            }
+            prev_input = input;
+            return _mm_testz_si128(errors, errors) == 0;
+        }
+
+        EREBOS_TARGET_FEATURES("sse4.1")
+        auto find_invalid_block_sse4_1(const u8* value, const usize length) noexcept -> usize {
+            constexpr usize block_size = 16;
+            auto prev_input = _mm_setzero_si128();
+            auto prev_incomplete = _mm_setzero_si128();
+            usize offset = 0;
+            for(; offset + block_size <= length; offset += block_size) {
+                const auto input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(value + offset));
+                if(has_block_errors_sse4_1(input, prev_input, prev_incomplete)) {
+                    return offset;
+                }
+            }
+
+            // The rest is padded with ASCII, so an incomplete sequence at the end is followed by an ASCII byte
+            if(offset < length) {
+                u8 rest[block_size] {};
+                std::memcpy(rest, value + offset, length - offset);
+                const auto input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rest));
+                return has_block_errors_sse4_1(input, prev_input, prev_incomplete) ? offset : length;
+            }
+            return _mm_testz_si128(prev_incomplete, prev_incomplete) == 0 ? offset - block_size : length;
+        }
+
+        EREBOS_TARGET_FEATURES("sse4.1")
+        auto count_code_points_sse4_1(const u8* value, const usize length) noexcept -> usize {
+            constexpr usize block_size = 16;
+            const auto last_continuation = _mm_set1_epi8(static_cast<char>(0xBF));
+            usize count = 0;
+            usize offset = 0;
+            while(offset + block_size <= length) {
+                auto accumulator = _mm_setzero_si128();
+                for(usize block = 0; block < MAX_ACCUMULATED_BLOCKS && offset + block_size <= length; ++block, offset += block_size) {
+                    // Continuation bytes are the signed bytes below -64, the comparison is -1 for all other bytes
+                    const auto input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(value + offset));
+                    accumulator = _mm_sub_epi8(accumulator, _mm_cmpgt_epi8(input, last_continuation));
+                }
+                // The sums of the eight bytes of both halves fit into 32 bits
+                const auto sums = _mm_sad_epu8(accumulator, _mm_setzero_si128());
+                count += static_cast<usize>(_mm_cvtsi128_si32(_mm_add_epi64(sums, _mm_unpackhi_epi64(sums, sums))));
+            }
+            return count + count_code_points_scalar(value + offset, length - offset);
+        }
+
+        // The previous bytes of the AVX2 blocks cross the 128-bit lanes, so the lanes are shifted through the upper lane
+        // of the previous input
+        EREBOS_TARGET_FEATURES("avx2")
+        inline auto get_block_errors_avx2(const __m256i input, const __m256i prev_input) noexcept -> __m256i {
+            const auto low_nibble_mask = _mm256_set1_epi8(0x0F);
+            const auto shifted_input = _mm256_permute2x128_si256(prev_input, input, 0x21);
+            const auto prev1 = _mm256_alignr_epi8(input, shifted_input, 15);
+            const auto byte_1_high = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(load_table<__m128i>(BYTE_1_HIGH_TABLE)),
+                                                         _mm256_and_si256(_mm256_srli_epi16(prev1, 4), low_nibble_mask));
+            const auto byte_1_low = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(load_table<__m128i>(BYTE_1_LOW_TABLE)),
+                                                        _mm256_and_si256(prev1, low_nibble_mask));
+            const auto byte_2_high = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(load_table<__m128i>(BYTE_2_HIGH_TABLE)),
+                                                         _mm256_and_si256(_mm256_srli_epi16(input, 4), low_nibble_mask));
+            const auto special_cases = _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+
+            const auto prev2 = _mm256_alignr_epi8(input, shifted_input, 14);
+            const auto prev3 = _mm256_alignr_epi8(input, shifted_input, 13);
+            const auto is_third_byte = _mm256_subs_epu8(prev2, _mm256_set1_epi8(0xE0 - 0x80));
+            const auto is_fourth_byte = _mm256_subs_epu8(prev3, _mm256_set1_epi8(0xF0 - 0x80));
+            const auto must_be_continuation = _mm256_and_si256(_mm256_or_si256(is_third_byte, is_fourth_byte),
+                                                               _mm256_set1_epi8(static_cast<char>(0x80)));
+            return _mm256_xor_si256(must_be_continuation, special_cases);
+        }
+
+        EREBOS_TARGET_FEATURES("avx2")
+        inline auto has_block_errors_avx2(const __m256i input, __m256i& prev_input, __m256i& prev_incomplete) noexcept -> bool {
+            __m256i errors;
+            if(_mm256_movemask_epi8(input) == 0) {
+                errors = prev_incomplete;
+                prev_incomplete = _mm256_setzero_si256();
+            }
+            else {
+                errors = get_block_errors_avx2(input, prev_input);
+                const auto max_value = _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                                        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                                        static_cast<char>(INCOMPLETE_THRESHOLD_2),
+                                                        static_cast<char>(INCOMPLETE_THRESHOLD_1),
+                                                        static_cast<char>(INCOMPLETE_THRESHOLD_0));
+                prev_incomplete = _mm256_subs_epu8(input, max_value);
+            }
+            prev_input = input;
+            return _mm256_testz_si256(errors, errors) == 0;
+        }
+
+        EREBOS_TARGET_FEATURES("avx2")
+        auto find_invalid_block_avx2(const u8* value, const usize length) noexcept -> usize {
+            constexpr usize block_size = 32;
+            auto prev_input = _mm256_setzero_si256();
+            auto prev_incomplete = _mm256_setzero_si256();
+            usize offset = 0;
+            for(; offset + block_size <= length; offset += block_size) {
+                const auto input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(value + offset));
+                if(has_block_errors_avx2(input, prev_input, prev_incomplete)) {
+                    return offset;
+                }
+            }
+
+            if(offset < length) {
+                u8 rest[block_size] {};
+                std::memcpy(rest, value + offset, length - offset);
+                const auto input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rest));
+                return has_block_errors_avx2(input, prev_input, prev_incomplete) ? offset : length;
+            }
+            return _mm256_testz_si256(prev_incomplete, prev_incomplete) == 0 ? offset - block_size : length;
+        }
+
+        EREBOS_TARGET_FEATURES("avx2")
+        auto count_code_points_avx2(const u8* value, const usize length) noexcept -> usize {
+            constexpr usize block_size = 32;
+            const auto last_continuation = _mm256_set1_epi8(static_cast<char>(0xBF));
+            usize count = 0;
+            usize offset = 0;
+            while(offset + block_size <= length) {
+                auto accumulator = _mm256_setzero_si256();
+                for(usize block = 0; block < MAX_ACCUMULATED_BLOCKS && offset + block_size <= length; ++block, offset += block_size) {
+                    const auto input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(value + offset));
+                    accumulator = _mm256_sub_epi8(accumulator, _mm256_cmpgt_epi8(input, last_continuation));
+                }
+                const auto sums = _mm256_sad_epu8(accumulator, _mm256_setzero_si256());
+                const auto lane_sums = _mm_add_epi64(_mm256_castsi256_si128(sums), _mm256_extracti128_si256(sums, 1));
+                count += static_cast<usize>(_mm_cvtsi128_si32(_mm_add_epi64(lane_sums, _mm_unpackhi_epi64(lane_sums, lane_sums))));
+            }
+            return count + count_code_points_scalar(value + offset, length - offset);
+        }
+#elif defined(ARCH_ARM64)
+        inline auto get_block_errors_neon(const uint8x16_t input, const uint8x16_t prev_input) noexcept -> uint8x16_t {
+            const auto low_nibble_mask = vdupq_n_u8(0x0F);
+            const auto prev1 = vextq_u8(prev_input, input, 15);
+            const auto byte_1_high = vqtbl1q_u8(vld1q_u8(BYTE_1_HIGH_TABLE), vshrq_n_u8(prev1, 4));
+            const auto byte_1_low = vqtbl1q_u8(vld1q_u8(BYTE_1_LOW_TABLE), vandq_u8(prev1, low_nibble_mask));
+            const auto byte_2_high = vqtbl1q_u8(vld1q_u8(BYTE_2_HIGH_TABLE), vshrq_n_u8(input, 4));
+            const auto special_cases = vandq_u8(vandq_u8(byte_1_high, byte_1_low), byte_2_high);
+
+            const auto prev2 = vextq_u8(prev_input, input, 14);
+            const auto prev3 = vextq_u8(prev_input, input, 13);
+            const auto is_third_byte = vqsubq_u8(prev2, vdupq_n_u8(0xE0 - 0x80));
+            const auto is_fourth_byte = vqsubq_u8(prev3, vdupq_n_u8(0xF0 - 0x80));
+            const auto must_be_continuation = vandq_u8(vorrq_u8(is_third_byte, is_fourth_byte), vdupq_n_u8(0x80));
+            return veorq_u8(must_be_continuation, special_cases);
+        }
+
+        inline auto has_block_errors_neon(const uint8x16_t input, uint8x16_t& prev_input, uint8x16_t& prev_incomplete) noexcept -> bool {
+            uint8x16_t errors;
+            if(vmaxvq_u8(input) < 0x80) {
+                errors = prev_incomplete;
+                prev_incomplete = vdupq_n_u8(0);
+            }
+            else {
+                errors = get_block_errors_neon(input, prev_input);
+                constexpr u8 max_value[16] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                                              INCOMPLETE_THRESHOLD_2, INCOMPLETE_THRESHOLD_1, INCOMPLETE_THRESHOLD_0};
+                prev_incomplete = vqsubq_u8(input, vld1q_u8(max_value));
+            }
+            prev_input = input;
+            return vmaxvq_u8(errors) != 0;
+        }
+
+        auto find_invalid_block_neon(const u8* value, const usize length) noexcept -> usize {
+            constexpr usize block_size = 16;
+            auto prev_input = vdupq_n_u8(0);
+            auto prev_incomplete = vdupq_n_u8(0);
+            usize offset = 0;
+            for(; offset + block_size <= length; offset += block_size) {
+                if(has_block_errors_neon(vld1q_u8(value + offset), prev_input, prev_incomplete)) {
+                    return offset;
+                }
+            }
+
+            if(offset < length) {
+                u8 rest[block_size] {};
+                std::memcpy(rest, value + offset, length - offset);
+                return has_block_errors_neon(vld1q_u8(rest), prev_input, prev_incomplete) ? offset : length;
+            }
+            return vmaxvq_u8(prev_incomplete) != 0 ? offset - block_size : length;
+        }
+
+        auto count_code_points_neon(const u8* value, const usize length) noexcept -> usize {
+            constexpr usize block_size = 16;
+            const auto last_continuation = vdupq_n_s8(static_cast<int8_t>(0xBF));
+            usize count = 0;
+            usize offset = 0;
+            while(offset + block_size <= length) {
+                auto accumulator = vdupq_n_u8(0);
+                for(usize block = 0; block < MAX_ACCUMULATED_BLOCKS && offset + block_size <= length; ++block, offset += block_size) {
+                    const auto input = vreinterpretq_s8_u8(vld1q_u8(value + offset));
+                    accumulator = vsubq_u8(accumulator, vcgtq_s8(input, last_continuation));
+                }
+                count += vaddlvq_u8(accumulator);
+            }
+            return count + count_code_points_scalar(value + offset, length - offset);
+        }
+#endif
+
+        [[nodiscard]] auto select_find_invalid_block_function() noexcept -> FindInvalidBlockFunction {
+            [[maybe_unused]] const auto& cpu_features = platform::get_cpu_features();
+#if defined(ARCH_X86)
+            if(cpu_features.has_avx2) {
+                return &find_invalid_block_avx2;
+            }
+            if(cpu_features.has_sse4_1) {
+                return &find_invalid_block_sse4_1;
+            }
+#elif defined(ARCH_ARM64)
+            if(cpu_features.has_neon) {
+                return &find_invalid_block_neon;
+            }
+#endif
+            return &find_invalid_block_scalar;
+        }
+
+        [[nodiscard]] auto select_count_code_points_function() noexcept -> CountCodePointsFunction {
+            [[maybe_unused]] const auto& cpu_features = platform::get_cpu_features();
+#if defined(ARCH_X86)
+            if(cpu_features.has_avx2) {
+                return &count_code_points_avx2;
+            }
+            if(cpu_features.has_sse4_1) {
+                return &count_code_points_sse4_1;
+            }
+#elif defined(ARCH_ARM64)
+            if(cpu_features.has_neon) {
+                return &count_code_points_neon;
+            }
+#endif
+            return &count_code_points_scalar;
+        }
+
+        // Returns the offset of the first block with an error, the error can start up to four bytes before the block
+        [[nodiscard]] auto find_invalid_block(const std::span<const u8> value) noexcept -> usize {
+            static const auto function = select_find_invalid_block_function();
+            return function(value.data(), value.size());
+        }
+    }// namespace
+
+    /**
+     * This function checks whether the input is valid UTF-8. Overlong encodings, surrogates, code points above U+10FFFF
+     * and an incomplete sequence at the end of the input are invalid. The input is validated in blocks with the SIMD
+     * kernel selected for the CPU.
+     *
+     * @param value The input bytes
+     * @return      Whether the input is valid UTF-8
+     * @author      Cedric Hammes
+     * @since       18/10/2026
+     */
+    auto validate_utf8(const std::span<const u8> value) noexcept -> bool {
+        return find_invalid_block(value) == value.size();
+    }
+
+    /**
+     * This function returns the offset of the first invalid sequence in the input. The blocks before the first invalid
+     * block are validated with the SIMD kernel, the invalid block is searched with the scalar decoder.
+     *
+     * @param value The input bytes
+     * @return      The offset of the first byte of the invalid sequence or nothing if the input is valid UTF-8
+     * @author      Cedric Hammes
+     * @since       18/10/2026
+     */
+    auto find_invalid(const std::span<const u8> value) noexcept -> std::optional<usize> {
+        auto offset = find_invalid_block(value);
+        if(offset == value.size()) {
+            return std::nullopt;
+        }
+
+        // Errors are detected at the second byte of an invalid pair and an invalid sequence can span three bytes into the
+        // block, so the search starts at the lead byte of the sequence three bytes before the block. All sequences
+        // before this sequence are valid.
+        constexpr auto max_trail_length = static_cast<usize>(detail::UTFTraits<u8>::max_width - 1);
+        offset -= std::min(offset, max_trail_length);
+        for(usize i = 0; i < max_trail_length && offset > 0 && detail::UTFTraits<u8>::is_trail(value[offset]); ++i) {
+            --offset;
+        }
+        return offset + find_invalid_block_scalar(value.data() + offset, value.size() - offset);
+    }
+
+    /**
+     * This function counts the code points of the UTF-8 input by counting all bytes, which aren't continuation bytes.
+     * The input isn't validated, so the count is only the count of decoded code points if the input is valid UTF-8.
+     *
+     * @param value The input bytes
+     * @return      The count of code points
+     * @author      Cedric Hammes
+     * @since       18/10/2026
+     */
+    auto count_code_points(const std::span<const u8> value) noexcept -> usize {
+        static const auto function = select_count_code_points_function();
+        return function(value.data(), value.size());
+    }
+}// namespace erebos::unicode
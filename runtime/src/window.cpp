@@ -18,8 +18,35 @@
  */
 
 #include "erebos/window.hpp"
+#include "erebos/log.hpp"
+#include "erebos/profiler.hpp"
+#include "erebos/spsc_queue.hpp"
+#include <SDL2/SDL_vulkan.h>
+#include <algorithm>
+#include <memory>
+#include <thread>
 
 namespace erebos {
+    namespace {
+        constexpr usize EVENT_QUEUE_CAPACITY = 1024;
+        constexpr i32 EVENT_WAIT_TIMEOUT_MS = 10;
+
+        // The render thread can't block on SDL events, so it sleeps in short steps while idling to notice new events
+        constexpr std::chrono::milliseconds RENDER_THREAD_IDLE_STEP {16};
+
+        auto log_event_error(const std::string& error) noexcept -> void {
+            EREBOS_LOG_ERROR("Error while handling SDL event -> {}", error);
+        }
+
+        auto log_render_error(const std::string& error) noexcept -> void {
+            EREBOS_LOG_ERROR("Error while handling render callback -> {}", error);
+        }
+
+        [[nodiscard]] constexpr auto pack_size(const u32 width, const u32 height) noexcept -> u64 {
+            return (static_cast<u64>(width) << 32U) | height;
+        }
+    }// namespace
+
     /**
      * This constructor initializes SDL and creates the window with the specified title and the initial
      * bounds.
@@ -31,14 +58,19 @@ namespace erebos {
      * @since                14/03/2024
      */
     Window::Window(std::string_view title, uint32_t initial_width, uint32_t initial_height)
-        : _event_callback_list {}
-        , _render_callback_list {} {
+        : _event_callbacks {}
+        , _render_callbacks {}
+        , _drawable_size {pack_size(initial_width, initial_height)}
+        , _frame_scheduler_config {}
+        , _title_mutex {}
+        , _pending_title {}
+        , _is_title_pending {false} {
         using namespace std::string_literals;
         if(::SDL_Init(SDL_INIT_VIDEO | SDL_INIT_EVENTS) != 0) {
             throw std::runtime_error {fmt::format("Unable to init SDL: {}", ::SDL_GetError())};
         }
 
-        SPDLOG_INFO("Create SDL window '{}' with {}x{} pixels", title, initial_width, initial_height);
+        EREBOS_LOG_INFO("Create SDL window '{}' with {}x{} pixels", title, initial_width, initial_height);
         _window_handle = ::SDL_CreateWindow(title.data(),
                                             SDL_WINDOWPOS_UNDEFINED,
                                             SDL_WINDOWPOS_UNDEFINED,
@@ -50,12 +82,18 @@ namespace erebos {
         }
 
         ::SDL_ShowWindow(_window_handle);
+        update_drawable_size();
     }
 
     Window::Window(Window&& other) noexcept
         : _window_handle {other._window_handle}
-        , _render_callback_list {std::move(other._render_callback_list)}
-        , _event_callback_list {std::move(other._event_callback_list)} {
+        , _event_callbacks {std::move(other._event_callbacks)}
+        , _render_callbacks {std::move(other._render_callbacks)}
+        , _drawable_size {other._drawable_size.load(std::memory_order_relaxed)}
+        , _frame_scheduler_config {other._frame_scheduler_config}
+        , _title_mutex {}
+        , _pending_title {std::move(other._pending_title)}
+        , _is_title_pending {other._is_title_pending.load(std::memory_order_relaxed)} {
         other._window_handle = nullptr;
     }
 
@@ -76,45 +114,192 @@ namespace erebos {
 
     /**
      * This method runs a window loop which polls window events while the window doesn't requested to be closed. When
-     * an error occurs, this method cancels the loop and returns the error.
+     * an error occurs, this method cancels the loop and returns the error. The frames are paced by a frame scheduler,
+     * while waiting for the next frame the loop blocks on events instead of spinning.
      *
-     * @return Void or an error
-     * @author Cedric Hammes
-     * @since  14/03/2024
+     * @param mode The threading mode of the loop
+     * @return     Void or an error
+     * @author     Cedric Hammes
+     * @since      14/03/2024
      */
-    auto Window::run_loop() const noexcept -> erebos::Result<void> {
-        auto is_running = true;
+    auto Window::run_loop(const LoopMode mode) const noexcept -> erebos::Result<void> {
+        if(mode == LoopMode::THREADED) {
+            return run_threaded_loop();
+        }
 
+        EREBOS_PROFILE_THREAD_NAME("Main Thread");
+        FrameScheduler frame_scheduler {_frame_scheduler_config};
+        auto is_running = true;
         SDL_Event event {};
+        const auto handle_event = [&]() {
+            if(event.type == SDL_QUIT) {
+                is_running = false;
+                return;
+            }
+
+            if(event.type == SDL_WINDOWEVENT && event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED) {
+                update_drawable_size();
+            }
+            frame_scheduler.handle_event(event);
+            dispatch_event(event);
+        };
+
         while(is_running) {
-            while(is_running && ::SDL_PollEvent(&event)) {
-                if(event.type == SDL_QUIT) {
-                    is_running = false;
-                    continue;
+            apply_pending_title();
+
+            // Block on events until the next frame must be prepared
+            if(const auto timeout = frame_scheduler.get_event_wait_timeout(FrameScheduler::Clock::now()); timeout.count() > 0) {
+                if(::SDL_WaitEventTimeout(&event, static_cast<i32>(timeout.count())) != 0) {
+                    handle_event();
                 }
+                continue;
+            }
+
+            EREBOS_PROFILE_SCOPE("Window::run_loop");
+            while(is_running && ::SDL_PollEvent(&event)) {
+                handle_event();
+            }
+
+            if(is_running) {
+                frame_scheduler.begin_frame();
+                dispatch_render();
+            }
+        }
+        return {};
+    }
+
+    /**
+     * This method returns the size of the window's drawable in pixels. The size is updated by the event loop before
+     * the resize event is passed to the callbacks, so this can be called safely from the render thread.
+     *
+     * @return The width and height of the drawable
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    auto Window::get_drawable_size() const noexcept -> std::pair<u32, u32> {
+        const auto drawable_size = _drawable_size.load(std::memory_order_acquire);
+        return {static_cast<u32>(drawable_size >> 32U), static_cast<u32>(drawable_size)};
+    }
 
-                // Trigger all event callbacks
-                for(const auto& callback_entry : _event_callback_list) {
-                    if(auto result = callback_entry.first(event, callback_entry.second); !result) {
-                        SPDLOG_ERROR("Error while handling SDL event -> {}", result.get_error());
+    /**
+     * This method pumps the events on the calling thread and passes them through a lock-free queue to the render thread,
+     * which calls the event callbacks followed by the render callbacks. SDL requires the events to be pumped on the
+     * thread which created the window, so only the callbacks are moved to the render thread. When the queue is full, the
+     * pumping thread waits for the render thread instead of dropping events. The render thread paces the frames with its
+     * own frame scheduler.
+     *
+     * @return Void or an error
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    auto Window::run_threaded_loop() const noexcept -> erebos::Result<void> {
+        const auto event_queue = std::make_unique<SPSCQueue<SDL_Event, EVENT_QUEUE_CAPACITY>>();
+        std::atomic_bool is_running {true};
+
+        std::thread render_thread {};
+        try {
+            render_thread = std::thread {[&]() {
+                EREBOS_PROFILE_THREAD_NAME("Render Thread");
+                FrameScheduler frame_scheduler {_frame_scheduler_config};
+                while(is_running.load(std::memory_order_acquire)) {
+                    while(auto event = event_queue->try_pop()) {
+                        frame_scheduler.handle_event(*event);
+                        dispatch_event(*event);
+                    }
+
+                    if(const auto timeout = frame_scheduler.get_event_wait_timeout(FrameScheduler::Clock::now()); timeout.count() > 0) {
+                        std::this_thread::sleep_for(std::min<std::chrono::milliseconds>(timeout, RENDER_THREAD_IDLE_STEP));
+                        continue;
                     }
+
+                    EREBOS_PROFILE_SCOPE("Window::run_loop");
+                    frame_scheduler.begin_frame();
+                    dispatch_render();
                 }
+            }};
+        }
+        catch(const std::system_error& error) {
+            return Error(fmt::format("Unable to start render thread: {}", error.what()));
+        }
+
+        EREBOS_PROFILE_THREAD_NAME("Event Thread");
+        SDL_Event event {};
+        while(is_running.load(std::memory_order_relaxed)) {
+            apply_pending_title();
+            if(::SDL_WaitEventTimeout(&event, EVENT_WAIT_TIMEOUT_MS) == 0) {
+                continue;
             }
 
-            // Trigger all render callbacks
-            for(const auto& callback_entry : _render_callback_list) {
-                if(auto result = callback_entry.first(callback_entry.second); !result) {
-                    SPDLOG_ERROR("Error while handling render callback -> {}", result.get_error());
-                }
+            if(event.type == SDL_QUIT) {
+                is_running.store(false, std::memory_order_release);
+                break;
+            }
+
+            // Publish the new drawable size before the resize event is visible to the render thread
+            if(event.type == SDL_WINDOWEVENT && event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED) {
+                update_drawable_size();
+            }
+
+            while(!event_queue->try_push(event)) {
+                std::this_thread::yield();
             }
         }
+
+        render_thread.join();
         return {};
     }
 
+    /**
+     * This method sets the title of the window. SDL only allows to set the title on the thread which pumps the events,
+     * so the title is stored and set by the next iteration of the window loop. This can be called safely from
+     * the render thread and the callbacks.
+     *
+     * @param title The new title of the window
+     * @author      Cedric Hammes
+     * @since       18/10/2026
+     */
+    auto Window::set_title(std::string title) noexcept -> void {
+        const auto guard = std::lock_guard {_title_mutex};
+        _pending_title = std::move(title);
+        _is_title_pending.store(true, std::memory_order_release);
+    }
+
+    auto Window::dispatch_event(SDL_Event& event) const noexcept -> void {
+        EREBOS_PROFILE_SCOPE("Window::dispatch_event");
+        _event_callbacks.dispatch(event.type, log_event_error, event);
+    }
+
+    auto Window::dispatch_render() const noexcept -> void {
+        EREBOS_PROFILE_SCOPE("Window::dispatch_render");
+        _render_callbacks.dispatch_unkeyed(log_render_error);
+    }
+
+    auto Window::update_drawable_size() const noexcept -> void {
+        int width = 0;
+        int height = 0;
+        ::SDL_Vulkan_GetDrawableSize(_window_handle, &width, &height);
+        _drawable_size.store(pack_size(static_cast<u32>(width), static_cast<u32>(height)), std::memory_order_release);
+    }
+
+    // Must only be called on the thread which pumps the events
+    auto Window::apply_pending_title() const noexcept -> void {
+        if(!_is_title_pending.load(std::memory_order_acquire)) {
+            return;
+        }
+
+        const auto guard = std::lock_guard {_title_mutex};
+        ::SDL_SetWindowTitle(_window_handle, _pending_title.c_str());
+        _is_title_pending.store(false, std::memory_order_relaxed);
+    }
+
     auto Window::operator=(Window&& other) noexcept -> Window& {
         _window_handle = other._window_handle;
-        _render_callback_list = std::move(other._render_callback_list);
-        _event_callback_list = std::move(other._event_callback_list);
+        _render_callbacks = std::move(other._render_callbacks);
+        _event_callbacks = std::move(other._event_callbacks);
+        _drawable_size.store(other._drawable_size.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        _frame_scheduler_config = other._frame_scheduler_config;
+        _pending_title = std::move(other._pending_title);
+        _is_title_pending.store(other._is_title_pending.load(std::memory_order_relaxed), std::memory_order_relaxed);
         other._window_handle = nullptr;
         return *this;
     }
@@ -0,0 +1,58 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#pragma once
+#include <erebos/render/vulkan/context.hpp>
+#include <erebos/render/vulkan/device.hpp>
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+namespace erebos::tests {
+    /**
+     * This fixture creates a headless Vulkan context and a device on the first physical device, which is lavapipe on
+     * the CI runners. The tests of the fixture are skipped if no Vulkan driver is installed.
+     *
+     * @author Cedric Hammes
+     * @since  18/10/2026
+     */
+    class HeadlessDeviceTest : public ::testing::Test {
+    protected:
+        std::unique_ptr<render::vulkan::VulkanContext> _context;
+        std::unique_ptr<render::vulkan::Device> _device;
+
+        auto SetUp() -> void override {
+            try {
+                _context = std::make_unique<render::vulkan::VulkanContext>();
+                u32 physical_device_count = 0;
+                ::vkEnumeratePhysicalDevices(**_context, &physical_device_count, nullptr);
+                if(physical_device_count == 0) {
+                    GTEST_SKIP() << "No Vulkan device available";
+                }
+
+                std::vector<VkPhysicalDevice> physical_devices {physical_device_count};
+                ::vkEnumeratePhysicalDevices(**_context, &physical_device_count, physical_devices.data());
+                _device = std::make_unique<render::vulkan::Device>(*_context, physical_devices[0]);
+            }
+            catch(const std::runtime_error& error) {
+                GTEST_SKIP() << error.what();
+            }
+        }
+    };
+}// namespace erebos::tests
@@ -0,0 +1,64 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <erebos/plugin/plugin_api.hpp>
+
+// This plugin counts its updates and hands the count over to the reloaded plugin, it's loaded by the plugin module tests
+namespace {
+    struct State final {
+        std::uint64_t update_count;
+        double time;
+    };
+
+    constexpr erebos::plugin::PluginApi PLUGIN_API {
+            erebos::plugin::PLUGIN_API_VERSION,
+            "Test Plugin",
+            []() -> void* {
+                // The plugin module tests let the creation fail to test the cleanup of a failed load
+                if(std::getenv("EREBOS_TEST_PLUGIN_FAIL_CREATE") != nullptr) {
+                    return nullptr;
+                }
+                return new State {};
+            },
+            [](void* instance) {
+                delete static_cast<State*>(instance);
+            },
+            [](void* instance, const double delta_time) {
+                auto* state = static_cast<State*>(instance);
+                state->update_count++;
+                state->time += delta_time;
+            },
+            [](const void* instance, std::uint8_t* buffer, const std::size_t buffer_size) -> std::size_t {
+                if(buffer_size >= sizeof(State)) {
+                    std::memcpy(buffer, instance, sizeof(State));
+                }
+                return sizeof(State);
+            },
+            [](void* instance, const std::uint8_t* buffer, const std::size_t buffer_size) -> bool {
+                if(buffer_size != sizeof(State)) {
+                    return false;
+                }
+                std::memcpy(instance, buffer, sizeof(State));
+                return true;
+            }};
+}// namespace
+
+EREBOS_DEFINE_PLUGIN(PLUGIN_API)
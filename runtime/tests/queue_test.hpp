@@ -0,0 +1,79 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#pragma once
+#include <atomic>
+#include <erebos/utils.hpp>
+#include <thread>
+#include <vector>
+
+namespace erebos::tests {
+    /**
+     * This function pushes the values of the specified count of producer threads into the queue and pops them on the
+     * calling thread. Every value contains the producer in the upper bits and the sequence number of the producer in
+     * the lower bits. The consume function returns false to stop the test after a failed expectation. The producers
+     * are stopped and joined before this function returns, so the caller can use fatal assertions afterwards.
+     *
+     * @param queue          The queue to push the values into
+     * @param producer_count The count of producer threads
+     * @param value_count    The count of values pushed by every producer
+     * @param consume        The function called with every popped value
+     * @return               The count of consumed values
+     * @author               Cedric Hammes
+     * @since                18/10/2026
+     */
+    template<typename Q, typename F>
+    auto run_producers(Q& queue, const u64 producer_count, const u64 value_count, F&& consume) -> u64 {
+        std::atomic_bool is_stopped {false};
+        std::vector<std::thread> producers {};
+        producers.reserve(producer_count);
+        for(u64 producer = 0; producer < producer_count; producer++) {
+            producers.emplace_back([&queue, &is_stopped, producer, value_count]() {
+                for(u64 i = 0; i < value_count; i++) {
+                    while(!queue.try_push((producer << 32U) | i)) {
+                        if(is_stopped.load(std::memory_order_relaxed)) {
+                            return;
+                        }
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        u64 consumed_count = 0;
+        while(consumed_count < producer_count * value_count) {
+            const auto value = queue.try_pop();
+            if(!value.has_value()) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            if(!consume(*value)) {
+                break;
+            }
+            consumed_count++;
+        }
+
+        is_stopped.store(true, std::memory_order_relaxed);
+        for(auto& producer : producers) {
+            producer.join();
+        }
+        return consumed_count;
+    }
+}// namespace erebos::tests
@@ -0,0 +1,98 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include "headless_device.hpp"
+#include <erebos/memory/tracking.hpp>
+#include <erebos/render/vulkan/frame.hpp>
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+namespace {
+    constexpr erebos::usize FRAMES_IN_FLIGHT = 2;
+
+    // Records and submits an empty command buffer on the direct queue like a headless frame of the renderer
+    auto run_frame(erebos::render::vulkan::Frame& frame) -> void {
+        ASSERT_TRUE(frame.begin_frame());
+        auto command_buffer = frame.get_queue_frames()[0].acquire_command_buffer();
+        ASSERT_TRUE(command_buffer);
+        ASSERT_TRUE((*command_buffer)->begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT));
+        ASSERT_TRUE((*command_buffer)->end());
+        ASSERT_TRUE(frame.submit(false));
+    }
+}// namespace
+
+class erebos_render_vulkan_Frame : public erebos::tests::HeadlessDeviceTest {
+protected:
+    std::vector<erebos::render::vulkan::Frame> _frames {};
+
+    auto SetUp() -> void override {
+        if constexpr(!erebos::memory::is_allocation_tracking_enabled()) {
+            GTEST_SKIP() << "Allocation tracking is not compiled in";
+        }
+
+        HeadlessDeviceTest::SetUp();
+        if(IsSkipped()) {
+            return;
+        }
+
+        _frames.reserve(FRAMES_IN_FLIGHT);
+        for(erebos::usize i = 0; i < FRAMES_IN_FLIGHT; i++) {
+            _frames.emplace_back(*_device);
+        }
+    }
+
+    auto TearDown() -> void override {
+        if(_device != nullptr) {
+            ::vkDeviceWaitIdle(**_device);
+        }
+        _frames.clear();
+    }
+};
+
+TEST(erebos_memory_AllocationScope, counts_allocations) {
+    if constexpr(!erebos::memory::is_allocation_tracking_enabled()) {
+        GTEST_SKIP() << "Allocation tracking is not compiled in";
+    }
+
+    const erebos::memory::AllocationScope scope {"test"};
+    auto value = std::make_unique<erebos::u64>(42);
+    ASSERT_EQ(*value, 42);
+    ASSERT_EQ(scope.get_counters().allocation_count, 1);
+    ASSERT_GE(scope.get_counters().live_bytes, sizeof(erebos::u64));
+    value.reset();
+    ASSERT_EQ(scope.get_counters().deallocation_count, 1);
+    ASSERT_EQ(scope.get_counters().live_bytes, 0);
+}
+
+TEST_F(erebos_render_vulkan_Frame, steady_state_frame_is_allocation_free) {
+    // The first frames allocate the command buffers and warm up the frame arena and the vectors of the queue frames
+    for(erebos::usize frame = 0; frame < 4 * FRAMES_IN_FLIGHT; frame++) {
+        run_frame(_frames[frame % FRAMES_IN_FLIGHT]);
+        ASSERT_FALSE(HasFatalFailure());
+    }
+
+    // After that, a frame must not touch the global allocator anymore
+    const erebos::memory::AllocationScope scope {"steady_state"};
+    for(erebos::usize frame = 0; frame < 64; frame++) {
+        run_frame(_frames[frame % FRAMES_IN_FLIGHT]);
+        ASSERT_FALSE(HasFatalFailure());
+    }
+    ASSERT_EQ(scope.get_counters().allocation_count, 0);
+}
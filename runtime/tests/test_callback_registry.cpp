@@ -0,0 +1,96 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include <array>
+#include <erebos/callback_registry.hpp>
+#include <gtest/gtest.h>
+#include <memory>
+
+namespace {
+    auto add_one(int value) -> int {
+        return value + 1;
+    }
+
+    auto ignore_error(const std::string&) noexcept -> void {
+    }
+}// namespace
+
+TEST(erebos_Delegate, inline_and_heap_callables) {
+    erebos::Delegate<int(int)> function_delegate {add_one};
+    ASSERT_EQ(function_delegate(1), 2);
+
+    // Owning callables are destroyed exactly once, even after being moved between delegates
+    auto counter = std::make_shared<int>(0);
+    erebos::Delegate<int(int)> inline_delegate {[counter](int value) { return value + *counter; }};
+    std::array<std::byte, 128> large_capture {};
+    erebos::Delegate<int(int)> heap_delegate {[counter, large_capture](int value) { return value + static_cast<int>(large_capture.size()); }};
+    ASSERT_EQ(counter.use_count(), 3);
+
+    auto moved_delegate = std::move(heap_delegate);
+    ASSERT_FALSE(static_cast<bool>(heap_delegate));
+    ASSERT_EQ(moved_delegate(1), 129);
+    inline_delegate = std::move(moved_delegate);
+    ASSERT_EQ(inline_delegate(1), 129);
+    ASSERT_EQ(counter.use_count(), 2);
+
+    inline_delegate.reset();
+    ASSERT_EQ(counter.use_count(), 1);
+}
+
+TEST(erebos_CallbackRegistry, priority_and_key_filter) {
+    erebos::CallbackRegistry<std::vector<int>&> registry {};
+    const auto append = [](int value) {
+        return [value](std::vector<int>& order, void*) -> erebos::Result<void> {
+            order.push_back(value);
+            return {};
+        };
+    };
+    registry.add(append(1), nullptr, 0, 1);
+    registry.add(append(2), nullptr, 10);
+    registry.add(append(3), nullptr, 0);
+    registry.add(append(4), nullptr, 5, 2);
+    registry.add(append(5), nullptr, 20, 1);
+
+    std::vector<int> order {};
+    ASSERT_EQ(registry.dispatch(1, ignore_error, order), 0);
+    ASSERT_EQ(order, (std::vector<int> {5, 2, 1, 3}));
+
+    order.clear();
+    ASSERT_EQ(registry.dispatch(2, ignore_error, order), 0);
+    ASSERT_EQ(order, (std::vector<int> {2, 4, 3}));
+
+    order.clear();
+    registry.dispatch_unkeyed(ignore_error, order);
+    ASSERT_EQ(order, (std::vector<int> {2, 3}));
+}
+
+TEST(erebos_CallbackRegistry, errors_do_not_cancel_dispatch) {
+    erebos::CallbackRegistry<int&> registry {};
+    registry.add([](int&, void*) -> erebos::Result<void> { return erebos::Error(std::string {"failed"}); }, nullptr, 1);
+    registry.add(
+            [](int& value, void*) -> erebos::Result<void> {
+                value++;
+                return {};
+            },
+            nullptr);
+
+    int value = 0;
+    ASSERT_EQ(registry.dispatch_unkeyed(ignore_error, value), 1);
+    ASSERT_EQ(value, 1);
+}
@@ -0,0 +1,110 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include <erebos/render/capture.hpp>
+#include <fstream>
+#include <gtest/gtest.h>
+
+namespace {
+    auto write_capture(const std::filesystem::path& path) -> void {
+        erebos::render::CaptureWriter writer {path, 1280, 720};
+        for(erebos::u32 i = 0; i < 2; i++) {
+            writer.begin_frame();
+            writer.acquire_command_buffer(0);
+            writer.begin_command_buffer(1);
+            writer.begin_label("Clear");
+            writer.clear_image({0.1f, 0.2f, 0.3f, 1.0f});
+            writer.end_label();
+            writer.upload(4096 * (i + 1));
+            writer.end_command_buffer();
+            writer.submit();
+            writer.end_frame();
+        }
+        ASSERT_EQ(writer.get_frame_count(), 2);
+    }
+
+    [[nodiscard]] auto read_types(erebos::render::CaptureReader& reader) -> std::vector<erebos::render::CaptureCommandType> {
+        std::vector<erebos::render::CaptureCommandType> types {};
+        while(true) {
+            auto command = reader.next();
+            if(!command || !command->has_value()) {
+                break;
+            }
+            types.push_back((*command)->type);
+        }
+        return types;
+    }
+}// namespace
+
+TEST(erebos_render_capture, commands_round_trip) {
+    const auto path = std::filesystem::temp_directory_path() / "erebos-test-capture.bin";
+    write_capture(path);
+
+    erebos::render::CaptureReader reader {path};
+    ASSERT_EQ(reader.get_frame_count(), 2);
+    ASSERT_EQ(reader.get_image_width(), 1280);
+    ASSERT_EQ(reader.get_image_height(), 720);
+    ASSERT_EQ(reader.get_max_upload_size(), 8192);
+
+    using erebos::render::CaptureCommandType;
+    ASSERT_EQ((*reader.next())->type, CaptureCommandType::BEGIN_FRAME);
+    ASSERT_EQ((*reader.next())->value, 0);
+    ASSERT_EQ((*reader.next())->value, 1);
+    ASSERT_EQ((*reader.next())->name, "Clear");
+    const auto clear = *reader.next();
+    ASSERT_EQ(clear->type, CaptureCommandType::CLEAR_IMAGE);
+    ASSERT_FLOAT_EQ(clear->color[2], 0.3f);
+    ASSERT_EQ((*reader.next())->type, CaptureCommandType::END_LABEL);
+    ASSERT_EQ((*reader.next())->size, 4096);
+
+    // The reader can be rewound to replay the capture again
+    reader.rewind();
+    const auto types = read_types(reader);
+    ASSERT_EQ(types.size(), 20);
+    ASSERT_EQ(types.back(), CaptureCommandType::END_FRAME);
+    ASSERT_FALSE(reader.next()->has_value());
+    std::filesystem::remove(path);
+}
+
+TEST(erebos_render_capture, corrupted_captures_are_rejected) {
+    const auto path = std::filesystem::temp_directory_path() / "erebos-test-capture-corrupted.bin";
+    write_capture(path);
+
+    // A truncated command is reported as error instead of reading past the mapping
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+    {
+        erebos::render::CaptureReader reader {path};
+        bool is_error = false;
+        while(true) {
+            auto command = reader.next();
+            if(!command) {
+                is_error = true;
+                break;
+            }
+            if(!command->has_value()) {
+                break;
+            }
+        }
+        ASSERT_TRUE(is_error);
+    }
+
+    std::ofstream {path, std::ios::binary | std::ios::trunc} << "not a capture, but long enough for the header";
+    ASSERT_THROW(erebos::render::CaptureReader {path}, std::runtime_error);
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,272 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include "headless_device.hpp"
+#include <algorithm>
+#include <cstring>
+#include <erebos/render/vulkan/defragmenter.hpp>
+#include <thread>
+#include <unordered_map>
+
+namespace {
+    constexpr VkDeviceSize BUFFER_SIZE = 64 * 1024;
+    constexpr VkDeviceSize BLOCK_SIZE = 4 * BUFFER_SIZE;
+    constexpr erebos::usize BUFFER_COUNT = 16;
+
+    struct TestBuffer final {
+        VmaAllocation allocation;
+        VkBuffer buffer;
+        erebos::u8 pattern;
+    };
+
+    [[nodiscard]] auto make_buffer_create_info() noexcept -> VkBufferCreateInfo {
+        VkBufferCreateInfo create_info {};
+        create_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        create_info.size = BUFFER_SIZE;
+        create_info.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+        create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        return create_info;
+    }
+
+    [[nodiscard]] auto make_allocation_create_info(VmaPool pool) noexcept -> VmaAllocationCreateInfo {
+        VmaAllocationCreateInfo allocation_create_info {};
+        allocation_create_info.usage = VMA_MEMORY_USAGE_AUTO;
+        allocation_create_info.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT;
+        allocation_create_info.pool = pool;
+        return allocation_create_info;
+    }
+
+    // Returns whether all bytes of the allocation are the pattern, the allocation is read at its current place
+    [[nodiscard]] auto has_pattern(VmaAllocator allocator, VmaAllocation allocation, const erebos::u8 pattern) noexcept -> bool {
+        void* data = nullptr;
+        if(::vmaMapMemory(allocator, allocation, &data) != VK_SUCCESS) {
+            return false;
+        }
+        ::vmaInvalidateAllocation(allocator, allocation, 0, VK_WHOLE_SIZE);
+
+        const auto* bytes = static_cast<const erebos::u8*>(data);
+        const auto is_pattern = std::all_of(bytes, bytes + BUFFER_SIZE, [&](const auto byte) noexcept {
+            return byte == pattern;
+        });
+        ::vmaUnmapMemory(allocator, allocation);
+        return is_pattern;
+    }
+}// namespace
+
+class erebos_render_vulkan_Defragmenter : public erebos::tests::HeadlessDeviceTest {
+protected:
+    VmaPool _pool {nullptr};
+    std::vector<TestBuffer> _buffers {};
+
+    auto SetUp() -> void override {
+        HeadlessDeviceTest::SetUp();
+        if(IsSkipped()) {
+            return;
+        }
+
+        // The pool has small blocks, so the buffers are spread over multiple blocks which can be freed by the moves
+        const auto allocator = _device->get_allocator();
+        const auto buffer_create_info = make_buffer_create_info();
+        auto allocation_create_info = make_allocation_create_info(nullptr);
+        VmaPoolCreateInfo pool_create_info {};
+        pool_create_info.blockSize = BLOCK_SIZE;
+        ASSERT_EQ(::vmaFindMemoryTypeIndexForBufferInfo(allocator, &buffer_create_info, &allocation_create_info, &pool_create_info.memoryTypeIndex),
+                  VK_SUCCESS);
+        ASSERT_EQ(::vmaCreatePool(allocator, &pool_create_info, &_pool), VK_SUCCESS);
+
+        allocation_create_info = make_allocation_create_info(_pool);
+        for(erebos::usize i = 0; i < BUFFER_COUNT; i++) {
+            TestBuffer test_buffer {nullptr, nullptr, static_cast<erebos::u8>(i + 1)};
+            ASSERT_EQ(::vmaCreateBuffer(allocator, &buffer_create_info, &allocation_create_info, &test_buffer.buffer, &test_buffer.allocation, nullptr),
+                      VK_SUCCESS);
+
+            void* data = nullptr;
+            ASSERT_EQ(::vmaMapMemory(allocator, test_buffer.allocation, &data), VK_SUCCESS);
+            std::memset(data, test_buffer.pattern, BUFFER_SIZE);
+            ::vmaFlushAllocation(allocator, test_buffer.allocation, 0, VK_WHOLE_SIZE);
+            ::vmaUnmapMemory(allocator, test_buffer.allocation);
+            _buffers.push_back(test_buffer);
+        }
+
+        // Destroy every other buffer, so every block is only half used
+        std::vector<TestBuffer> kept_buffers {};
+        for(erebos::usize i = 0; i < _buffers.size(); i++) {
+            if(i % 2 == 0) {
+                ::vmaDestroyBuffer(allocator, _buffers[i].buffer, _buffers[i].allocation);
+                continue;
+            }
+            kept_buffers.push_back(_buffers[i]);
+        }
+        _buffers = std::move(kept_buffers);
+    }
+
+    auto TearDown() -> void override {
+        if(_device == nullptr) {
+            return;
+        }
+
+        for(const auto& test_buffer : _buffers) {
+            ::vmaDestroyBuffer(_device->get_allocator(), test_buffer.buffer, test_buffer.allocation);
+        }
+
+        if(_pool != nullptr) {
+            ::vmaDestroyPool(_device->get_allocator(), _pool);
+        }
+    }
+};
+
+TEST_F(erebos_render_vulkan_Defragmenter, moves_registered_buffers) {
+    const auto allocator = _device->get_allocator();
+    std::unordered_map<VkBuffer, VmaAllocation> moved_buffers {};
+    {
+        auto defragmenter = erebos::render::vulkan::Defragmenter {*_device, _pool};
+        const auto fragmentation = defragmenter.get_fragmentation();
+        ASSERT_GT(fragmentation, 0.4f);
+
+        const auto buffer_create_info = make_buffer_create_info();
+        for(auto& test_buffer : _buffers) {
+            const auto callback = [&moved_buffers, allocation = test_buffer.allocation](VkBuffer new_buffer,
+                                                                                          VkDeviceAddress new_address,
+                                                                                          [[maybe_unused]] void* data) {
+                ASSERT_EQ(new_address, 0);
+                moved_buffers.insert_or_assign(new_buffer, allocation);
+            };
+            ASSERT_TRUE(defragmenter.register_buffer(test_buffer.allocation, test_buffer.buffer, buffer_create_info, callback, nullptr));
+        }
+
+        // The copies are polled, so the defragmentation takes multiple calls like it would take multiple frames
+        erebos::usize run_count = 0;
+        while(true) {
+            const auto is_complete = defragmenter.run(std::chrono::milliseconds {1});
+            ASSERT_TRUE(is_complete);
+            if(*is_complete) {
+                break;
+            }
+
+            ASSERT_LT(++run_count, 10000);
+            std::this_thread::yield();
+        }
+        ASSERT_FALSE(defragmenter.is_running());
+        ASSERT_LT(defragmenter.get_fragmentation(), fragmentation);
+
+        // Every move was reported to the owner of the buffer and the buffers were replaced with the new buffers
+        const auto& statistics = defragmenter.get_statistics();
+        ASSERT_GT(statistics.pass_count, 0);
+        ASSERT_GT(statistics.moved_allocation_count, 0);
+        ASSERT_EQ(statistics.moved_allocation_count, moved_buffers.size());
+        ASSERT_EQ(statistics.moved_bytes, statistics.moved_allocation_count * BUFFER_SIZE);
+        ASSERT_EQ(statistics.ignored_allocation_count, 0);
+        ASSERT_GT(statistics.freed_memory_block_count, 0);
+        ASSERT_EQ(statistics.freed_bytes, statistics.freed_memory_block_count * BLOCK_SIZE);
+        for(auto& test_buffer : _buffers) {
+            test_buffer.buffer = defragmenter.get_buffer(test_buffer.allocation);
+            defragmenter.unregister_buffer(test_buffer.allocation);
+        }
+    }
+
+    for(const auto& test_buffer : _buffers) {
+        ASSERT_TRUE(has_pattern(allocator, test_buffer.allocation, test_buffer.pattern));
+    }
+
+    for(const auto& [buffer, allocation] : moved_buffers) {
+        const auto test_buffer = std::find_if(_buffers.cbegin(), _buffers.cend(), [&](const auto& test_buffer) noexcept {
+            return test_buffer.allocation == allocation;
+        });
+        ASSERT_NE(test_buffer, _buffers.cend());
+        ASSERT_EQ(test_buffer->buffer, buffer);
+    }
+}
+
+TEST_F(erebos_render_vulkan_Defragmenter, old_buffers_outlive_frames_in_flight) {
+    constexpr erebos::u32 frames_in_flight = 3;
+    auto defragmenter = erebos::render::vulkan::Defragmenter {*_device, _pool, 16 * 1024 * 1024, frames_in_flight};
+    const auto buffer_create_info = make_buffer_create_info();
+    erebos::usize moved_count = 0;
+    for(auto& test_buffer : _buffers) {
+        const auto callback = [&moved_count](VkBuffer, VkDeviceAddress, void*) {
+            moved_count += 1;
+        };
+        ASSERT_TRUE(defragmenter.register_buffer(test_buffer.allocation, test_buffer.buffer, buffer_create_info, callback, nullptr));
+    }
+
+    // Run until the first pass was copied and the owners switched to the new buffers
+    erebos::usize run_count = 0;
+    while(moved_count == 0) {
+        const auto is_complete = defragmenter.run(std::chrono::milliseconds {1});
+        ASSERT_TRUE(is_complete);
+        ASSERT_FALSE(*is_complete);
+        ASSERT_LT(++run_count, 10000);
+        std::this_thread::yield();
+    }
+
+    // The pass only ends after the frames in flight, so no further pass begins in the meantime
+    const auto pass_count = defragmenter.get_statistics().pass_count;
+    const auto first_pass_moved_count = moved_count;
+    for(erebos::u32 frame = 1; frame < frames_in_flight; frame++) {
+        const auto is_complete = defragmenter.run(std::chrono::milliseconds {100});
+        ASSERT_TRUE(is_complete);
+        ASSERT_FALSE(*is_complete);
+        ASSERT_EQ(defragmenter.get_statistics().pass_count, pass_count);
+        ASSERT_EQ(moved_count, first_pass_moved_count);
+    }
+
+    while(true) {
+        const auto is_complete = defragmenter.run(std::chrono::milliseconds {1});
+        ASSERT_TRUE(is_complete);
+        if(*is_complete) {
+            break;
+        }
+        ASSERT_LT(++run_count, 10000);
+        std::this_thread::yield();
+    }
+
+    for(auto& test_buffer : _buffers) {
+        test_buffer.buffer = defragmenter.get_buffer(test_buffer.allocation);
+        defragmenter.unregister_buffer(test_buffer.allocation);
+        ASSERT_TRUE(has_pattern(_device->get_allocator(), test_buffer.allocation, test_buffer.pattern));
+    }
+}
+
+TEST_F(erebos_render_vulkan_Defragmenter, ignores_unregistered_allocations) {
+    auto defragmenter = erebos::render::vulkan::Defragmenter {*_device, _pool};
+    while(true) {
+        const auto is_complete = defragmenter.run(std::chrono::milliseconds {1});
+        ASSERT_TRUE(is_complete);
+        if(*is_complete) {
+            break;
+        }
+        std::this_thread::yield();
+    }
+
+    const auto& statistics = defragmenter.get_statistics();
+    ASSERT_EQ(statistics.moved_allocation_count, 0);
+    ASSERT_GT(statistics.ignored_allocation_count, 0);
+    for(const auto& test_buffer : _buffers) {
+        ASSERT_TRUE(has_pattern(_device->get_allocator(), test_buffer.allocation, test_buffer.pattern));
+    }
+}
+
+TEST_F(erebos_render_vulkan_Defragmenter, exhausted_budget_defers_passes) {
+    auto defragmenter = erebos::render::vulkan::Defragmenter {*_device, _pool};
+    const auto is_complete = defragmenter.run(std::chrono::microseconds {0});
+    ASSERT_TRUE(is_complete);
+    ASSERT_FALSE(*is_complete);
+    ASSERT_TRUE(defragmenter.is_running());
+    ASSERT_EQ(defragmenter.get_statistics().pass_count, 0);
+}
@@ -18,6 +18,7 @@
  */
 
 #include <erebos/platform/file.hpp>
+#include <fstream>
 #include <gtest/gtest.h>
 
 TEST(erebos_platform_File, test_file_create) {
@@ -26,4 +27,78 @@ TEST(erebos_platform_File, test_file_create) {
         ASSERT_TRUE(std::filesystem::exists("file.txt"));
     }
     std::filesystem::remove("file.txt");
-}
\ No newline at end of file
+}
+
+TEST(erebos_platform_File, metadata_is_cached_until_invalidated) {
+    const auto path = std::filesystem::temp_directory_path() / "erebos-test-file-metadata.txt";
+    std::ofstream {path, std::ios::trunc} << "Hello";
+    const auto file = erebos::platform::File {path, erebos::platform::AccessMode::READ};
+    const auto metadata = file.get_metadata();
+    ASSERT_TRUE(metadata);
+    ASSERT_EQ(metadata->size, 5);
+    ASSERT_GT(metadata->block_size, 0);
+    ASSERT_GT(metadata->last_write_time.count(), 0);
+
+    // The metadata stays cached until an event of the file watcher about the file invalidates it
+    std::ofstream {path, std::ios::app} << ", World!";
+    ASSERT_EQ(file.get_metadata()->size, 5);
+
+    auto reopened_file = erebos::platform::File {path, erebos::platform::AccessMode::READ};
+    ASSERT_EQ(reopened_file.get_metadata()->size, 13);
+    std::ofstream {path, std::ios::app} << "!";
+    reopened_file.handle_file_event({erebos::platform::FileEventType::WRITTEN, std::filesystem::path {"other.txt"}});
+    reopened_file.handle_file_event({erebos::platform::FileEventType::WRITTEN, std::filesystem::path {"other"} / path.filename()});
+    ASSERT_EQ(reopened_file.get_metadata()->size, 13);
+    reopened_file.handle_file_event({erebos::platform::FileEventType::WRITTEN, path});
+    ASSERT_EQ(reopened_file.get_metadata()->size, 14);
+    ASSERT_EQ(reopened_file.get_metadata()->file_id, metadata->file_id);
+    std::filesystem::remove(path);
+}
+
+TEST(erebos_platform_File, file_size_is_never_stale) {
+    const auto path = std::filesystem::temp_directory_path() / "erebos-test-file-size.txt";
+    std::ofstream {path, std::ios::trunc} << "Hello";
+    const auto file = erebos::platform::File {path, erebos::platform::AccessMode::READ};
+    ASSERT_EQ(*file.get_file_size(), 5);
+
+    // Writes through other handles don't invalidate the cached metadata, but the size and the mapping must see them
+    std::ofstream {path, std::ios::app} << ", World!";
+    ASSERT_EQ(*file.get_file_size(), 13);
+    const auto mapping = file.map_into_memory();
+    ASSERT_TRUE(mapping);
+    ASSERT_EQ(mapping->get_size(), 13);
+    std::filesystem::remove(path);
+}
+
+TEST(erebos_platform_File, read_metadata_of_many_files) {
+    const auto directory = std::filesystem::temp_directory_path() / "erebos-test-file-metadata";
+    std::filesystem::create_directories(directory);
+    std::vector<std::filesystem::path> paths {};
+    for(erebos::usize i = 0; i < 4; i++) {
+        paths.push_back(directory / fmt::format("file-{}.txt", i));
+        std::ofstream {paths.back(), std::ios::trunc} << std::string(i * 10, 'x');
+    }
+    paths.push_back(directory / "missing.txt");
+
+    const auto metadata = erebos::platform::read_metadata(paths);
+    ASSERT_EQ(metadata.size(), paths.size());
+    for(erebos::usize i = 0; i < 4; i++) {
+        ASSERT_TRUE(metadata[i]);
+        ASSERT_EQ(metadata[i]->size, i * 10);
+    }
+    ASSERT_TRUE(metadata.back().is_error());
+    std::filesystem::remove_all(directory);
+}
+
+TEST(erebos_platform_File, read_at_offset) {
+    const auto path = std::filesystem::temp_directory_path() / "erebos-test-file-read-at.txt";
+    std::ofstream {path, std::ios::trunc} << "Hello, World!";
+    const auto file = erebos::platform::File {path, erebos::platform::AccessMode::READ};
+    std::array<erebos::u8, 8> buffer {};
+    const auto read_size = file.read_at(buffer, 7);
+    ASSERT_TRUE(read_size);
+    ASSERT_EQ(*read_size, 6);
+    ASSERT_EQ(std::string_view(reinterpret_cast<const char*>(buffer.data()), *read_size), "World!");
+    ASSERT_EQ(*file.read_at(buffer, 13), 0);
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,92 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include <erebos/frame_scheduler.hpp>
+#include <gtest/gtest.h>
+
+namespace {
+    [[nodiscard]] auto make_window_event(const Uint8 window_event) noexcept -> SDL_Event {
+        SDL_Event event {};
+        event.type = SDL_WINDOWEVENT;
+        event.window.event = window_event;
+        return event;
+    }
+}// namespace
+
+TEST(erebos_FrameScheduler, activity_frame_rates) {
+    using namespace std::chrono_literals;
+    erebos::FrameScheduler scheduler {{100, 20, std::nullopt}};
+    ASSERT_EQ(scheduler.get_frame_interval(), 10ms);
+
+    scheduler.handle_event(make_window_event(SDL_WINDOWEVENT_FOCUS_LOST));
+    ASSERT_EQ(scheduler.get_activity(), erebos::WindowActivity::UNFOCUSED);
+    ASSERT_EQ(scheduler.get_frame_interval(), 50ms);
+
+    scheduler.handle_event(make_window_event(SDL_WINDOWEVENT_MINIMIZED));
+    ASSERT_EQ(scheduler.get_activity(), erebos::WindowActivity::MINIMIZED);
+    ASSERT_FALSE(scheduler.get_frame_interval().has_value());
+    ASSERT_EQ(scheduler.get_event_wait_timeout(erebos::FrameScheduler::Clock::now()), erebos::FrameScheduler::MAX_IDLE_TIMEOUT);
+
+    scheduler.handle_event(make_window_event(SDL_WINDOWEVENT_RESTORED));
+    scheduler.handle_event(make_window_event(SDL_WINDOWEVENT_FOCUS_GAINED));
+    ASSERT_EQ(scheduler.get_activity(), erebos::WindowActivity::FOCUSED);
+    ASSERT_EQ(scheduler.get_frame_interval(), 10ms);
+}
+
+TEST(erebos_FrameScheduler, event_wait_timeout) {
+    using namespace std::chrono_literals;
+    erebos::FrameScheduler scheduler {{50, 10, std::nullopt}};
+    const auto start = erebos::FrameScheduler::Clock::now() + 1h;
+    scheduler.schedule_next_frame(start);
+    ASSERT_EQ(scheduler.get_next_frame_time(), start + 20ms);
+
+    // The precise wait before the frame isn't part of the timeout
+    const auto timeout = scheduler.get_event_wait_timeout(start);
+    ASSERT_GT(timeout, 0ms);
+    ASSERT_LT(timeout, 20ms);
+    ASSERT_EQ(scheduler.get_event_wait_timeout(start + 20ms), 0ms);
+
+    // An uncapped frame rate never waits
+    erebos::FrameScheduler uncapped_scheduler {{0, 10, std::nullopt}};
+    uncapped_scheduler.schedule_next_frame(start);
+    ASSERT_EQ(uncapped_scheduler.get_event_wait_timeout(start), 0ms);
+}
+
+TEST(erebos_FrameScheduler, no_catch_up_burst) {
+    using namespace std::chrono_literals;
+    erebos::FrameScheduler scheduler {{100, 10, std::nullopt}};
+    const auto start = erebos::FrameScheduler::Clock::now() + 1h;
+    scheduler.schedule_next_frame(start);
+    scheduler.schedule_next_frame(start + 5ms);
+    ASSERT_EQ(scheduler.get_next_frame_time(), start + 20ms);
+
+    // After a stall of multiple frames, the schedule continues from the stalled frame
+    scheduler.schedule_next_frame(start + 75ms);
+    ASSERT_EQ(scheduler.get_next_frame_time(), start + 85ms);
+}
+
+TEST(erebos_FrameScheduler, wait_until) {
+    using namespace std::chrono_literals;
+    erebos::FrameScheduler scheduler {};
+    for(auto i = 0; i < 4; i++) {
+        const auto deadline = erebos::FrameScheduler::Clock::now() + 3ms;
+        scheduler.wait_until(deadline);
+        ASSERT_GE(erebos::FrameScheduler::Clock::now(), deadline);
+    }
+}
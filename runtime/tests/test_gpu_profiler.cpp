@@ -0,0 +1,157 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include "headless_device.hpp"
+#include <erebos/render/vulkan/frame.hpp>
+#include <erebos/render/vulkan/gpu_profiler.hpp>
+#include <limits>
+
+TEST(erebos_render_vulkan_GpuProfiler, timestamp_delta_wraps_around) {
+    using erebos::render::vulkan::detail::get_timestamp_delta;
+    ASSERT_EQ(get_timestamp_delta(110, 100, 64), 10);
+    ASSERT_EQ(get_timestamp_delta(100, 110, 64), -10);
+    ASSERT_EQ(get_timestamp_delta(4, std::numeric_limits<erebos::u64>::max() - 5, 64), 10);
+
+    // A 36-bit counter wraps from 2^36 - 6 to 4, the bits above the valid bits are ignored
+    constexpr auto counter_end = erebos::u64 {1} << 36U;
+    ASSERT_EQ(get_timestamp_delta(4, counter_end - 6, 36), 10);
+    ASSERT_EQ(get_timestamp_delta(counter_end - 6, 4, 36), -10);
+    ASSERT_EQ(get_timestamp_delta((erebos::u64 {0xFF} << 36U) | 20, 10, 36), 10);
+}
+
+class erebos_render_vulkan_GpuProfilerDevice : public erebos::tests::HeadlessDeviceTest {
+protected:
+    std::unique_ptr<erebos::render::vulkan::Frame> _frame {};
+
+    auto SetUp() -> void override {
+        HeadlessDeviceTest::SetUp();
+        if(IsSkipped()) {
+            return;
+        }
+        _frame = std::make_unique<erebos::render::vulkan::Frame>(*_device);
+    }
+
+    auto TearDown() -> void override {
+        if(_device != nullptr) {
+            ::vkDeviceWaitIdle(**_device);
+        }
+        _frame.reset();
+    }
+
+    // Begins the frame and returns a command buffer of the direct queue, which is in the recording state
+    [[nodiscard]] auto begin_command_buffer() -> erebos::render::vulkan::CommandBuffer* {
+        if(!_frame->begin_frame()) {
+            return nullptr;
+        }
+
+        const auto command_buffer = _frame->get_queue_frames()[0].acquire_command_buffer();
+        if(!command_buffer || !(*command_buffer)->begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT)) {
+            return nullptr;
+        }
+        return *command_buffer;
+    }
+
+    // Records the commands of the function into a command buffer, submits it and waits for the submission
+    template<typename F>
+    auto submit(F&& record) -> void {
+        const auto command_buffer = begin_command_buffer();
+        ASSERT_NE(command_buffer, nullptr);
+        record(*command_buffer);
+        ASSERT_TRUE(command_buffer->end());
+        ASSERT_TRUE(_frame->submit(false));
+        ASSERT_TRUE(_frame->get_queue_submit_fence().wait());
+    }
+};
+
+TEST_F(erebos_render_vulkan_GpuProfilerDevice, read_back_sorts_scopes_by_begin) {
+    auto profiler = erebos::render::vulkan::GpuProfiler {*_device, _device->get_direct_queue()};
+    if(!profiler.is_enabled()) {
+        GTEST_SKIP() << "The direct queue doesn't support timestamps";
+    }
+
+    submit([&](const erebos::render::vulkan::CommandBuffer& command_buffer) {
+        const auto outer_scope = profiler.begin_scope(command_buffer, "Outer");
+        const auto inner_scope = profiler.begin_scope(command_buffer, "Inner", 7);
+        profiler.end_scope(command_buffer, inner_scope);
+        profiler.end_scope(command_buffer, outer_scope);
+        const erebos::render::vulkan::GpuScope last_scope {profiler, command_buffer, "Last"};
+    });
+    ASSERT_FALSE(HasFatalFailure());
+    ASSERT_TRUE(profiler.read_back());
+
+    const auto& timings = profiler.get_timings();
+    ASSERT_EQ(timings.size(), 3);
+    ASSERT_EQ(timings[0].name, "Outer");
+    ASSERT_EQ(timings[0].depth, 0);
+    ASSERT_EQ(timings[1].name, "Inner");
+    ASSERT_EQ(timings[1].depth, 1);
+    ASSERT_EQ(timings[1].index, 7);
+    ASSERT_EQ(timings[2].name, "Last");
+    ASSERT_EQ(timings[2].depth, 0);
+    for(erebos::usize i = 0; i < timings.size(); i++) {
+        ASSERT_LE(timings[i].begin, timings[i].end);
+        if(i > 0) {
+            ASSERT_LE(timings[i - 1].begin, timings[i].begin);
+        }
+    }
+    ASSERT_GE(profiler.get_frame_duration(), timings[0].get_duration());
+}
+
+TEST_F(erebos_render_vulkan_GpuProfilerDevice, read_back_drops_ignored_and_unsubmitted_scopes) {
+    auto profiler = erebos::render::vulkan::GpuProfiler {*_device, _device->get_direct_queue(), 2};
+    if(!profiler.is_enabled()) {
+        GTEST_SKIP() << "The direct queue doesn't support timestamps";
+    }
+
+    // The third scope doesn't fit into the query pool and is ignored
+    submit([&](const erebos::render::vulkan::CommandBuffer& command_buffer) {
+        const auto first_scope = profiler.begin_scope(command_buffer, "First");
+        const auto second_scope = profiler.begin_scope(command_buffer, "Second");
+        const auto ignored_scope = profiler.begin_scope(command_buffer, "Ignored");
+        EXPECT_EQ(ignored_scope, erebos::render::vulkan::GpuProfiler::INVALID_SCOPE);
+        profiler.end_scope(command_buffer, ignored_scope);
+        profiler.end_scope(command_buffer, second_scope);
+        profiler.end_scope(command_buffer, first_scope);
+    });
+    ASSERT_FALSE(HasFatalFailure());
+    ASSERT_TRUE(profiler.read_back());
+    ASSERT_EQ(profiler.get_timings().size(), 2);
+    ASSERT_EQ(profiler.get_timings()[0].name, "First");
+    ASSERT_EQ(profiler.get_timings()[1].name, "Second");
+
+    // The queries of a command buffer, which is never submitted, are unavailable and their scope is dropped
+    const auto command_buffer = begin_command_buffer();
+    ASSERT_NE(command_buffer, nullptr);
+    const auto unsubmitted_scope = profiler.begin_scope(*command_buffer, "Unsubmitted");
+    ASSERT_NE(unsubmitted_scope, erebos::render::vulkan::GpuProfiler::INVALID_SCOPE);
+    profiler.end_scope(*command_buffer, unsubmitted_scope);
+    ASSERT_TRUE(command_buffer->end());
+    ASSERT_TRUE(profiler.read_back());
+    ASSERT_TRUE(profiler.get_timings().empty());
+    ASSERT_EQ(profiler.get_frame_duration(), 0);
+
+    // The read back resets the query pool, so the capacity is available again
+    submit([&](const erebos::render::vulkan::CommandBuffer& command_buffer) {
+        const erebos::render::vulkan::GpuScope scope {profiler, command_buffer, "Reused"};
+    });
+    ASSERT_FALSE(HasFatalFailure());
+    ASSERT_TRUE(profiler.read_back());
+    ASSERT_EQ(profiler.get_timings().size(), 1);
+    ASSERT_EQ(profiler.get_timings()[0].name, "Reused");
+}
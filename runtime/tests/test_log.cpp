@@ -0,0 +1,131 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include <erebos/log.hpp>
+#include <fmt/ranges.h>
+#include <gtest/gtest.h>
+#include <spdlog/sinks/ostream_sink.h>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace {
+    // Replaces the default logger with a logger writing only the messages into the stream
+    class ScopedStreamLogger final {
+        std::shared_ptr<spdlog::logger> _previous_logger;
+
+    public:
+        explicit ScopedStreamLogger(std::ostringstream& stream)
+            : _previous_logger {spdlog::default_logger()} {
+            erebos::log::flush();
+            auto logger = std::make_shared<spdlog::logger>("test", std::make_shared<spdlog::sinks::ostream_sink_st>(stream));
+            logger->set_pattern("%l %v");
+            logger->set_level(spdlog::level::info);
+            spdlog::set_default_logger(logger);
+        }
+
+        ~ScopedStreamLogger() noexcept {
+            erebos::log::flush();
+            spdlog::set_default_logger(_previous_logger);
+        }
+
+        ScopedStreamLogger(ScopedStreamLogger&& other) noexcept = delete;
+        EREBOS_DELETE_COPY(ScopedStreamLogger);
+    };
+
+    struct Extent final {
+        erebos::u32 width;
+        erebos::u32 height;
+    };
+}// namespace
+
+template<>
+struct fmt::formatter<Extent> : fmt::formatter<std::string_view> {
+    auto format(const Extent& extent, fmt::format_context& context) const {
+        return fmt::format_to(context.out(), "{}x{}", extent.width, extent.height);
+    }
+};
+
+TEST(erebos_log, arguments_are_copied_into_record) {
+    std::ostringstream stream {};
+    {
+        const ScopedStreamLogger logger {stream};
+        {
+            std::string path {"assets/shader.hlsl"};
+            std::vector<int> values {1, 2, 3};
+            EREBOS_LOG_INFO("Received {} event about '{}' ({}, {:.2f}, {}, {:>4})", "modify", path, Extent {640, 480}, 1.5, true, 7);
+            path.assign(path.size(), 'x');
+        }
+        EREBOS_LOG_DEBUG("Filtered by level {}", 1);
+        EREBOS_LOG_ERROR("No arguments");
+    }
+    ASSERT_EQ(stream.str(), "info Received modify event about 'assets/shader.hlsl' (640x480, 1.50, true,    7)\nerror No arguments\n");
+}
+
+TEST(erebos_log, long_strings_are_written_completely) {
+    std::ostringstream stream {};
+    {
+        const ScopedStreamLogger logger {stream};
+        const std::string value(2 * erebos::log::LOG_RECORD_PAYLOAD_SIZE, 'a');
+        EREBOS_LOG_WARN("{} {}", value, 42);
+        EREBOS_LOG_WARN("{}", value.substr(0, erebos::log::LOG_RECORD_PAYLOAD_SIZE - sizeof(erebos::u32)));
+    }
+
+    const auto message = stream.str();
+    const std::string payload_value(erebos::log::LOG_RECORD_PAYLOAD_SIZE - sizeof(erebos::u32), 'a');
+    ASSERT_EQ(message, fmt::format("warning {} 42\nwarning {}\n", std::string(2 * erebos::log::LOG_RECORD_PAYLOAD_SIZE, 'a'), payload_value));
+}
+
+TEST(erebos_log, views_are_formatted_on_calling_thread) {
+    std::ostringstream stream {};
+    {
+        const ScopedStreamLogger logger {stream};
+        {
+            std::vector<int> values {1, 2, 3};
+            EREBOS_LOG_INFO("Values {}", fmt::join(values, ", "));
+            values.assign({7, 7, 7});
+        }
+    }
+    ASSERT_EQ(stream.str(), "info Values 1, 2, 3\n");
+}
+
+TEST(erebos_log, records_of_all_threads_are_written) {
+    std::ostringstream stream {};
+    {
+        const ScopedStreamLogger logger {stream};
+        std::vector<std::thread> threads {};
+        for(erebos::u32 thread = 0; thread < 4; thread++) {
+            threads.emplace_back([thread]() {
+                for(erebos::u32 i = 0; i < 256; i++) {
+                    EREBOS_LOG_INFO("Thread {} message {}", thread, i);
+                    if(i % 64 == 0) {
+                        erebos::log::flush();
+                    }
+                }
+            });
+        }
+        for(auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    const auto dropped_record_count = erebos::log::get_dropped_record_count();
+    const auto message = stream.str();
+    ASSERT_EQ(static_cast<erebos::usize>(std::count(message.begin(), message.end(), '\n')) + dropped_record_count, 4 * 256);
+}
@@ -0,0 +1,95 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include <erebos/memory/linear_arena.hpp>
+#include <erebos/memory/pool_allocator.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(erebos_memory_LinearArena, reuse_after_reset) {
+    erebos::memory::LinearArena arena {256};
+    for(auto frame = 0; frame < 4; frame++) {
+        std::pmr::vector<erebos::u32> values {&arena};
+        for(erebos::u32 i = 0; i < 1024; i++) {
+            values.push_back(i);
+        }
+        ASSERT_EQ(values[1023], 1023);
+        arena.reset();
+    }
+
+    // The capacity only grows while the arena is warming up
+    const auto capacity = arena.get_statistics().capacity;
+    {
+        std::pmr::vector<erebos::u32> values {&arena};
+        for(erebos::u32 i = 0; i < 1024; i++) {
+            values.push_back(i);
+        }
+    }
+    ASSERT_EQ(arena.get_statistics().capacity, capacity);
+}
+
+TEST(erebos_memory_LinearArena, statistics_are_reset_per_frame) {
+    erebos::memory::LinearArena arena {4096};
+    [[maybe_unused]] auto* large = arena.allocate(2048);
+    ASSERT_GE(arena.get_statistics().peak_bytes, 2048);
+    arena.reset();
+
+    [[maybe_unused]] auto* small = arena.allocate(64);
+    ASSERT_EQ(arena.get_statistics().allocation_count, 1);
+    ASSERT_LT(arena.get_statistics().peak_bytes, 2048);
+    ASSERT_EQ(arena.get_statistics().peak_bytes, arena.get_statistics().allocated_bytes);
+}
+
+TEST(erebos_memory_LinearArena, alignment) {
+    erebos::memory::LinearArena arena {};
+    [[maybe_unused]] auto* first = arena.allocate(1, 1);
+    auto* second = arena.allocate(64, 64);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(second) % 64, 0);
+}
+
+TEST(erebos_memory_ScopedArena, rewind) {
+    erebos::memory::LinearArena arena {};
+    [[maybe_unused]] auto* persistent = arena.allocate(128);
+    const auto allocated_bytes = arena.get_statistics().allocated_bytes;
+    {
+        erebos::memory::ScopedArena scoped_arena {arena};
+        std::pmr::vector<erebos::u8> values {4096, &scoped_arena};
+        ASSERT_GT(arena.get_statistics().allocated_bytes, allocated_bytes);
+    }
+    ASSERT_EQ(arena.get_statistics().allocated_bytes, allocated_bytes);
+}
+
+TEST(erebos_memory_PoolAllocator, reuse_blocks) {
+    erebos::memory::PoolAllocator pool {48, 4};
+    std::vector<void*> blocks {};
+    for(auto i = 0; i < 8; i++) {
+        blocks.push_back(pool.allocate(48));
+    }
+    ASSERT_EQ(pool.get_statistics().capacity, 8 * pool.get_block_size());
+
+    auto* freed_block = blocks.back();
+    pool.deallocate(freed_block, 48);
+    ASSERT_EQ(pool.allocate(48), freed_block);
+    ASSERT_EQ(pool.get_statistics().capacity, 8 * pool.get_block_size());
+
+    // Oversized allocations are forwarded to the upstream resource
+    auto* oversized = pool.allocate(4096);
+    pool.deallocate(oversized, 4096);
+    ASSERT_EQ(pool.get_statistics().allocation_count, 9);
+}
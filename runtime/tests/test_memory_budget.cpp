@@ -0,0 +1,172 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include "headless_device.hpp"
+#include <erebos/render/vulkan/memory_budget.hpp>
+#include <gtest/gtest.h>
+
+using namespace erebos::render::vulkan;
+
+TEST(erebos_render_vulkan_MemoryBudgetManager, pressure_levels) {
+    MemoryBudgetManager budget_manager {{1000}};
+    ASSERT_EQ(*budget_manager.get_pressure(0), MemoryPressure::LOW);
+
+    const auto handle = budget_manager.register_resource(0, 800, [](void*) {}, nullptr);
+    ASSERT_TRUE(handle);
+    budget_manager.update();
+    ASSERT_EQ(budget_manager.get_heap_budgets()[0].usage, 800);
+    ASSERT_EQ(*budget_manager.get_pressure(0), MemoryPressure::MEDIUM);
+
+    budget_manager.set_budget_override(0, 820);
+    ASSERT_EQ(*budget_manager.get_pressure(0), MemoryPressure::CRITICAL);
+    budget_manager.set_budget_override(0, {});
+    budget_manager.unregister_resource(*handle);
+    budget_manager.update();
+    ASSERT_EQ(*budget_manager.get_pressure(0), MemoryPressure::LOW);
+}
+
+TEST(erebos_render_vulkan_MemoryBudgetManager, evict_least_recently_used) {
+    MemoryBudgetManager budget_manager {{1000, 1000}};
+    std::vector<int> evicted_resources {};
+    const auto evict = [&](void* data) {
+        evicted_resources.push_back(*static_cast<int*>(data));
+    };
+
+    std::array<int, 4> resource_ids {0, 1, 2, 3};
+    std::array<StreamingResourceHandle, 3> handles {};
+    for(auto i = 0; i < 3; i++) {
+        const auto handle = budget_manager.register_resource(0, 300, evict, &resource_ids[i]);
+        ASSERT_TRUE(handle);
+        handles[i] = *handle;
+        budget_manager.update();
+    }
+    ASSERT_TRUE(budget_manager.register_resource(1, 900, evict, &resource_ids[3]));
+
+    // Resource 0 was used recently, so resource 1 is the least recently used one
+    budget_manager.touch(handles[0]);
+    budget_manager.update();
+    ASSERT_TRUE(budget_manager.ensure_budget(0, 200));
+    ASSERT_EQ(evicted_resources, std::vector<int> {1});
+    ASSERT_EQ(budget_manager.get_evicted_resource_count(), 1);
+
+    // Resources used in the current frame are never evicted
+    budget_manager.touch(handles[0]);
+    budget_manager.touch(handles[2]);
+    ASSERT_TRUE(budget_manager.ensure_budget(0, 500).is_error());
+    ASSERT_EQ(evicted_resources.size(), 1);
+
+    budget_manager.update();
+    ASSERT_TRUE(budget_manager.ensure_budget(0, 1000));
+    ASSERT_EQ(evicted_resources, (std::vector<int> {1, 0, 2}));
+    ASSERT_EQ(budget_manager.get_streaming_resource_count(), 1);
+}
+
+TEST(erebos_render_vulkan_MemoryBudgetManager, invalid_heap_index_is_rejected) {
+    MemoryBudgetManager budget_manager {{1000, 1000}};
+    ASSERT_TRUE(budget_manager.register_resource(2, 100, [](void*) {}, nullptr).is_error());
+    ASSERT_EQ(budget_manager.get_streaming_resource_count(), 0);
+    budget_manager.update();
+
+    ASSERT_EQ(*budget_manager.get_heap_index(1), 1);
+    ASSERT_TRUE(budget_manager.get_heap_index(2).is_error());
+    ASSERT_TRUE(budget_manager.get_pressure(2).is_error());
+    ASSERT_TRUE(budget_manager.ensure_budget(2, 100).is_error());
+}
+
+class erebos_render_vulkan_MemoryBudgetManagerDevice : public erebos::tests::HeadlessDeviceTest {};
+
+TEST_F(erebos_render_vulkan_MemoryBudgetManagerDevice, evict_until_freed_bytes_cover_allocation) {
+    constexpr VkDeviceSize buffer_size = 64 * 1024;
+    constexpr VkDeviceSize block_size = 8 * buffer_size;
+    const auto allocator = _device->get_allocator();
+
+    VkBufferCreateInfo buffer_create_info {};
+    buffer_create_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buffer_create_info.size = buffer_size;
+    buffer_create_info.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    buffer_create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    VmaAllocationCreateInfo allocation_create_info {};
+    allocation_create_info.usage = VMA_MEMORY_USAGE_AUTO;
+
+    // All buffers fill a single block of the pool, so evicting them doesn't lower the usage reported by VMA
+    VmaPoolCreateInfo pool_create_info {};
+    pool_create_info.blockSize = block_size;
+    pool_create_info.maxBlockCount = 1;
+    ASSERT_EQ(::vmaFindMemoryTypeIndexForBufferInfo(allocator, &buffer_create_info, &allocation_create_info, &pool_create_info.memoryTypeIndex),
+              VK_SUCCESS);
+    VmaPool pool = nullptr;
+    ASSERT_EQ(::vmaCreatePool(allocator, &pool_create_info, &pool), VK_SUCCESS);
+    allocation_create_info.pool = pool;
+
+    struct StreamingBuffer final {
+        VmaAllocator allocator;
+        VkBuffer buffer;
+        VmaAllocation allocation;
+    };
+
+    MemoryBudgetManager budget_manager {allocator};
+    const auto heap_index_result = budget_manager.get_heap_index(pool_create_info.memoryTypeIndex);
+    ASSERT_TRUE(heap_index_result);
+    const auto heap_index = *heap_index_result;
+    std::array<StreamingBuffer, 8> buffers {};
+    std::vector<erebos::usize> evicted_buffers {};
+    for(erebos::usize i = 0; i < buffers.size(); i++) {
+        buffers[i].allocator = allocator;
+        ASSERT_EQ(::vmaCreateBuffer(allocator, &buffer_create_info, &allocation_create_info, &buffers[i].buffer, &buffers[i].allocation, nullptr),
+                  VK_SUCCESS);
+        const auto evict = [&evicted_buffers, i](void* data) {
+            auto* streaming_buffer = static_cast<StreamingBuffer*>(data);
+            ::vmaDestroyBuffer(streaming_buffer->allocator, streaming_buffer->buffer, streaming_buffer->allocation);
+            streaming_buffer->buffer = nullptr;
+            evicted_buffers.push_back(i);
+        };
+        ASSERT_TRUE(budget_manager.register_resource(heap_index, buffer_size, evict, &buffers[i]));
+        budget_manager.update();
+    }
+
+    // The budget leaves room for two buffers, so the four buffers require the eviction of the two oldest buffers
+    const auto usage = budget_manager.get_heap_budgets()[heap_index].usage;
+    budget_manager.set_budget_override(heap_index, usage + 2 * buffer_size);
+    ASSERT_TRUE(budget_manager.ensure_budget(heap_index, 4 * buffer_size));
+    ASSERT_EQ(evicted_buffers, (std::vector<erebos::usize> {0, 1}));
+    ASSERT_EQ(budget_manager.get_evicted_resource_count(), 2);
+    ASSERT_EQ(budget_manager.get_streaming_resource_count(), buffers.size() - 2);
+    ASSERT_EQ(budget_manager.get_heap_budgets()[heap_index].usage, usage);
+
+    // The pool has no other block, so the planned allocations only fit into the space of the evicted buffers
+    std::array<StreamingBuffer, 2> new_buffers {};
+    for(auto& new_buffer : new_buffers) {
+        ASSERT_EQ(::vmaCreateBuffer(allocator, &buffer_create_info, &allocation_create_info, &new_buffer.buffer, &new_buffer.allocation, nullptr),
+                  VK_SUCCESS);
+    }
+
+    // The remaining candidates can't cover the request, so nothing is evicted
+    ASSERT_TRUE(budget_manager.ensure_budget(heap_index, 16 * buffer_size).is_error());
+    ASSERT_EQ(evicted_buffers.size(), 2);
+
+    for(const auto& buffer : buffers) {
+        if(buffer.buffer != nullptr) {
+            ::vmaDestroyBuffer(allocator, buffer.buffer, buffer.allocation);
+        }
+    }
+    for(const auto& new_buffer : new_buffers) {
+        ::vmaDestroyBuffer(allocator, new_buffer.buffer, new_buffer.allocation);
+    }
+    ::vmaDestroyPool(allocator, pool);
+}
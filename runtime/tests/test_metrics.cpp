@@ -0,0 +1,141 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include <erebos/metrics.hpp>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <vector>
+
+namespace {
+    [[nodiscard]] auto read_file(const std::filesystem::path& path) -> std::string {
+        std::ifstream stream {path};
+        std::stringstream content {};
+        content << stream.rdbuf();
+        return content.str();
+    }
+
+    [[nodiscard]] auto make_sample(const erebos::u64 frame_index, const erebos::u32 frame_time_ms) -> erebos::metrics::FrameSample {
+        erebos::metrics::FrameSample sample {};
+        sample.frame_index = frame_index;
+        sample.frame_time = std::chrono::milliseconds {frame_time_ms};
+        sample.cpu_time = std::chrono::milliseconds {2};
+        sample.gpu_time = std::chrono::milliseconds {1};
+        sample.command_buffer_count = 2;
+        sample.submit_count = 1;
+        sample.uploaded_bytes = 1024;
+        return sample;
+    }
+}// namespace
+
+TEST(erebos_metrics, percentiles_use_nearest_rank) {
+    std::vector<int64_t> values {};
+    for(int64_t i = 100; i > 0; i--) {
+        values.push_back(i);
+    }
+    ASSERT_EQ(erebos::metrics::compute_percentile(values, 50.0), 50);
+    ASSERT_EQ(erebos::metrics::compute_percentile(values, 95.0), 95);
+    ASSERT_EQ(erebos::metrics::compute_percentile(values, 99.0), 99);
+    ASSERT_EQ(erebos::metrics::compute_percentile(values, 0.0), 1);
+    ASSERT_EQ(erebos::metrics::compute_percentile(values, 100.0), 100);
+
+    std::vector<int64_t> single_value {42};
+    ASSERT_EQ(erebos::metrics::compute_percentile(single_value, 99.0), 42);
+}
+
+TEST(erebos_metrics, histogram_percentiles_are_within_one_percent) {
+    erebos::metrics::detail::PercentileHistogram histogram {};
+    ASSERT_EQ(histogram.compute_percentile(50.0), 0);
+
+    // Frame times between 1 microsecond and 100 milliseconds
+    std::vector<int64_t> frame_times {};
+    for(int64_t i = 1; i <= 100'000; i++) {
+        frame_times.push_back(i * 1'000 + 17);
+        histogram.add(frame_times.back());
+    }
+    ASSERT_EQ(histogram.get_count(), frame_times.size());
+    for(const auto percentile : {0.0, 50.0, 95.0, 99.0, 100.0}) {
+        const auto exact_value = erebos::metrics::compute_percentile(frame_times, percentile);
+        ASSERT_NEAR(histogram.compute_percentile(percentile), exact_value, exact_value / 100);
+    }
+
+    // Small values have their own bucket and negative values are counted as zero
+    erebos::metrics::detail::PercentileHistogram small_histogram {};
+    small_histogram.add(-5);
+    for(int64_t i = 1; i < 100; i++) {
+        small_histogram.add(i);
+    }
+    ASSERT_EQ(small_histogram.compute_percentile(0.0), 0);
+    ASSERT_EQ(small_histogram.compute_percentile(50.0), 49);
+    ASSERT_EQ(small_histogram.compute_percentile(100.0), 99);
+}
+
+TEST(erebos_metrics, summary_covers_only_window) {
+    erebos::metrics::FrameMetrics metrics {4};
+    ASSERT_EQ(metrics.get_summary().sample_count, 0);
+    metrics.add_sample(make_sample(0, 100));
+    for(erebos::u32 i = 1; i <= 4; i++) {
+        metrics.add_sample(make_sample(i, i * 10));
+    }
+
+    const auto summary = metrics.get_summary();
+    ASSERT_EQ(summary.sample_count, 4);
+    ASSERT_EQ(metrics.get_last_sample().frame_index, 4);
+    ASSERT_DOUBLE_EQ(summary.frame_time_p50, 20.0);
+    ASSERT_DOUBLE_EQ(summary.frame_time_p99, 40.0);
+    ASSERT_DOUBLE_EQ(summary.average_cpu_time, 2.0);
+    ASSERT_DOUBLE_EQ(summary.average_gpu_time, 1.0);
+    ASSERT_DOUBLE_EQ(summary.average_command_buffer_count, 2.0);
+    ASSERT_DOUBLE_EQ(summary.average_submit_count, 1.0);
+
+    // 4 KiB uploaded in 100 milliseconds
+    ASSERT_DOUBLE_EQ(summary.upload_bandwidth, 40960.0);
+}
+
+TEST(erebos_metrics, writer_writes_csv_and_json) {
+    const auto csv_path = std::filesystem::temp_directory_path() / "erebos-test-metrics.csv";
+    const auto json_path = std::filesystem::temp_directory_path() / "erebos-test-metrics.JSON";
+    {
+        erebos::metrics::MetricsWriter csv_writer {csv_path};
+        erebos::metrics::MetricsWriter json_writer {json_path};
+        ASSERT_EQ(csv_writer.get_format(), erebos::metrics::MetricsFormat::CSV);
+        ASSERT_EQ(json_writer.get_format(), erebos::metrics::MetricsFormat::JSON);
+        for(erebos::u32 i = 0; i < 3; i++) {
+            csv_writer.write_sample(make_sample(i, 16));
+            json_writer.write_sample(make_sample(i, 16));
+        }
+        ASSERT_EQ(json_writer.get_summary().sample_count, 3);
+    }
+
+    const auto csv = read_file(csv_path);
+    const auto json = read_file(json_path);
+    std::filesystem::remove(csv_path);
+    std::filesystem::remove(json_path);
+    ASSERT_EQ(std::count(csv.begin(), csv.end(), '\n'), 4);
+    ASSERT_TRUE(csv.starts_with("frame_index,frame_time_ms,"));
+    ASSERT_NE(csv.find("\n2,16.0000,2.0000,1.0000,2,1,0,0,0,0,1024\n"), std::string::npos);
+    ASSERT_TRUE(json.starts_with("{\"samples\":[\n{\"frame_index\":0,"));
+    ASSERT_NE(json.find("},\n{\"frame_index\":1,"), std::string::npos);
+    ASSERT_NE(json.find("],\"summary\":{\"sample_count\":3,\"frame_time_p50_ms\":16.0000,"), std::string::npos);
+    ASSERT_TRUE(json.ends_with("}}\n"));
+}
+
+TEST(erebos_metrics, writer_throws_on_invalid_path) {
+    ASSERT_THROW(erebos::metrics::MetricsWriter {std::filesystem::path {"/nonexistent-directory/metrics.csv"}}, std::runtime_error);
+}
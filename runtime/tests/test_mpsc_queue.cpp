@@ -0,0 +1,60 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include "queue_test.hpp"
+#include <array>
+#include <erebos/mpsc_queue.hpp>
+#include <gtest/gtest.h>
+
+TEST(erebos_MPSCQueue, full_and_empty) {
+    erebos::MPSCQueue<erebos::u32, 4> queue {};
+    ASSERT_FALSE(queue.try_pop().has_value());
+    for(erebos::u32 i = 0; i < 4; i++) {
+        ASSERT_TRUE(queue.try_push(i));
+    }
+    ASSERT_FALSE(queue.try_push(4));
+
+    // The freed slot is reused after the indices wrapped around
+    ASSERT_EQ(queue.try_pop(), 0);
+    ASSERT_TRUE(queue.try_push(4));
+    for(erebos::u32 i = 1; i < 5; i++) {
+        ASSERT_EQ(queue.try_pop(), i);
+    }
+    ASSERT_FALSE(queue.try_pop().has_value());
+}
+
+TEST(erebos_MPSCQueue, preserves_order_of_each_producer) {
+    constexpr erebos::u64 producer_count = 4;
+    constexpr erebos::u64 value_count = 25'000;
+    erebos::MPSCQueue<erebos::u64, 256> queue {};
+
+    std::array<erebos::u64, producer_count> expected_values {};
+    const auto consumed_count = erebos::tests::run_producers(queue, producer_count, value_count, [&](const erebos::u64 value) {
+        const auto producer = value >> 32U;
+        EXPECT_LT(producer, producer_count);
+        if(producer >= producer_count) {
+            return false;
+        }
+
+        EXPECT_EQ(value & 0xFFFFFFFFU, expected_values[producer]);
+        return (value & 0xFFFFFFFFU) == expected_values[producer]++;
+    });
+    ASSERT_EQ(consumed_count, producer_count * value_count);
+    ASSERT_FALSE(queue.try_pop().has_value());
+}
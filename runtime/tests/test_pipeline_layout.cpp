@@ -0,0 +1,180 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include "headless_device.hpp"
+#include <array>
+#include <erebos/render/vulkan/pipeline_layout.hpp>
+#include <gtest/gtest.h>
+
+using namespace erebos::render::vulkan;
+
+namespace {
+    // SPIR-V 1.0 compute shader (local size 1x1x1) with an empty main function, which declares the following resources:
+    //   set 0, binding 0: uniform buffer (struct { vec4 })
+    //   set 0, binding 1: sampler2D[4]
+    //   set 1, binding 0: storage buffer (struct { vec4 })
+    //   push constants:   struct { vec4 (offset 0); vec4 (offset 16) }
+    constexpr std::array<erebos::u32, 161> COMPUTE_SHADER {
+        0x07230203, 0x00010000, 0x00000000, 0x00000017, 0x00000000, 0x00020011, 0x00000001, 0x0003000E,
+        0x00000000, 0x00000001, 0x0005000F, 0x00000005, 0x00000015, 0x6E69616D, 0x00000000, 0x00060010,
+        0x00000015, 0x00000011, 0x00000001, 0x00000001, 0x00000001, 0x00030047, 0x00000005, 0x00000002,
+        0x00050048, 0x00000005, 0x00000000, 0x00000023, 0x00000000, 0x00040047, 0x00000007, 0x00000022,
+        0x00000000, 0x00040047, 0x00000007, 0x00000021, 0x00000000, 0x00040047, 0x0000000E, 0x00000022,
+        0x00000000, 0x00040047, 0x0000000E, 0x00000021, 0x00000001, 0x00030047, 0x0000000F, 0x00000003,
+        0x00050048, 0x0000000F, 0x00000000, 0x00000023, 0x00000000, 0x00040047, 0x00000011, 0x00000022,
+        0x00000001, 0x00040047, 0x00000011, 0x00000021, 0x00000000, 0x00030047, 0x00000012, 0x00000002,
+        0x00050048, 0x00000012, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000012, 0x00000001,
+        0x00000023, 0x00000010, 0x00020013, 0x00000001, 0x00030021, 0x00000002, 0x00000001, 0x00030016,
+        0x00000003, 0x00000020, 0x00040017, 0x00000004, 0x00000003, 0x00000004, 0x0003001E, 0x00000005,
+        0x00000004, 0x00040020, 0x00000006, 0x00000002, 0x00000005, 0x0004003B, 0x00000006, 0x00000007,
+        0x00000002, 0x00090019, 0x00000008, 0x00000003, 0x00000001, 0x00000000, 0x00000000, 0x00000000,
+        0x00000001, 0x00000000, 0x0003001B, 0x00000009, 0x00000008, 0x00040015, 0x0000000A, 0x00000020,
+        0x00000000, 0x0004002B, 0x0000000A, 0x0000000B, 0x00000004, 0x0004001C, 0x0000000C, 0x00000009,
+        0x0000000B, 0x00040020, 0x0000000D, 0x00000000, 0x0000000C, 0x0004003B, 0x0000000D, 0x0000000E,
+        0x00000000, 0x0003001E, 0x0000000F, 0x00000004, 0x00040020, 0x00000010, 0x00000002, 0x0000000F,
+        0x0004003B, 0x00000010, 0x00000011, 0x00000002, 0x0004001E, 0x00000012, 0x00000004, 0x00000004,
+        0x00040020, 0x00000013, 0x00000009, 0x00000012, 0x0004003B, 0x00000013, 0x00000014, 0x00000009,
+        0x00050036, 0x00000001, 0x00000015, 0x00000000, 0x00000002, 0x000200F8, 0x00000016, 0x000100FD,
+        0x00010038,
+    };
+}// namespace
+
+TEST(erebos_render_vulkan_PipelineLayout, merge_vertex_fragment) {
+    PipelineLayoutInfo vertex_layout {};
+    vertex_layout.sets.push_back({{{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT, nullptr}}});
+    vertex_layout.push_constant_ranges.push_back({VK_SHADER_STAGE_VERTEX_BIT, 0, 64});
+
+    PipelineLayoutInfo fragment_layout {};
+    fragment_layout.sets.push_back({{{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr},
+                                     {1, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 4, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr}}});
+    fragment_layout.sets.push_back({{{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr}}});
+    fragment_layout.push_constant_ranges.push_back({VK_SHADER_STAGE_FRAGMENT_BIT, 64, 16});
+
+    PipelineLayoutInfo merged_layout {};
+    ASSERT_TRUE(merge_pipeline_layouts(merged_layout, vertex_layout));
+    ASSERT_TRUE(merge_pipeline_layouts(merged_layout, fragment_layout));
+
+    ASSERT_EQ(merged_layout.sets.size(), 2);
+    const auto& first_set = merged_layout.sets[0].bindings;
+    ASSERT_EQ(first_set.size(), 2);
+    ASSERT_EQ(first_set[0].binding, 0);
+    ASSERT_EQ(first_set[0].stageFlags, VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT);
+    ASSERT_EQ(first_set[1].binding, 1);
+    ASSERT_EQ(first_set[1].descriptorCount, 4);
+    ASSERT_EQ(first_set[1].stageFlags, VK_SHADER_STAGE_FRAGMENT_BIT);
+    ASSERT_EQ(merged_layout.sets[1].bindings[0].descriptorType, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+
+    ASSERT_EQ(merged_layout.push_constant_ranges.size(), 1);
+    ASSERT_EQ(merged_layout.push_constant_ranges[0].stageFlags, VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT);
+    ASSERT_EQ(merged_layout.push_constant_ranges[0].offset, 0);
+    ASSERT_EQ(merged_layout.push_constant_ranges[0].size, 80);
+}
+
+TEST(erebos_render_vulkan_PipelineLayout, merge_conflicting_types) {
+    PipelineLayoutInfo vertex_layout {};
+    vertex_layout.sets.push_back({{{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT, nullptr}}});
+
+    PipelineLayoutInfo fragment_layout {};
+    fragment_layout.sets.push_back({{{0, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, 1, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr}}});
+
+    ASSERT_TRUE(merge_pipeline_layouts(vertex_layout, fragment_layout).is_error());
+}
+
+TEST(erebos_render_vulkan_PipelineLayout, merge_is_order_independent) {
+    PipelineLayoutInfo vertex_layout {};
+    vertex_layout.sets.push_back({{{2, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL_GRAPHICS, nullptr}}});
+
+    PipelineLayoutInfo fragment_layout {};
+    fragment_layout.sets.push_back({{{0, VK_DESCRIPTOR_TYPE_SAMPLER, 1, VK_SHADER_STAGE_ALL_GRAPHICS, nullptr}}});
+
+    PipelineLayoutInfo first_layout {};
+    ASSERT_TRUE(merge_pipeline_layouts(first_layout, vertex_layout));
+    ASSERT_TRUE(merge_pipeline_layouts(first_layout, fragment_layout));
+
+    PipelineLayoutInfo second_layout {};
+    ASSERT_TRUE(merge_pipeline_layouts(second_layout, fragment_layout));
+    ASSERT_TRUE(merge_pipeline_layouts(second_layout, vertex_layout));
+
+    ASSERT_TRUE(first_layout == second_layout);
+    ASSERT_EQ(DescriptorSetLayoutInfoHash {}(first_layout.sets[0]), DescriptorSetLayoutInfoHash {}(second_layout.sets[0]));
+}
+
+TEST(erebos_render_vulkan_PipelineLayout, reflect_bindings_and_push_constants) {
+    const auto layout_info = reflect_pipeline_layout(COMPUTE_SHADER);
+    ASSERT_TRUE(layout_info);
+    ASSERT_EQ(layout_info->sets.size(), 2);
+
+    const auto& first_set = layout_info->sets[0].bindings;
+    ASSERT_EQ(first_set.size(), 2);
+    ASSERT_EQ(first_set[0].binding, 0);
+    ASSERT_EQ(first_set[0].descriptorType, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
+    ASSERT_EQ(first_set[0].descriptorCount, 1);
+    ASSERT_EQ(first_set[0].stageFlags, VK_SHADER_STAGE_COMPUTE_BIT);
+    ASSERT_EQ(first_set[1].binding, 1);
+    ASSERT_EQ(first_set[1].descriptorType, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
+    ASSERT_EQ(first_set[1].descriptorCount, 4);
+    ASSERT_EQ(first_set[1].stageFlags, VK_SHADER_STAGE_COMPUTE_BIT);
+
+    const auto& second_set = layout_info->sets[1].bindings;
+    ASSERT_EQ(second_set.size(), 1);
+    ASSERT_EQ(second_set[0].binding, 0);
+    ASSERT_EQ(second_set[0].descriptorType, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+
+    ASSERT_EQ(layout_info->push_constant_ranges.size(), 1);
+    ASSERT_EQ(layout_info->push_constant_ranges[0].stageFlags, VK_SHADER_STAGE_COMPUTE_BIT);
+    ASSERT_EQ(layout_info->push_constant_ranges[0].offset, 0);
+    ASSERT_EQ(layout_info->push_constant_ranges[0].size, 32);
+}
+
+TEST(erebos_render_vulkan_PipelineLayout, reflect_invalid_module) {
+    constexpr std::array<erebos::u32, 5> invalid_module {0xDEADBEEF, 0x00010000, 0, 1, 0};
+    ASSERT_TRUE(reflect_pipeline_layout(invalid_module).is_error());
+}
+
+class erebos_render_vulkan_PipelineLayoutCache : public erebos::tests::HeadlessDeviceTest {};
+
+TEST_F(erebos_render_vulkan_PipelineLayoutCache, same_layout_hits_cache) {
+    auto& layout_cache = _device->get_pipeline_layout_cache();
+    const auto layout = layout_cache.get_pipeline_layout({std::span<const erebos::u32> {COMPUTE_SHADER}});
+    ASSERT_TRUE(layout);
+    const auto descriptor_set_layout_count = layout_cache.get_descriptor_set_layout_count();
+    const auto pipeline_layout_count = layout_cache.get_pipeline_layout_count();
+
+    // Reflecting the same module again and an equal description both return the cached layout
+    const auto reflected_layout = layout_cache.get_pipeline_layout({std::span<const erebos::u32> {COMPUTE_SHADER}});
+    ASSERT_TRUE(reflected_layout);
+    ASSERT_EQ(*reflected_layout, *layout);
+
+    const auto layout_info = reflect_pipeline_layout(COMPUTE_SHADER);
+    ASSERT_TRUE(layout_info);
+    const auto described_layout = layout_cache.get_pipeline_layout(*layout_info);
+    ASSERT_TRUE(described_layout);
+    ASSERT_EQ(*described_layout, *layout);
+    ASSERT_EQ(layout_cache.get_descriptor_set_layout_count(), descriptor_set_layout_count);
+    ASSERT_EQ(layout_cache.get_pipeline_layout_count(), pipeline_layout_count);
+
+    // A different push constant range creates a new pipeline layout, but shares the descriptor set layouts
+    auto changed_layout_info = *layout_info;
+    changed_layout_info.push_constant_ranges[0].size = 64;
+    const auto changed_layout = layout_cache.get_pipeline_layout(changed_layout_info);
+    ASSERT_TRUE(changed_layout);
+    ASSERT_NE(*changed_layout, *layout);
+    ASSERT_EQ(layout_cache.get_descriptor_set_layout_count(), descriptor_set_layout_count);
+    ASSERT_EQ(layout_cache.get_pipeline_layout_count(), pipeline_layout_count + 1);
+}
@@ -0,0 +1,144 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <erebos/plugin/plugin_module.hpp>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <thread>
+
+namespace {
+    // The plugin is copied into an own directory, so the watcher of the module only sees the events of the test
+    [[nodiscard]] auto prepare_plugin(const std::string_view name) -> std::filesystem::path {
+        const auto directory = std::filesystem::temp_directory_path() / name;
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+        const auto path = directory / std::filesystem::path {EREBOS_TEST_PLUGIN_PATH}.filename();
+        std::filesystem::copy_file(EREBOS_TEST_PLUGIN_PATH, path);
+        return path;
+    }
+
+    [[nodiscard]] auto get_update_count(const erebos::plugin::PluginModule& module) -> erebos::u64 {
+        std::array<erebos::u8, 16> state {};
+        EXPECT_EQ(module.get_api().save_state(module.get_instance(), state.data(), state.size()), state.size());
+        erebos::u64 update_count = 0;
+        std::memcpy(&update_count, state.data(), sizeof(erebos::u64));
+        return update_count;
+    }
+
+    auto set_fail_create(const bool is_failing) -> void {
+#ifdef PLATFORM_WINDOWS
+        ::_putenv_s("EREBOS_TEST_PLUGIN_FAIL_CREATE", is_failing ? "1" : "");
+#else
+        if(is_failing) {
+            ::setenv("EREBOS_TEST_PLUGIN_FAIL_CREATE", "1", 1);
+        }
+        else {
+            ::unsetenv("EREBOS_TEST_PLUGIN_FAIL_CREATE");
+        }
+#endif
+    }
+}// namespace
+
+TEST(erebos_plugin, reload_hands_over_state) {
+    const auto path = prepare_plugin("erebos-test-plugin-reload");
+    erebos::plugin::PluginModule module {path, false};
+    ASSERT_STREQ(module.get_api().name, "Test Plugin");
+    for(erebos::u32 i = 0; i < 3; i++) {
+        module.update(1.0 / 60.0);
+    }
+
+    ASSERT_TRUE(module.reload());
+    ASSERT_EQ(module.get_generation(), 1);
+    ASSERT_EQ(get_update_count(module), 3);
+    ASSERT_GT(module.get_last_reload_time().count(), 0);
+
+    module.update(1.0 / 60.0);
+    ASSERT_EQ(get_update_count(module), 4);
+    std::filesystem::remove_all(path.parent_path());
+}
+
+TEST(erebos_plugin, rebuilt_library_is_reloaded) {
+    const auto path = prepare_plugin("erebos-test-plugin-watch");
+    erebos::plugin::PluginModule module {path};
+    module.update(1.0 / 60.0);
+
+    // Overwrite the library like the build does, the module must reload it on the next handled event
+    std::filesystem::copy_file(EREBOS_TEST_PLUGIN_PATH, path, std::filesystem::copy_options::overwrite_existing);
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds {5};
+    while(module.get_generation() == 0 && std::chrono::steady_clock::now() < deadline) {
+        ASSERT_TRUE(module.handle_file_events());
+        std::this_thread::sleep_for(std::chrono::milliseconds {1});
+    }
+    ASSERT_EQ(module.get_generation(), 1);
+    ASSERT_EQ(get_update_count(module), 1);
+    std::filesystem::remove_all(path.parent_path());
+}
+
+TEST(erebos_plugin, invalid_library_is_rejected) {
+    const auto directory = std::filesystem::temp_directory_path() / "erebos-test-plugin-invalid";
+    std::filesystem::create_directories(directory);
+    const auto path = directory / "invalid.so";
+    std::ofstream {path} << "not a library";
+    ASSERT_THROW(erebos::plugin::PluginModule(path, false), std::runtime_error);
+    std::filesystem::remove_all(directory);
+}
+
+TEST(erebos_plugin, failed_creation_removes_shadow_copy) {
+    const auto path = prepare_plugin("erebos-test-plugin-fail-create");
+    const auto shadow_directory = std::filesystem::temp_directory_path() / "erebos-plugins";
+    const auto count_shadow_copies = [&]() -> erebos::usize {
+        if(!std::filesystem::exists(shadow_directory)) {
+            return 0;
+        }
+
+        erebos::usize count = 0;
+        for(const auto& entry : std::filesystem::directory_iterator {shadow_directory}) {
+            count += entry.path().stem().string().starts_with(path.stem().string()) ? 1 : 0;
+        }
+        return count;
+    };
+    const auto shadow_copy_count = count_shadow_copies();
+
+    set_fail_create(true);
+    ASSERT_THROW(erebos::plugin::PluginModule(path, false), std::runtime_error);
+    set_fail_create(false);
+    ASSERT_EQ(count_shadow_copies(), shadow_copy_count);
+    std::filesystem::remove_all(path.parent_path());
+}
+
+TEST(erebos_plugin, failed_reload_keeps_old_instance) {
+    const auto path = prepare_plugin("erebos-test-plugin-fail-reload");
+    erebos::plugin::PluginModule module {path, false};
+    module.update(1.0 / 60.0);
+
+    set_fail_create(true);
+    const auto result = module.reload();
+    set_fail_create(false);
+    ASSERT_FALSE(result);
+    ASSERT_NE(result.get_error().find("Test Plugin"), std::string::npos);
+    ASSERT_EQ(module.get_generation(), 0);
+
+    // The old library and instance stay loaded, so the module keeps updating the old instance
+    ASSERT_STREQ(module.get_api().name, "Test Plugin");
+    module.update(1.0 / 60.0);
+    ASSERT_EQ(get_update_count(module), 2);
+    std::filesystem::remove_all(path.parent_path());
+}
@@ -0,0 +1,117 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include <erebos/profiler.hpp>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <thread>
+
+namespace {
+    [[nodiscard]] auto read_file(const std::filesystem::path& path) -> std::string {
+        std::ifstream stream {path};
+        std::stringstream content {};
+        content << stream.rdbuf();
+        return content.str();
+    }
+
+    [[nodiscard]] auto count_occurrences(const std::string& value, const std::string_view pattern) -> erebos::usize {
+        erebos::usize count = 0;
+        for(auto offset = value.find(pattern); offset != std::string::npos; offset = value.find(pattern, offset + 1)) {
+            count++;
+        }
+        return count;
+    }
+}// namespace
+
+TEST(erebos_profiler, zones_of_all_threads_are_written) {
+    const auto path = std::filesystem::temp_directory_path() / "erebos-test-profiler.json";
+    ASSERT_FALSE(erebos::profiler::start_capture(path).is_error());
+    ASSERT_TRUE(erebos::profiler::start_capture(path).is_error());
+
+    std::thread worker_thread {[]() {
+        erebos::profiler::set_thread_name("Worker \"Thread\"");
+        for(erebos::usize i = 0; i < 100; i++) {
+            const erebos::profiler::ProfileScope scope {"worker_zone"};
+        }
+    }};
+
+    {
+        const erebos::profiler::ProfileScope outer_scope {"outer_zone"};
+        for(erebos::usize i = 0; i < 10; i++) {
+            const erebos::profiler::ProfileScope inner_scope {"inner_zone"};
+        }
+    }
+    worker_thread.join();
+    ASSERT_EQ(erebos::profiler::stop_capture(), 0);
+
+    const auto trace = read_file(path);
+    std::filesystem::remove(path);
+    ASSERT_EQ(trace.front(), '{');
+    ASSERT_EQ(trace.substr(trace.size() - 3), "]}\n");
+    ASSERT_EQ(count_occurrences(trace, R"("name":"outer_zone")"), 1);
+    ASSERT_EQ(count_occurrences(trace, R"("name":"inner_zone")"), 10);
+    ASSERT_EQ(count_occurrences(trace, R"("name":"worker_zone")"), 100);
+    ASSERT_EQ(count_occurrences(trace, R"("args":{"name":"Worker \"Thread\""})"), 1);
+}
+
+TEST(erebos_profiler, zones_outside_of_capture_are_ignored) {
+    {
+        const erebos::profiler::ProfileScope scope {"ignored_zone"};
+    }
+
+    const auto path = std::filesystem::temp_directory_path() / "erebos-test-profiler-ignored.json";
+    ASSERT_FALSE(erebos::profiler::start_capture(path).is_error());
+    ASSERT_EQ(erebos::profiler::stop_capture(), 0);
+    ASSERT_EQ(erebos::profiler::stop_capture(), 0);
+
+    const auto trace = read_file(path);
+    std::filesystem::remove(path);
+    ASSERT_EQ(count_occurrences(trace, "ignored_zone"), 0);
+}
+
+TEST(erebos_profiler, buffers_of_exited_threads_are_freed) {
+    const auto path = std::filesystem::temp_directory_path() / "erebos-test-profiler-churn.json";
+    ASSERT_FALSE(erebos::profiler::start_capture(path, std::chrono::milliseconds {1}).is_error());
+    for(erebos::usize i = 0; i < 32; i++) {
+        std::thread {[i]() {
+            erebos::profiler::set_thread_name(fmt::format("Worker {}", i));
+            for(erebos::usize j = 0; j < 10; j++) {
+                const erebos::profiler::ProfileScope scope {"churn_zone"};
+            }
+        }}.join();
+    }
+    ASSERT_EQ(erebos::profiler::stop_capture(), 0);
+
+    // The final flush drained the buffers of all exited threads and freed them, only the main thread can have a buffer
+    ASSERT_LE(erebos::profiler::detail::get_thread_buffer_count(), 1);
+    const auto trace = read_file(path);
+    std::filesystem::remove(path);
+    ASSERT_EQ(count_occurrences(trace, R"("name":"churn_zone")"), 320);
+    ASSERT_EQ(count_occurrences(trace, R"("args":{"name":"Worker 0"})"), 1);
+    ASSERT_EQ(count_occurrences(trace, R"("args":{"name":"Worker 31"})"), 1);
+
+    // Without a capture, the buffers of exited threads are freed when the next thread registers its buffer
+    for(erebos::usize i = 0; i < 32; i++) {
+        std::thread {[]() {
+            erebos::profiler::set_thread_name("Idle Worker");
+        }}.join();
+    }
+    ASSERT_LE(erebos::profiler::detail::get_thread_buffer_count(), 2);
+}
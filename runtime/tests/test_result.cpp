@@ -14,6 +14,7 @@
 
 #include <erebos/result.hpp>
 #include <gtest/gtest.h>
+#include <vector>
 
 TEST(erebos_Result, is_ok) {
     erebos::Result<erebos::u32> value = 1;
@@ -32,4 +33,111 @@ TEST(erebos_Result, forward) {
     static_assert(std::is_same_v<typename decltype(forwarded)::error_type, std::string>);
 
     ASSERT_TRUE(forwarded.is_error());
-}
\ No newline at end of file
+}
+namespace {
+    constexpr auto divide(const erebos::u32 value, const erebos::u32 divisor) noexcept -> erebos::Result<erebos::u32, erebos::ErrorCode> {
+        if(divisor == 0) {
+            return erebos::Error(erebos::ErrorCode {erebos::ErrorKind::UNKNOWN});
+        }
+        return value / divisor;
+    }
+
+    constexpr auto check(const bool is_valid) noexcept -> erebos::Result<void, erebos::ErrorCode> {
+        if(!is_valid) {
+            return erebos::Error(erebos::ErrorCode {erebos::ErrorKind::WAIT_FOR_FENCE, VK_TIMEOUT});
+        }
+        return {};
+    }
+}// namespace
+
+TEST(erebos_Result, error_code_layout) {
+    static_assert(sizeof(erebos::ErrorCode) == 8);
+    static_assert(sizeof(erebos::Result<void, erebos::ErrorCode>) == sizeof(erebos::ErrorCode));
+    static_assert(std::is_trivially_copyable_v<erebos::Result<void, erebos::ErrorCode>>);
+    static_assert(std::is_trivially_copyable_v<erebos::Result<erebos::u32, erebos::ErrorCode>>);
+    static_assert(std::is_copy_constructible_v<erebos::Result<std::vector<erebos::u32>>>);
+    static_assert(check(true).is_ok() && check(false).is_error());
+    static_assert(divide(6, 2).is_ok() && *divide(6, 2) == 3 && divide(1, 0).is_error());
+    static_assert(divide(6, 2).map([](const erebos::u32 value) { return value * 2; }).get() == 6);
+}
+
+TEST(erebos_Result, error_code_conversion) {
+    const auto error_code_result = check(false);
+    ASSERT_EQ(error_code_result.get_error().get_vk_result(), VK_TIMEOUT);
+
+    // The message is only formatted when the error code is converted into a string error
+    const erebos::Result<void> string_result = error_code_result;
+    ASSERT_TRUE(string_result.is_error());
+    ASSERT_EQ(string_result.get_error(), "Unable to wait for fence to be signaled: Timed out");
+    ASSERT_EQ(fmt::format("{}", error_code_result.get_error()), string_result.get_error());
+
+    erebos::Result<erebos::u32> value_result = divide(1, 0);
+    ASSERT_EQ(value_result.get_error(), "Unknown error");
+}
+
+TEST(erebos_Result, map) {
+    const erebos::Result<erebos::u32> value = 21;
+    const auto mapped = value.map([](const erebos::u32 number) { return static_cast<erebos::u64>(number) * 2; });
+    static_assert(std::is_same_v<typename decltype(mapped)::value_type, erebos::u64>);
+    ASSERT_EQ(*mapped, 42);
+
+    const erebos::Result<erebos::u32> error = erebos::Error<std::string>("Test");
+    ASSERT_EQ(error.map([](const erebos::u32 number) { return number; }).get_error(), "Test");
+}
+
+namespace {
+    // Counts the copies of the error, so the tests can verify that forwarding errors only moves them
+    struct CountingError final {
+        static inline erebos::usize copy_count = 0;
+        std::string message;
+
+        explicit CountingError(std::string message) noexcept
+            : message {std::move(message)} {
+        }
+
+        CountingError(const CountingError& other)
+            : message {other.message} {
+            copy_count++;
+        }
+
+        CountingError(CountingError&& other) noexcept = default;
+        auto operator=(const CountingError& other) -> CountingError& = default;
+        auto operator=(CountingError&& other) noexcept -> CountingError& = default;
+    };
+
+    auto fail(const std::string& message) -> erebos::Result<erebos::u32, CountingError> {
+        return erebos::Error(CountingError {message});
+    }
+
+    auto forward_with_try(const bool is_failing) -> erebos::Result<erebos::u64, CountingError> {
+        EREBOS_TRY_ASSIGN(const auto value, is_failing ? fail("failed") : erebos::Result<erebos::u32, CountingError> {21});
+        EREBOS_TRY(erebos::Result<void, CountingError> {});
+        return static_cast<erebos::u64>(value) * 2;
+    }
+}// namespace
+
+TEST(erebos_Result, monadic_functions_move_errors) {
+    CountingError::copy_count = 0;
+    const auto chained = fail("failed")
+                                 .and_then([](const erebos::u32 value) -> erebos::Result<erebos::u32, CountingError> { return value + 1; })
+                                 .transform([](const erebos::u32 value) { return static_cast<erebos::u64>(value); })
+                                 .transform_error([](CountingError&& error) { return std::move(error.message); });
+    ASSERT_EQ(chained.get_error(), "failed");
+    ASSERT_EQ(CountingError::copy_count, 0);
+
+    const auto forwarded = forward_with_try(true);
+    ASSERT_TRUE(forwarded.is_error());
+    ASSERT_EQ(forwarded.get_error().message, "failed");
+    ASSERT_EQ(*forward_with_try(false), 42);
+    ASSERT_EQ(CountingError::copy_count, 0);
+}
+
+TEST(erebos_Result, or_else_recovers) {
+    const auto recovered = fail("failed").or_else([](CountingError&&) -> erebos::Result<erebos::u32, CountingError> { return 7; });
+    ASSERT_EQ(*recovered, 7);
+
+    const auto void_result = erebos::Result<void, erebos::ErrorCode> {erebos::Error(erebos::ErrorCode {erebos::ErrorKind::RESET_FENCE})}
+                                     .or_else([](erebos::ErrorCode) -> erebos::Result<void, erebos::ErrorCode> { return {}; })
+                                     .and_then([]() -> erebos::Result<erebos::u32, erebos::ErrorCode> { return 3; });
+    ASSERT_EQ(*void_result, 3);
+}
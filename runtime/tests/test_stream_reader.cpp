@@ -0,0 +1,98 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include <erebos/platform/stream_reader.hpp>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace {
+    [[nodiscard]] auto create_stream_file(const std::string_view name, const erebos::usize size) -> std::filesystem::path {
+        const auto path = std::filesystem::temp_directory_path() / name;
+        std::vector<char> content(size);
+        for(erebos::usize i = 0; i < size; i++) {
+            content[i] = static_cast<char>(i * 31 + i / 4096);
+        }
+
+        std::ofstream stream {path, std::ios::binary | std::ios::trunc};
+        stream.write(content.data(), static_cast<std::streamsize>(content.size()));
+        return path;
+    }
+}// namespace
+
+TEST(erebos_platform_StreamReader, reads_file_in_chunks) {
+    // The size isn't a multiple of the buffer size, so the last chunk is a short read
+    constexpr erebos::usize file_size = 10 * 4096 + 123;
+    const auto path = create_stream_file("erebos-test-stream-reader.bin", file_size);
+    {
+        auto reader = erebos::platform::StreamReader {path, 4096, 2};
+        ASSERT_EQ(reader.get_file_size(), file_size);
+        ASSERT_EQ(reader.get_buffer_size() % erebos::platform::DIRECT_IO_ALIGNMENT, 0);
+
+        erebos::usize offset = 0;
+        while(true) {
+            auto chunk = reader.next();
+            ASSERT_TRUE(chunk);
+            if(!chunk->has_value()) {
+                break;
+            }
+
+            for(erebos::usize i = 0; i < (*chunk)->size(); i++) {
+                const auto position = offset + i;
+                ASSERT_EQ((**chunk)[i], static_cast<erebos::u8>(position * 31 + position / 4096));
+            }
+            offset += (*chunk)->size();
+        }
+        ASSERT_EQ(offset, file_size);
+
+        // The end of the stream is sticky
+        ASSERT_FALSE(reader.next()->has_value());
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(erebos_platform_StreamReader, empty_file_has_no_chunks) {
+    const auto path = create_stream_file("erebos-test-stream-reader-empty.bin", 0);
+    {
+        auto reader = erebos::platform::StreamReader {path};
+        auto chunk = reader.next();
+        ASSERT_TRUE(chunk);
+        ASSERT_FALSE(chunk->has_value());
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(erebos_platform_StreamReader, stops_while_reading_ahead) {
+    // The reader thread is blocked on the full ring when the reader is destroyed
+    const auto path = create_stream_file("erebos-test-stream-reader-stop.bin", 64 * 4096);
+    {
+        auto reader = erebos::platform::StreamReader {path, 4096, 3};
+        ASSERT_TRUE(reader.next()->has_value());
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(erebos_platform_StreamReader, rejects_invalid_arguments) {
+    const auto path = create_stream_file("erebos-test-stream-reader-invalid.bin", 4096);
+    ASSERT_THROW(erebos::platform::StreamReader(path, 4096, 1), std::runtime_error);
+    ASSERT_THROW(erebos::platform::StreamReader(path, 4096, erebos::platform::MAX_STREAM_READAHEAD_DEPTH + 1), std::runtime_error);
+    ASSERT_THROW(erebos::platform::StreamReader(std::filesystem::temp_directory_path() / "erebos-missing-stream.bin"), std::runtime_error);
+    ASSERT_FALSE(std::filesystem::exists(std::filesystem::temp_directory_path() / "erebos-missing-stream.bin"));
+    std::filesystem::remove(path);
+}
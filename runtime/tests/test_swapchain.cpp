@@ -0,0 +1,82 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include <array>
+#include <erebos/render/vulkan/swapchain.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace {
+    [[nodiscard]] auto make_surface_capabilities(const erebos::u32 min_image_count, const erebos::u32 max_image_count) noexcept
+        -> VkSurfaceCapabilitiesKHR {
+        VkSurfaceCapabilitiesKHR surface_capabilities {};
+        surface_capabilities.minImageCount = min_image_count;
+        surface_capabilities.maxImageCount = max_image_count;
+        return surface_capabilities;
+    }
+}// namespace
+
+TEST(erebos_render_vulkan_Swapchain, select_first_supported_preferred_present_mode) {
+    using erebos::render::vulkan::PresentMode;
+    using erebos::render::vulkan::detail::select_present_mode;
+    constexpr std::array supported_present_modes {VK_PRESENT_MODE_FIFO_KHR, VK_PRESENT_MODE_IMMEDIATE_KHR};
+
+    const std::vector preferred_present_modes {PresentMode::MAILBOX, PresentMode::IMMEDIATE, PresentMode::FIFO};
+    ASSERT_EQ(select_present_mode(supported_present_modes, preferred_present_modes), VK_PRESENT_MODE_IMMEDIATE_KHR);
+
+    const std::vector preferred_fifo_present_modes {PresentMode::FIFO, PresentMode::IMMEDIATE};
+    ASSERT_EQ(select_present_mode(supported_present_modes, preferred_fifo_present_modes), VK_PRESENT_MODE_FIFO_KHR);
+}
+
+TEST(erebos_render_vulkan_Swapchain, select_fifo_without_supported_preferred_present_mode) {
+    using erebos::render::vulkan::PresentMode;
+    using erebos::render::vulkan::detail::select_present_mode;
+    constexpr std::array supported_present_modes {VK_PRESENT_MODE_FIFO_KHR};
+
+    const std::vector preferred_present_modes {PresentMode::MAILBOX, PresentMode::FIFO_RELAXED};
+    ASSERT_EQ(select_present_mode(supported_present_modes, preferred_present_modes), VK_PRESENT_MODE_FIFO_KHR);
+    ASSERT_EQ(select_present_mode(supported_present_modes, {}), VK_PRESENT_MODE_FIFO_KHR);
+}
+
+TEST(erebos_render_vulkan_Swapchain, clamp_image_count_into_surface_limits) {
+    using erebos::render::vulkan::detail::clamp_image_count;
+    ASSERT_EQ(clamp_image_count(3, make_surface_capabilities(2, 8)), 3);
+    ASSERT_EQ(clamp_image_count(1, make_surface_capabilities(2, 8)), 2);
+    ASSERT_EQ(clamp_image_count(3, make_surface_capabilities(2, 2)), 2);
+
+    // A maximum image count of zero means that the surface has no maximum
+    ASSERT_EQ(clamp_image_count(16, make_surface_capabilities(2, 0)), 16);
+    ASSERT_EQ(clamp_image_count(0, make_surface_capabilities(3, 0)), 3);
+}
+
+TEST(erebos_render_vulkan_Swapchain, latency_wait_skips_presents_of_retired_swapchain) {
+    using erebos::render::vulkan::detail::get_latency_wait_present_id;
+    ASSERT_EQ(get_latency_wait_present_id(0, 1, 1), 0);
+    ASSERT_EQ(get_latency_wait_present_id(1, 1, 1), 0);
+    ASSERT_EQ(get_latency_wait_present_id(3, 1, 1), 2);
+    ASSERT_EQ(get_latency_wait_present_id(3, 1, 2), 1);
+
+    // After the recreation at present 10, the first present of the new swapchain is 11. The waits right after the
+    // recreation target presents of the retired swapchain and are skipped.
+    ASSERT_EQ(get_latency_wait_present_id(10, 11, 1), 0);
+    ASSERT_EQ(get_latency_wait_present_id(11, 11, 1), 0);
+    ASSERT_EQ(get_latency_wait_present_id(12, 11, 2), 0);
+    ASSERT_EQ(get_latency_wait_present_id(12, 11, 1), 11);
+    ASSERT_EQ(get_latency_wait_present_id(13, 11, 2), 11);
+}
@@ -0,0 +1,49 @@
+//   Copyright 2024 Cach30verfl0w
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+
+/**
+ * @author Cedric Hammes
+ * @since  18/10/2026
+ */
+
+#include <erebos/platform/symbol_table.hpp>
+#include <erebos/plugin/plugin_api.hpp>
+#include <gtest/gtest.h>
+
+namespace {
+    using PluginSymbols = erebos::platform::SymbolTable<
+            erebos::platform::Symbol<"erebos_get_plugin_api", const erebos::plugin::PluginApi*()>,
+            erebos::platform::Symbol<"erebos_missing_optional_symbol", void(), false>>;
+}// namespace
+
+static_assert(erebos::platform::hash_symbol_name("erebos_get_plugin_api") != erebos::platform::hash_symbol_name("erebos_get_plugin_apj"));
+static_assert(PluginSymbols::get_size() == 2);
+
+TEST(erebos_platform_symbol_table, resolve_symbols) {
+    const erebos::platform::LibraryLoader library {EREBOS_TEST_PLUGIN_PATH};
+    const PluginSymbols symbols {library};
+    ASSERT_TRUE(symbols.is_resolved<"erebos_get_plugin_api">());
+    ASSERT_FALSE(symbols.is_resolved<"erebos_missing_optional_symbol">());
+    ASSERT_EQ(symbols.get<"erebos_get_plugin_api">()()->api_version, erebos::plugin::PLUGIN_API_VERSION);
+}
+
+TEST(erebos_platform_symbol_table, missing_required_symbols) {
+    using MissingSymbols = erebos::platform::SymbolTable<erebos::platform::Symbol<"erebos_get_plugin_api", void()>,
+                                                         erebos::platform::Symbol<"erebos_missing_symbol", void()>,
+                                                         erebos::platform::Symbol<"erebos_other_missing_symbol", void()>>;
+    const erebos::platform::LibraryLoader library {EREBOS_TEST_PLUGIN_PATH};
+    const auto symbols = erebos::try_construct<MissingSymbols>(library);
+    ASSERT_TRUE(symbols.is_error());
+    ASSERT_NE(symbols.get_error().find("erebos_missing_symbol, erebos_other_missing_symbol"), std::string::npos);
+}
@@ -19,6 +19,8 @@
 
 #include <erebos/unicode.hpp>
 #include <gtest/gtest.h>
+#include <random>
+#include <vector>
 
 TEST(erebos_unicode, to_wcs) {
     ASSERT_EQ(erebos::unicode::to_wcs(R"(This is a test 🐺)"), LR"(This is a test 🐺)");
@@ -28,3 +30,222 @@ TEST(erebos_unicode, to_mbs) {
     ASSERT_EQ(erebos::unicode::to_mbs(LR"(This is a test 🐺)"), R"(This is a test 🐺)");
 }
 
+
+namespace {
+    // Mostly ASCII with multi-byte characters and invalid units in between, so the SIMD kernels switch between
+    // their ASCII blocks and the scalar code at every position of a block
+    template<typename CHAR>
+    auto generate_units(std::mt19937& random, const erebos::usize length) -> std::basic_string<CHAR> {
+        std::uniform_int_distribution<erebos::u32> kind_distribution {0, 15};
+        std::uniform_int_distribution<erebos::u32> unit_distribution {0, sizeof(CHAR) == 1 ? 0xFFU : 0x1F'FFFFU};
+        std::uniform_int_distribution<erebos::u32> code_point_distribution {0x80, 0x10'FFFF};
+        std::basic_string<CHAR> units {};
+        for(erebos::usize i = 0; i < length; ++i) {
+            const auto kind = kind_distribution(random);
+            if(kind == 0) {
+                units.push_back(static_cast<CHAR>(unit_distribution(random)));
+            }
+            else if(kind == 1) {
+                const auto code_point = static_cast<char32_t>(code_point_distribution(random));
+                if(erebos::unicode::detail::is_valid_codepoint(code_point)) {
+                    auto out = std::back_inserter(units);
+                    erebos::unicode::detail::UTFTraits<CHAR>::encode(code_point, out);
+                }
+            }
+            else {
+                units.push_back(static_cast<CHAR>('a' + (i % 26)));
+            }
+        }
+        return units;
+    }
+
+    template<typename CHAR_OUT, typename CHAR_IN>
+    auto convert_scalar(const std::basic_string<CHAR_IN>& value) -> std::basic_string<CHAR_OUT> {
+        using namespace erebos::unicode::detail;
+        std::basic_string<CHAR_OUT> result(get_max_converted_length<CHAR_OUT, CHAR_IN>(value.size()), CHAR_OUT {});
+        result.resize(convert_buffer_scalar(value.data(), value.size(), result.data()));
+        return result;
+    }
+
+    template<typename CHAR_OUT, typename CHAR_IN>
+    auto expect_matches_scalar(std::mt19937& random) -> void {
+        for(erebos::usize length = 0; length < 200; ++length) {
+            const auto value = generate_units<CHAR_IN>(random, length);
+            ASSERT_EQ((erebos::unicode::detail::convert<CHAR_OUT>(value)), (convert_scalar<CHAR_OUT>(value))) << "Length " << length;
+        }
+    }
+}// namespace
+
+TEST(erebos_unicode, ascii_blocks) {
+    const std::string value(1000, 'x');
+    ASSERT_EQ(erebos::unicode::to_wcs(value + "🐺" + value), std::wstring(1000, L'x') + L"🐺" + std::wstring(1000, L'x'));
+    ASSERT_EQ(erebos::unicode::to_mbs(std::wstring(1000, L'x') + L"🐺" + std::wstring(1000, L'x')), value + "🐺" + value);
+}
+
+TEST(erebos_unicode, invalid_sequences) {
+    ASSERT_EQ(erebos::unicode::to_wcs("a\xFF" "b"), L"a�b");
+    ASSERT_EQ(erebos::unicode::to_wcs("a\xC3"), L"a�");
+    ASSERT_EQ(erebos::unicode::to_wcs(std::string {"a\0b", 3}), (std::wstring {L"a\0b", 3}));
+    ASSERT_EQ((erebos::unicode::detail::convert<char>(std::u32string {U'a', 0xD800, 0x11'0000, U'b'})), "a��b");
+}
+
+TEST(erebos_unicode, matches_scalar_conversion) {
+    std::mt19937 random {42};// NOLINT(cert-msc51-cpp)
+    expect_matches_scalar<char16_t, char>(random);
+    expect_matches_scalar<char32_t, char>(random);
+    expect_matches_scalar<wchar_t, char>(random);
+    expect_matches_scalar<char, char16_t>(random);
+    expect_matches_scalar<char, char32_t>(random);
+    expect_matches_scalar<char, wchar_t>(random);
+}
+
+namespace {
+    // Converts the input in random chunks into random output buffers and resubmits the unread rest of a chunk like a
+    // caller with a fixed-size output buffer
+    template<typename CHAR_OUT, typename CHAR_IN>
+    auto convert_chunked(std::mt19937& random, const std::basic_string<CHAR_IN>& value) -> std::basic_string<CHAR_OUT> {
+        using Transcoder = erebos::unicode::Transcoder<CHAR_OUT, CHAR_IN>;
+        std::uniform_int_distribution<erebos::usize> chunk_distribution {0, 9};
+        std::uniform_int_distribution<erebos::usize> out_distribution {Transcoder::MIN_OUTPUT_LENGTH, Transcoder::MIN_OUTPUT_LENGTH + 32};
+
+        Transcoder transcoder {};
+        std::basic_string<CHAR_OUT> result {};
+        std::vector<CHAR_OUT> out {};
+        erebos::usize offset = 0;
+        while(offset < value.size()) {
+            auto chunk = std::span {value}.subspan(offset, std::min(chunk_distribution(random), value.size() - offset));
+            offset += chunk.size();
+            while(!chunk.empty()) {
+                out.resize(out_distribution(random));
+                const auto [read, written] = transcoder.convert(chunk, out);
+                result.append(out.data(), written);
+                chunk = chunk.subspan(read);
+            }
+        }
+
+        out.resize(Transcoder::MIN_OUTPUT_LENGTH);
+        result.append(out.data(), transcoder.finish(out));
+        return result;
+    }
+
+    template<typename CHAR_OUT, typename CHAR_IN>
+    auto expect_chunked_matches_whole(std::mt19937& random) -> void {
+        for(erebos::usize length = 0; length < 200; ++length) {
+            const auto value = generate_units<CHAR_IN>(random, length);
+            ASSERT_EQ((convert_chunked<CHAR_OUT>(random, value)), (convert_scalar<CHAR_OUT>(value))) << "Length " << length;
+        }
+    }
+}// namespace
+
+TEST(erebos_unicode, keeps_unit_after_invalid_sequence) {
+    ASSERT_EQ(erebos::unicode::to_wcs("a\xC3" "b"), L"a�b");
+    ASSERT_EQ((erebos::unicode::detail::convert<char>(std::u16string {u'a', 0xD800, u'b'})), "a�b");
+}
+
+TEST(erebos_unicode, convert_into) {
+    using namespace std::string_view_literals;
+    std::array<wchar_t, 4> out {};
+    const auto value = "ab🐺c"sv;
+
+    // The wolf needs two units with UTF-16, so it doesn't fit into the rest of the buffer with UTF-16 wchar_t
+    const auto [read, written] = erebos::unicode::convert_into<wchar_t, char>(value, out);
+    ASSERT_EQ(std::wstring_view(out.data(), written), sizeof(wchar_t) == 2 ? L"ab🐺"sv : L"ab🐺c"sv);
+    ASSERT_EQ(read, sizeof(wchar_t) == 2 ? 6 : value.size());
+}
+
+TEST(erebos_unicode, literals) {
+    using namespace erebos::unicode::literals;
+    static_assert("This is a test 🐺"_wcs == L"This is a test 🐺");
+    static_assert(L"This is a test 🐺"_mbs == "This is a test 🐺");
+    static_assert(erebos::unicode::convert_literal<char16_t, "a\xFF">() == u"a�");
+}
+
+TEST(erebos_unicode, transcoder_carries_incomplete_sequences) {
+    erebos::unicode::Transcoder<char32_t, char> transcoder {};
+    std::array<char32_t, decltype(transcoder)::MIN_OUTPUT_LENGTH> out {};
+    const std::string_view wolf {"🐺"};
+
+    for(erebos::usize i = 0; i < wolf.size() - 1; ++i) {
+        const auto result = transcoder.convert(wolf.substr(i, 1), out);
+        ASSERT_EQ(result.read, 1);
+        ASSERT_EQ(result.written, 0);
+    }
+    ASSERT_EQ(transcoder.get_carry_length(), 3);
+    ASSERT_EQ(transcoder.convert(wolf.substr(3), out).written, 1);
+    ASSERT_EQ(out[0], U'🐺');
+
+    ASSERT_EQ(transcoder.convert(wolf.substr(0, 2), out).written, 0);
+    ASSERT_EQ(transcoder.finish(out), 1);
+    ASSERT_EQ(out[0], U'�');
+}
+
+TEST(erebos_unicode, transcoder_chunk_boundaries) {
+    std::mt19937 random {1337};// NOLINT(cert-msc51-cpp)
+    for(erebos::usize i = 0; i < 20; ++i) {
+        expect_chunked_matches_whole<char16_t, char>(random);
+        expect_chunked_matches_whole<char32_t, char>(random);
+        expect_chunked_matches_whole<char, char16_t>(random);
+        expect_chunked_matches_whole<char, char32_t>(random);
+        expect_chunked_matches_whole<char32_t, char16_t>(random);
+    }
+}
+
+namespace {
+    auto find_invalid_scalar(const std::string& value) -> std::optional<erebos::usize> {
+        const auto* begin = reinterpret_cast<const erebos::u8*>(value.data());
+        const auto* current = begin;
+        const auto* end = begin + value.size();
+        while(current != end) {
+            const auto* sequence = current;
+            const auto code_point = erebos::unicode::detail::UTFTraits<erebos::u8>::decode(current, end);
+            if(code_point == erebos::unicode::detail::illegal || code_point == erebos::unicode::detail::incomplete) {
+                return static_cast<erebos::usize>(sequence - begin);
+            }
+        }
+        return std::nullopt;
+    }
+}// namespace
+
+TEST(erebos_unicode, validate_utf8) {
+    ASSERT_TRUE(erebos::unicode::validate_utf8(""));
+    ASSERT_TRUE(erebos::unicode::validate_utf8("This is a test 🐺, Größe, テスト, тест"));
+
+    // Overlong encodings, surrogates, code points above U+10FFFF, stray continuation bytes and incomplete sequences at
+    // every position of the SIMD blocks
+    for(const std::string invalid : {"\xC0\x80", "\xE0\x80\x80", "\xED\xA0\x80", "\xF4\x90\x80\x80", "\xF8", "\x80", "\xC3", "\xF0\x9F\x90"}) {
+        for(erebos::usize offset = 0; offset < 70; ++offset) {
+            const auto value = std::string(offset, 'a') + invalid + std::string(offset % 7, 'b');
+            ASSERT_FALSE(erebos::unicode::validate_utf8(value)) << "Offset " << offset;
+            ASSERT_EQ(erebos::unicode::find_invalid(value), offset) << "Offset " << offset;
+        }
+    }
+}
+
+TEST(erebos_unicode, find_invalid_matches_decoder) {
+    std::mt19937 random {7};// NOLINT(cert-msc51-cpp)
+    for(erebos::usize i = 0; i < 20; ++i) {
+        for(erebos::usize length = 0; length < 300; ++length) {
+            // Most inputs are valid, so the SIMD blocks before the first error are tested too
+            auto value = generate_units<char>(random, length);
+            if(length % 3 != 0) {
+                value = erebos::unicode::to_mbs(erebos::unicode::to_wcs(value));
+            }
+            ASSERT_EQ(erebos::unicode::find_invalid(value), find_invalid_scalar(value)) << "Length " << length;
+            ASSERT_EQ(erebos::unicode::validate_utf8(value), !find_invalid_scalar(value).has_value());
+            if(!find_invalid_scalar(value).has_value()) {
+                ASSERT_EQ(erebos::unicode::count_code_points(value), convert_scalar<char32_t>(value).size());
+            }
+        }
+    }
+}
+
+TEST(erebos_unicode, count_code_points) {
+    ASSERT_EQ(erebos::unicode::count_code_points("This is a test 🐺"), 16);
+
+    // More blocks than the counting kernels accumulate before summing up
+    std::string value {};
+    for(erebos::usize i = 0; i < 10'000; ++i) {
+        value += "aä🐺";
+    }
+    ASSERT_EQ(erebos::unicode::count_code_points(value), 30'000);
+}